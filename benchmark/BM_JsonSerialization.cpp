@@ -36,8 +36,12 @@
 
 #include <nfx/Serialization.h>
 
+#include <algorithm>
 #include <map>
+#include <memory>
+#include <set>
 #include <string>
+#include <string_view>
 #include <vector>
 
 namespace nfx::serialization::json::benchmark
@@ -61,6 +65,8 @@ namespace nfx::serialization::json::benchmark
         int age;
         std::string email;
         bool active;
+
+        bool operator==( const Person& ) const = default;
     };
 
     struct Company
@@ -173,6 +179,13 @@ namespace nfx::serialization::json
             builder.writeEndObject();
         }
 
+        // Lets Serializer<T>::toString() reserve its output once
+        static std::size_t estimateSize( const benchmark::Person& person )
+        {
+            // {"name":"","age":,"email":"","active":false} plus the widest int
+            return 44 + 11 + person.name.size() + person.email.size();
+        }
+
         static void fromDocument( const Document& doc, benchmark::Person& person )
         {
             if( auto val = doc.get<std::string>( "name" ) )
@@ -184,6 +197,23 @@ namespace nfx::serialization::json
             if( auto val = doc.get<bool>( "active" ) )
                 person.active = *val;
         }
+
+        // Checked before fromDocument() when validateOnDeserialize is set
+        static Document schema()
+        {
+            return Document::fromString( personSchema ).value();
+        }
+
+        static constexpr std::string_view personSchema = R"({
+            "type": "object",
+            "required": ["name", "age", "email", "active"],
+            "properties": {
+                "name": { "type": "string", "minLength": 1 },
+                "age": { "type": "integer", "minimum": 0, "maximum": 150 },
+                "email": { "type": "string" },
+                "active": { "type": "boolean" }
+            }
+        })";
     };
 
     template <>
@@ -196,7 +226,7 @@ namespace nfx::serialization::json
             builder.write( "industry", company.industry );
             builder.write( "employees", company.employees );
             builder.write( "founded", company.founded );
-            builder.write( "staff" );
+            builder.writeKey( "staff" );
             builder.writeStartArray();
             for( const auto& person : company.staff )
             {
@@ -206,6 +236,37 @@ namespace nfx::serialization::json
             builder.writeEndObject();
         }
 
+        // Member-wise diff for Serializer<T>::toMergePatch()
+        static void writeMergePatch(
+            const benchmark::Company& before, const benchmark::Company& after, MergePatchWriter& patch )
+        {
+            patch.member( "name", before.name, after.name );
+            patch.member( "industry", before.industry, after.industry );
+            patch.member( "employees", before.employees, after.employees );
+            patch.member( "founded", before.founded, after.founded );
+            patch.member( "staff", before.staff, after.staff );
+        }
+
+        // In-place update for Serializer<T>::applyMergePatch()
+        static void applyMergePatch( MergePatchReader& patch, benchmark::Company& obj )
+        {
+            patch.member( "name", obj.name );
+            patch.member( "industry", obj.industry );
+            patch.member( "employees", obj.employees );
+            patch.member( "founded", obj.founded );
+            patch.member( "staff", obj.staff );
+        }
+
+        static std::size_t estimateSize( const benchmark::Company& company )
+        {
+            std::size_t size = 60 + 2 * 11 + company.name.size() + company.industry.size() + company.staff.size();
+            for( const auto& person : company.staff )
+            {
+                size += SerializationTraits<benchmark::Person>::estimateSize( person );
+            }
+            return size;
+        }
+
         static void fromDocument( const Document& doc, benchmark::Company& company )
         {
             if( auto val = doc.get<std::string>( "name" ) )
@@ -216,6 +277,36 @@ namespace nfx::serialization::json
                 company.employees = *val;
             if( auto val = doc.get<int>( "founded" ) )
                 company.founded = *val;
+
+            // Staff is covered by the Company schema: read it without validating each Person again.
+            // Existing entries are overwritten in place, so Serializer<T>::deserializeInto() reuses them
+            if( auto staff = doc.get<Array>( "staff" ) )
+            {
+                company.staff.resize( staff->size() );
+                for( std::size_t i = 0; i < staff->size(); ++i )
+                {
+                    SerializationTraits<benchmark::Person>::fromDocument( ( *staff )[i], company.staff[i] );
+                }
+            }
+            else
+            {
+                company.staff.clear();
+            }
+        }
+
+        static Document schema()
+        {
+            return Document::fromString( R"({
+                "type": "object",
+                "required": ["name", "industry", "employees", "founded", "staff"],
+                "properties": {
+                    "name": { "type": "string", "minLength": 1 },
+                    "industry": { "type": "string" },
+                    "employees": { "type": "integer", "minimum": 0 },
+                    "founded": { "type": "integer", "minimum": 1800, "maximum": 2100 },
+                    "staff": { "type": "array", "items": )" +
+                                         std::string{ SerializationTraits<benchmark::Person>::personSchema } + "} } }" )
+                .value();
         }
     };
 } // namespace nfx::serialization::json
@@ -441,6 +532,62 @@ namespace nfx::serialization::json::benchmark
         }
     }
 
+    //=====================================================================
+    // Integer Array Deserialization (10,000 elements, range checking)
+    //=====================================================================
+
+    static void BM_IntArray10k_Deserialize( ::benchmark::State& state )
+    {
+        const std::string json = Serializer<std::vector<int>>::toString( createIntVector( 10000 ) );
+        Serializer<std::vector<int>>::Options options;
+        options.validateOnDeserialize = false;
+
+        for( auto _ : state )
+        {
+            auto data = Serializer<std::vector<int>>::fromString( json, options );
+            ::benchmark::DoNotOptimize( data );
+        }
+    }
+
+    static void BM_IntArray10k_DeserializeChecked( ::benchmark::State& state )
+    {
+        const std::string json = Serializer<std::vector<int>>::toString( createIntVector( 10000 ) );
+        Serializer<std::vector<int>>::Options options;
+        options.validateOnDeserialize = true;
+
+        for( auto _ : state )
+        {
+            auto data = Serializer<std::vector<int>>::fromString( json, options );
+            ::benchmark::DoNotOptimize( data );
+        }
+    }
+
+    static void BM_UInt16Array10k_Deserialize( ::benchmark::State& state )
+    {
+        const std::string json = Serializer<std::vector<int>>::toString( createIntVector( 10000 ) );
+        Serializer<std::vector<std::uint16_t>>::Options options;
+        options.validateOnDeserialize = false;
+
+        for( auto _ : state )
+        {
+            auto data = Serializer<std::vector<std::uint16_t>>::fromString( json, options );
+            ::benchmark::DoNotOptimize( data );
+        }
+    }
+
+    static void BM_UInt16Array10k_DeserializeChecked( ::benchmark::State& state )
+    {
+        const std::string json = Serializer<std::vector<int>>::toString( createIntVector( 10000 ) );
+        Serializer<std::vector<std::uint16_t>>::Options options;
+        options.validateOnDeserialize = true;
+
+        for( auto _ : state )
+        {
+            auto data = Serializer<std::vector<std::uint16_t>>::fromString( json, options );
+            ::benchmark::DoNotOptimize( data );
+        }
+    }
+
     //=====================================================================
     // String-Int Map (100 pairs)
     //=====================================================================
@@ -714,7 +861,7 @@ namespace nfx::serialization::json::benchmark
             builder.write( "industry", company.industry );
             builder.write( "employees", company.employees );
             builder.write( "founded", company.founded );
-            builder.write( "staff" );
+            builder.writeKey( "staff" );
             builder.writeStartArray();
             for( const auto& p : company.staff )
             {
@@ -744,6 +891,138 @@ namespace nfx::serialization::json::benchmark
         }
     }
 
+    // Export of many companies: output reserved from estimateSize(), or from the size of the previous run
+    static void BM_CompanyVector100_SerializerTraits( ::benchmark::State& state )
+    {
+        const Company company{ "Acme Corporation", "Technology", 5000, 1985, createPersonVector( 10 ) };
+        std::vector<Company> companies( 100, company );
+
+        for( auto _ : state )
+        {
+            std::string json = Serializer<std::vector<Company>>::toString( companies );
+            ::benchmark::DoNotOptimize( json );
+        }
+    }
+
+    static void BM_CompanyVector100_SerializerSizeHint( ::benchmark::State& state )
+    {
+        const Company company{ "Acme Corporation", "Technology", 5000, 1985, createPersonVector( 10 ) };
+        std::vector<Company> companies( 100, company );
+        std::size_t sizeHint = 0;
+        Serializer<std::vector<Company>>::Options options;
+        options.sizeHint = &sizeHint;
+
+        for( auto _ : state )
+        {
+            std::string json = Serializer<std::vector<Company>>::toString( companies, options );
+            ::benchmark::DoNotOptimize( json );
+        }
+    }
+
+    // The same company embedded in every response: rendered once, then spliced from the cache
+    static void BM_CompanyVector100_CachedJson( ::benchmark::State& state )
+    {
+        const Company company{ "Acme Corporation", "Technology", 5000, 1985, createPersonVector( 10 ) };
+        std::vector<CachedJson<Company>> companies( 100, CachedJson<Company>{ company } );
+
+        for( auto _ : state )
+        {
+            std::string json = Serializer<std::vector<CachedJson<Company>>>::toString( companies );
+            ::benchmark::DoNotOptimize( json );
+        }
+    }
+
+    // State sync: full snapshot of the new state, or a merge patch against the previous one
+    static void BM_Map1k_Snapshot( ::benchmark::State& state )
+    {
+        auto before = createStringIntMap( 1000 );
+        auto after = before;
+        after["key_500"] = -1;
+
+        for( auto _ : state )
+        {
+            std::string json = Serializer<std::map<std::string, int>>::toString( after );
+            ::benchmark::DoNotOptimize( json );
+        }
+    }
+
+    static void BM_Map1k_MergePatch( ::benchmark::State& state )
+    {
+        auto before = createStringIntMap( 1000 );
+        auto after = before;
+        after["key_500"] = -1;
+
+        for( auto _ : state )
+        {
+            std::string json = Serializer<std::map<std::string, int>>::toMergePatch( before, after );
+            ::benchmark::DoNotOptimize( json );
+        }
+    }
+
+    static void BM_Company_MergePatch( ::benchmark::State& state )
+    {
+        const Company before{ "Acme Corporation", "Technology", 5000, 1985, createPersonVector( 10 ) };
+        Company after = before;
+        after.employees = 5001;
+
+        for( auto _ : state )
+        {
+            std::string json = Serializer<Company>::toMergePatch( before, after );
+            ::benchmark::DoNotOptimize( json );
+        }
+    }
+
+    // Receiving side: decode the full snapshot, or patch the previous state in place
+    static void BM_Map1k_FromString( ::benchmark::State& state )
+    {
+        auto after = createStringIntMap( 1000 );
+        after["key_500"] = -1;
+        const std::string json = Serializer<std::map<std::string, int>>::toString( after );
+
+        for( auto _ : state )
+        {
+            auto data = Serializer<std::map<std::string, int>>::fromString( json );
+            ::benchmark::DoNotOptimize( data );
+        }
+    }
+
+    static void BM_Map1k_ApplyMergePatch( ::benchmark::State& state )
+    {
+        auto data = createStringIntMap( 1000 );
+        const std::string patch = R"({"key_500":-1})";
+
+        for( auto _ : state )
+        {
+            Serializer<std::map<std::string, int>>::applyMergePatch( patch, data );
+            ::benchmark::DoNotOptimize( data );
+        }
+    }
+
+    static void BM_Company_FromString( ::benchmark::State& state )
+    {
+        Company company{ "Acme Corporation", "Technology", 5000, 1985, createPersonVector( 10 ) };
+        company.employees = 5001;
+        const std::string json = Serializer<Company>::toString( company );
+
+        for( auto _ : state )
+        {
+            Company data = Serializer<Company>::fromString( json );
+            ::benchmark::DoNotOptimize( data );
+        }
+    }
+
+    static void BM_Company_ApplyMergePatch( ::benchmark::State& state )
+    {
+        Company company{ "Acme Corporation", "Technology", 5000, 1985, createPersonVector( 10 ) };
+        const std::string patch = R"({"employees":5001})";
+
+        for( auto _ : state )
+        {
+            Serializer<Company>::applyMergePatch( patch, company );
+            ::benchmark::DoNotOptimize( company );
+        }
+    }
+
     static void BM_Company_SerializerLegacy( ::benchmark::State& state )
     {
         CompanyLegacy company{ "Acme Corporation", "Technology", 5000, 1985, createPersonLegacyVector( 10 ) };
@@ -756,6 +1035,394 @@ namespace nfx::serialization::json::benchmark
         }
     }
 
+    //=====================================================================
+    // Deserialization with and without schema validation
+    //=====================================================================
+
+    template <typename T>
+    static void deserializeLoop( ::benchmark::State& state, const std::string& json, bool validate )
+    {
+        typename Serializer<T>::Options options;
+        options.validateOnDeserialize = validate;
+
+        for( auto _ : state )
+        {
+            T value = Serializer<T>::fromString( json, options );
+            ::benchmark::DoNotOptimize( value );
+        }
+    }
+
+    // Message loop: decode every message into the same object, reusing its storage
+    template <typename T>
+    static void deserializeIntoLoop( ::benchmark::State& state, const std::string& json )
+    {
+        typename Serializer<T>::Options options;
+        options.validateOnDeserialize = false;
+
+        T value{};
+        for( auto _ : state )
+        {
+            Serializer<T>::deserializeInto( json, value, options );
+            ::benchmark::DoNotOptimize( value );
+        }
+    }
+
+    static void BM_PersonVector100_Deserialize( ::benchmark::State& state )
+    {
+        const std::string json = Serializer<std::vector<Person>>::toString( createPersonVector( 100 ) );
+        deserializeLoop<std::vector<Person>>( state, json, false );
+    }
+
+    static void BM_PersonVector100_DeserializeValidated( ::benchmark::State& state )
+    {
+        const std::string json = Serializer<std::vector<Person>>::toString( createPersonVector( 100 ) );
+        deserializeLoop<std::vector<Person>>( state, json, true );
+    }
+
+    static void BM_Company_Deserialize( ::benchmark::State& state )
+    {
+        Company company{ "Acme Corporation", "Technology", 5000, 1985, createPersonVector( 10 ) };
+        deserializeLoop<Company>( state, Serializer<Company>::toString( company ), false );
+    }
+
+    static void BM_Company_DeserializeValidated( ::benchmark::State& state )
+    {
+        Company company{ "Acme Corporation", "Technology", 5000, 1985, createPersonVector( 10 ) };
+        deserializeLoop<Company>( state, Serializer<Company>::toString( company ), true );
+    }
+
+    // Ordered containers: keys arrive sorted, so each node is linked at the end of the tree
+    static void BM_Map100_Deserialize( ::benchmark::State& state )
+    {
+        const std::string json = Serializer<std::map<std::string, int>>::toString( createStringIntMap( 100 ) );
+        deserializeLoop<std::map<std::string, int>>( state, json, false );
+    }
+
+    static void BM_Map100k_Deserialize( ::benchmark::State& state )
+    {
+        const std::string json = Serializer<std::map<std::string, int>>::toString( createStringIntMap( 100000 ) );
+        deserializeLoop<std::map<std::string, int>>( state, json, false );
+    }
+
+    static void BM_IntSet100k_Deserialize( ::benchmark::State& state )
+    {
+        std::set<int> data;
+        for( int i = 0; i < 100000; ++i )
+        {
+            data.insert( i * 7 );
+        }
+        deserializeLoop<std::set<int>>( state, Serializer<std::set<int>>::toString( data ), false );
+    }
+
+    static void BM_PersonVector100_DeserializeInto( ::benchmark::State& state )
+    {
+        const std::string json = Serializer<std::vector<Person>>::toString( createPersonVector( 100 ) );
+        deserializeIntoLoop<std::vector<Person>>( state, json );
+    }
+
+    static void BM_Company_DeserializeInto( ::benchmark::State& state )
+    {
+        Company company{ "Acme Corporation", "Technology", 5000, 1985, createPersonVector( 10 ) };
+        deserializeIntoLoop<Company>( state, Serializer<Company>::toString( company ) );
+    }
+
+    //=====================================================================
+    // Shared pointees: repeated in full vs written once and referenced
+    //=====================================================================
+
+    using Mesh = std::vector<double>;
+    using SceneNodes = std::vector<std::shared_ptr<Mesh>>;
+
+    // 100 nodes drawing 4 meshes of 256 vertices
+    static SceneNodes createScene()
+    {
+        std::vector<std::shared_ptr<Mesh>> meshes;
+        for( int m = 0; m < 4; ++m )
+        {
+            auto mesh = std::make_shared<Mesh>( 256 );
+            for( std::size_t v = 0; v < mesh->size(); ++v )
+            {
+                ( *mesh )[v] = static_cast<double>( v ) * 0.25 + m;
+            }
+            meshes.push_back( std::move( mesh ) );
+        }
+
+        SceneNodes nodes;
+        for( std::size_t n = 0; n < 100; ++n )
+        {
+            nodes.push_back( meshes[n % meshes.size()] );
+        }
+        return nodes;
+    }
+
+    static void sharedMeshesToString( ::benchmark::State& state, bool references )
+    {
+        const SceneNodes nodes = createScene();
+        Serializer<SceneNodes>::Options options;
+        options.preserveSharedReferences = references;
+
+        std::size_t bytes = 0;
+        for( auto _ : state )
+        {
+            std::string json = Serializer<SceneNodes>::toString( nodes, options );
+            bytes = json.size();
+            ::benchmark::DoNotOptimize( json );
+        }
+        state.counters["bytes"] = static_cast<double>( bytes );
+    }
+
+    static void sharedMeshesFromString( ::benchmark::State& state, bool references )
+    {
+        Serializer<SceneNodes>::Options options;
+        options.preserveSharedReferences = references;
+        options.validateOnDeserialize = false;
+        const std::string json = Serializer<SceneNodes>::toString( createScene(), options );
+
+        for( auto _ : state )
+        {
+            SceneNodes nodes = Serializer<SceneNodes>::fromString( json, options );
+            ::benchmark::DoNotOptimize( nodes );
+        }
+    }
+
+    static void BM_SharedMeshes_ToString( ::benchmark::State& state )
+    {
+        sharedMeshesToString( state, false );
+    }
+
+    static void BM_SharedMeshes_ToStringReferences( ::benchmark::State& state )
+    {
+        sharedMeshesToString( state, true );
+    }
+
+    static void BM_SharedMeshes_FromString( ::benchmark::State& state )
+    {
+        sharedMeshesFromString( state, false );
+    }
+
+    static void BM_SharedMeshes_FromStringReferences( ::benchmark::State& state )
+    {
+        sharedMeshesFromString( state, true );
+    }
+
+    //=====================================================================
+    // Multimap entries: {"key": K, "value": V} objects vs [K, V] arrays
+    //=====================================================================
+
+    using Postings = std::multimap<int, std::string>;
+
+    // 10k entries over 1k keys
+    static Postings createPostings()
+    {
+        Postings postings;
+        for( int i = 0; i < 10000; ++i )
+        {
+            postings.emplace( i % 1000, "doc" + std::to_string( i ) );
+        }
+        return postings;
+    }
+
+    static void postingsToString( ::benchmark::State& state, PairLayout layout )
+    {
+        const Postings postings = createPostings();
+        Serializer<Postings>::Options options;
+        options.pairLayout = layout;
+
+        std::size_t bytes = 0;
+        for( auto _ : state )
+        {
+            std::string json = Serializer<Postings>::toString( postings, options );
+            bytes = json.size();
+            ::benchmark::DoNotOptimize( json );
+        }
+        state.counters["bytes"] = static_cast<double>( bytes );
+    }
+
+    static void postingsFromString( ::benchmark::State& state, PairLayout layout )
+    {
+        Serializer<Postings>::Options options;
+        options.pairLayout = layout;
+        options.validateOnDeserialize = false;
+        const std::string json = Serializer<Postings>::toString( createPostings(), options );
+
+        for( auto _ : state )
+        {
+            Postings postings = Serializer<Postings>::fromString( json, options );
+            ::benchmark::DoNotOptimize( postings );
+        }
+    }
+
+    static void BM_Multimap10k_ToString( ::benchmark::State& state )
+    {
+        postingsToString( state, PairLayout::Object );
+    }
+
+    static void BM_Multimap10k_ToStringCompact( ::benchmark::State& state )
+    {
+        postingsToString( state, PairLayout::Array );
+    }
+
+    static void BM_Multimap10k_FromString( ::benchmark::State& state )
+    {
+        postingsFromString( state, PairLayout::Object );
+    }
+
+    static void BM_Multimap10k_FromStringCompact( ::benchmark::State& state )
+    {
+        postingsFromString( state, PairLayout::Array );
+    }
+
+    //=====================================================================
+    // Enumerations: names (perfect hash lookup) vs underlying integers
+    //=====================================================================
+
+    enum class Color
+    {
+        Red,
+        Green,
+        Blue,
+        Cyan,
+        Magenta,
+        Yellow,
+        Black,
+        White
+    };
+
+    using Palette = std::vector<Color>;
+
+    static Palette createPalette()
+    {
+        Palette palette;
+        palette.reserve( 10000 );
+        for( int i = 0; i < 10000; ++i )
+        {
+            palette.push_back( static_cast<Color>( ( i * 7 ) % 8 ) );
+        }
+        return palette;
+    }
+
+    static void paletteToString( ::benchmark::State& state, EnumFormat format )
+    {
+        const Palette palette = createPalette();
+        Serializer<Palette>::Options options;
+        options.enumFormat = format;
+
+        for( auto _ : state )
+        {
+            std::string json = Serializer<Palette>::toString( palette, options );
+            ::benchmark::DoNotOptimize( json );
+        }
+    }
+
+    static void paletteFromString( ::benchmark::State& state, EnumFormat format )
+    {
+        Serializer<Palette>::Options options;
+        options.enumFormat = format;
+        options.validateOnDeserialize = false;
+        const std::string json = Serializer<Palette>::toString( createPalette(), options );
+
+        for( auto _ : state )
+        {
+            Palette palette = Serializer<Palette>::fromString( json, options );
+            ::benchmark::DoNotOptimize( palette );
+        }
+    }
+
+    static void BM_Enum10k_ToStringNames( ::benchmark::State& state )
+    {
+        paletteToString( state, EnumFormat::Name );
+    }
+
+    static void BM_Enum10k_ToStringIntegers( ::benchmark::State& state )
+    {
+        paletteToString( state, EnumFormat::Integer );
+    }
+
+    static void BM_Enum10k_FromStringNames( ::benchmark::State& state )
+    {
+        paletteFromString( state, EnumFormat::Name );
+    }
+
+    static void BM_Enum10k_FromStringIntegers( ::benchmark::State& state )
+    {
+        paletteFromString( state, EnumFormat::Integer );
+    }
+
+    //=====================================================================
+    // Byte containers: base64 and hex strings vs arrays of numbers
+    //=====================================================================
+
+    using Blob = std::vector<std::uint8_t>;
+
+    static Blob createBlob()
+    {
+        Blob blob( 64 * 1024 );
+        for( std::size_t i = 0; i < blob.size(); ++i )
+        {
+            blob[i] = static_cast<std::uint8_t>( i * 131 + ( i >> 7 ) );
+        }
+        return blob;
+    }
+
+    static void blobToString( ::benchmark::State& state, BytesFormat format )
+    {
+        const Blob blob = createBlob();
+        Serializer<Blob>::Options options;
+        options.bytesFormat = format;
+
+        for( auto _ : state )
+        {
+            std::string json = Serializer<Blob>::toString( blob, options );
+            ::benchmark::DoNotOptimize( json );
+        }
+        state.SetBytesProcessed( static_cast<std::int64_t>( state.iterations() * blob.size() ) );
+    }
+
+    static void blobFromString( ::benchmark::State& state, BytesFormat format )
+    {
+        Serializer<Blob>::Options options;
+        options.bytesFormat = format;
+        options.validateOnDeserialize = false;
+        const std::string json = Serializer<Blob>::toString( createBlob(), options );
+
+        for( auto _ : state )
+        {
+            Blob blob = Serializer<Blob>::fromString( json, options );
+            ::benchmark::DoNotOptimize( blob );
+        }
+        state.SetBytesProcessed( static_cast<std::int64_t>( state.iterations() * 64 * 1024 ) );
+    }
+
+    static void BM_Blob64k_ToStringBase64( ::benchmark::State& state )
+    {
+        blobToString( state, BytesFormat::Base64 );
+    }
+
+    static void BM_Blob64k_ToStringHex( ::benchmark::State& state )
+    {
+        blobToString( state, BytesFormat::Hex );
+    }
+
+    static void BM_Blob64k_ToStringArray( ::benchmark::State& state )
+    {
+        blobToString( state, BytesFormat::Array );
+    }
+
+    static void BM_Blob64k_FromStringBase64( ::benchmark::State& state )
+    {
+        blobFromString( state, BytesFormat::Base64 );
+    }
+
+    static void BM_Blob64k_FromStringHex( ::benchmark::State& state )
+    {
+        blobFromString( state, BytesFormat::Hex );
+    }
+
+    static void BM_Blob64k_FromStringArray( ::benchmark::State& state )
+    {
+        blobFromString( state, BytesFormat::Array );
+    }
+
     //=====================================================================
     // Small Document (3 fields)
     //=====================================================================
@@ -819,6 +1486,11 @@ namespace nfx::serialization::json::benchmark
     BENCHMARK( BM_IntArray10k_Builder );
     BENCHMARK( BM_IntArray10k_Serializer );
 
+    BENCHMARK( BM_IntArray10k_Deserialize );
+    BENCHMARK( BM_IntArray10k_DeserializeChecked );
+    BENCHMARK( BM_UInt16Array10k_Deserialize );
+    BENCHMARK( BM_UInt16Array10k_DeserializeChecked );
+
     BENCHMARK( BM_Map100_Document );
     BENCHMARK( BM_Map100_Builder );
     BENCHMARK( BM_Map100_Serializer );
@@ -841,6 +1513,49 @@ namespace nfx::serialization::json::benchmark
     BENCHMARK( BM_Company_Builder );
     BENCHMARK( BM_Company_SerializerTraits );
     BENCHMARK( BM_Company_SerializerLegacy );
+    BENCHMARK( BM_CompanyVector100_SerializerTraits );
+    BENCHMARK( BM_CompanyVector100_SerializerSizeHint );
+    BENCHMARK( BM_CompanyVector100_CachedJson );
+
+    BENCHMARK( BM_Map1k_Snapshot );
+    BENCHMARK( BM_Map1k_MergePatch );
+    BENCHMARK( BM_Company_MergePatch );
+    BENCHMARK( BM_Map1k_FromString );
+    BENCHMARK( BM_Map1k_ApplyMergePatch );
+    BENCHMARK( BM_Company_FromString );
+    BENCHMARK( BM_Company_ApplyMergePatch );
+
+    BENCHMARK( BM_PersonVector100_Deserialize );
+    BENCHMARK( BM_PersonVector100_DeserializeValidated );
+    BENCHMARK( BM_Company_Deserialize );
+    BENCHMARK( BM_Company_DeserializeValidated );
+    BENCHMARK( BM_Map100_Deserialize );
+    BENCHMARK( BM_Map100k_Deserialize );
+    BENCHMARK( BM_IntSet100k_Deserialize );
+    BENCHMARK( BM_PersonVector100_DeserializeInto );
+    BENCHMARK( BM_Company_DeserializeInto );
+
+    BENCHMARK( BM_SharedMeshes_ToString );
+    BENCHMARK( BM_SharedMeshes_ToStringReferences );
+    BENCHMARK( BM_SharedMeshes_FromString );
+    BENCHMARK( BM_SharedMeshes_FromStringReferences );
+
+    BENCHMARK( BM_Multimap10k_ToString );
+    BENCHMARK( BM_Multimap10k_ToStringCompact );
+    BENCHMARK( BM_Multimap10k_FromString );
+    BENCHMARK( BM_Multimap10k_FromStringCompact );
+
+    BENCHMARK( BM_Enum10k_ToStringNames );
+    BENCHMARK( BM_Enum10k_ToStringIntegers );
+    BENCHMARK( BM_Enum10k_FromStringNames );
+    BENCHMARK( BM_Enum10k_FromStringIntegers );
+
+    BENCHMARK( BM_Blob64k_ToStringBase64 );
+    BENCHMARK( BM_Blob64k_ToStringHex );
+    BENCHMARK( BM_Blob64k_ToStringArray );
+    BENCHMARK( BM_Blob64k_FromStringBase64 );
+    BENCHMARK( BM_Blob64k_FromStringHex );
+    BENCHMARK( BM_Blob64k_FromStringArray );
 
     BENCHMARK( BM_SmallDocument_Document );
     BENCHMARK( BM_SmallDocument_PrettyPrint );
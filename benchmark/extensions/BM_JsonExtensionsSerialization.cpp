@@ -24,7 +24,7 @@
 
 /**
  * @file BM_JsonExtensionsSerialization.cpp
- * @brief Benchmarks for JSON serialization of extension types (DateTime, Datatypes, Containers)
+ * @brief Benchmarks for JSON serialization of extension types (DateTime, std::chrono, Datatypes, Containers)
  * @details Measures the performance of serializing nfx extension types to JSON,
  *          focusing on temporary allocations and string conversion overhead.
  */
@@ -194,6 +194,89 @@ namespace nfx::serialization::json::benchmark
     }
 #endif
 
+    //=====================================================================
+    // std::chrono Serialization Benchmarks
+    //=====================================================================
+
+    // Telemetry-like samples: 1k latencies and 1k timestamps
+    static std::vector<std::chrono::nanoseconds> createLatencies()
+    {
+        std::vector<std::chrono::nanoseconds> latencies;
+        for( int i = 0; i < 1000; ++i )
+        {
+            latencies.emplace_back( 250'000 + i * 7'919 );
+        }
+        return latencies;
+    }
+
+    static std::vector<std::chrono::system_clock::time_point> createTimestamps()
+    {
+        const std::chrono::system_clock::time_point start{ std::chrono::seconds{ 1'718'461'845 } };
+        std::vector<std::chrono::system_clock::time_point> timestamps;
+        for( int i = 0; i < 1000; ++i )
+        {
+            timestamps.push_back( start + std::chrono::microseconds{ i * 1'337 } );
+        }
+        return timestamps;
+    }
+
+    template <typename T>
+    static void chronoToString( ::benchmark::State& state, const T& values, TimeFormat format )
+    {
+        typename Serializer<T>::Options options;
+        options.timeFormat = format;
+
+        for( auto _ : state )
+        {
+            std::string json = Serializer<T>::toString( values, options );
+            ::benchmark::DoNotOptimize( json );
+        }
+    }
+
+    template <typename T>
+    static void chronoFromString( ::benchmark::State& state, const T& values, TimeFormat format )
+    {
+        typename Serializer<T>::Options options;
+        options.timeFormat = format;
+        const std::string json = Serializer<T>::toString( values, options );
+
+        for( auto _ : state )
+        {
+            T restored = Serializer<T>::fromString( json, options );
+            ::benchmark::DoNotOptimize( restored );
+        }
+    }
+
+    static void BM_ChronoDurations1k_Ticks( ::benchmark::State& state )
+    {
+        chronoToString( state, createLatencies(), TimeFormat::Ticks );
+    }
+
+    static void BM_ChronoDurations1k_Iso8601( ::benchmark::State& state )
+    {
+        chronoToString( state, createLatencies(), TimeFormat::Iso8601 );
+    }
+
+    static void BM_ChronoTimePoints1k_Ticks( ::benchmark::State& state )
+    {
+        chronoToString( state, createTimestamps(), TimeFormat::Ticks );
+    }
+
+    static void BM_ChronoTimePoints1k_Iso8601( ::benchmark::State& state )
+    {
+        chronoToString( state, createTimestamps(), TimeFormat::Iso8601 );
+    }
+
+    static void BM_ChronoTimePoints1k_FromTicks( ::benchmark::State& state )
+    {
+        chronoFromString( state, createTimestamps(), TimeFormat::Ticks );
+    }
+
+    static void BM_ChronoTimePoints1k_FromIso8601( ::benchmark::State& state )
+    {
+        chronoFromString( state, createTimestamps(), TimeFormat::Iso8601 );
+    }
+
     //=====================================================================
     // Benchmark Registration
     //=====================================================================
@@ -213,6 +296,13 @@ namespace nfx::serialization::json::benchmark
     BENCHMARK( BM_TimeSpan_Serializer );
     BENCHMARK( BM_DateTimeArray10_Serializer );
 #endif
+
+    BENCHMARK( BM_ChronoDurations1k_Ticks );
+    BENCHMARK( BM_ChronoDurations1k_Iso8601 );
+    BENCHMARK( BM_ChronoTimePoints1k_Ticks );
+    BENCHMARK( BM_ChronoTimePoints1k_Iso8601 );
+    BENCHMARK( BM_ChronoTimePoints1k_FromTicks );
+    BENCHMARK( BM_ChronoTimePoints1k_FromIso8601 );
 } // namespace nfx::serialization::json::benchmark
 
 BENCHMARK_MAIN();
@@ -37,3 +37,11 @@ target_compile_features(${PROJECT_NAME}
     INTERFACE
         cxx_std_20
 )
+
+# Scalar fallback for the structural scanner when SIMD is disabled
+if(NOT NFX_SERIALIZATION_ENABLE_SIMD)
+    target_compile_definitions(${PROJECT_NAME}
+        INTERFACE
+            NFX_SERIALIZATION_DISABLE_SIMD
+    )
+endif()
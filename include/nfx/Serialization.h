@@ -34,3 +34,4 @@
 #pragma once
 
 #include "serialization/json/Serializer.h"
+#include "serialization/json/Schema.h"
@@ -0,0 +1,623 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2026 nfx
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * @file ByteCodec.inl
+ * @brief Base64 and hex codec implementation file
+ * @details Contains the block kernels (AVX2, SSSE3/SSE2 and scalar fallback) and the public
+ *          encode/decode functions. Block kernels stop at the first block holding an invalid
+ *          character and leave it to the scalar loop, which reports the failure.
+ */
+
+#include <array>
+
+#if !defined( NFX_SERIALIZATION_DISABLE_SIMD )
+#    if defined( __AVX2__ )
+#        include <immintrin.h>
+#        define NFX_SERIALIZATION_CODEC_AVX2 1
+#        define NFX_SERIALIZATION_CODEC_SSSE3 1
+#        define NFX_SERIALIZATION_CODEC_SSE2 1
+#    elif defined( __SSSE3__ )
+#        include <tmmintrin.h>
+#        define NFX_SERIALIZATION_CODEC_SSSE3 1
+#        define NFX_SERIALIZATION_CODEC_SSE2 1
+#    elif defined( __SSE2__ ) || defined( _M_X64 ) || ( defined( _M_IX86_FP ) && _M_IX86_FP >= 2 )
+#        include <emmintrin.h>
+#        define NFX_SERIALIZATION_CODEC_SSE2 1
+#    endif
+#endif
+
+namespace nfx::serialization::json
+{
+    //=====================================================================
+    // Internal codec kernels
+    //=====================================================================
+
+    namespace detail
+    {
+        //----------------------------------------------
+        // Lookup tables
+        //----------------------------------------------
+
+        /** @brief Base64 alphabet (RFC 4648, section 4) */
+        inline constexpr std::string_view base64Alphabet =
+            "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+
+        /** @brief Lowercase hex digits */
+        inline constexpr std::string_view hexDigits = "0123456789abcdef";
+
+        /**
+         * @brief Build a character-to-value table
+         * @param alphabet Characters in value order
+         * @param foldCase Also map the uppercase form of letters
+         * @return Value of each byte, -1 for characters outside the alphabet
+         */
+        consteval std::array<std::int8_t, 256> codecValues( std::string_view alphabet, bool foldCase )
+        {
+            std::array<std::int8_t, 256> values{};
+            values.fill( -1 );
+            for( std::size_t i = 0; i < alphabet.size(); ++i )
+            {
+                const auto c = static_cast<unsigned char>( alphabet[i] );
+                values[c] = static_cast<std::int8_t>( i );
+                if( foldCase && c >= 'a' && c <= 'z' )
+                {
+                    values[c - 'a' + 'A'] = static_cast<std::int8_t>( i );
+                }
+            }
+            return values;
+        }
+
+        /** @brief Base64 character values */
+        inline constexpr std::array<std::int8_t, 256> base64Values = codecValues( base64Alphabet, false );
+
+        /** @brief Hex digit values, either case */
+        inline constexpr std::array<std::int8_t, 256> hexValues = codecValues( hexDigits, true );
+
+        //----------------------------------------------
+        // Base64 blocks
+        //----------------------------------------------
+
+        /**
+         * @brief Encode whole blocks of bytes as base64
+         * @param in Bytes to encode
+         * @param size Number of bytes
+         * @param out Output buffer
+         * @return Number of bytes consumed (a multiple of 3); the output holds 4 characters per 3
+         * @details Each step loads 4 bytes beyond the 12 (24) it encodes, so the tail of the input is
+         *          left to the scalar loop.
+         */
+        inline std::size_t encodeBase64Blocks(
+            [[maybe_unused]] const unsigned char* in,
+            [[maybe_unused]] std::size_t size,
+            [[maybe_unused]] char* out ) noexcept
+        {
+            std::size_t done = 0;
+
+#if defined( NFX_SERIALIZATION_CODEC_SSSE3 )
+            // Bytes b0 b1 b2 -> 6-bit indices a b c d, one 32-bit lane per group of three:
+            // gather [b1, b0, b2, b1], then move each index into its own byte with two 16-bit multiplies
+            const auto indices128 = []( __m128i bytes ) noexcept {
+                bytes = _mm_shuffle_epi8( bytes, _mm_set_epi8( 10, 11, 9, 10, 7, 8, 6, 7, 4, 5, 3, 4, 1, 2, 0, 1 ) );
+                const __m128i ac = _mm_mulhi_epu16( _mm_and_si128( bytes, _mm_set1_epi32( 0x0fc0fc00 ) ),
+                                                    _mm_set1_epi32( 0x04000040 ) );
+                const __m128i bd = _mm_mullo_epi16( _mm_and_si128( bytes, _mm_set1_epi32( 0x003f03f0 ) ),
+                                                    _mm_set1_epi32( 0x01000010 ) );
+                return _mm_or_si128( ac, bd );
+            };
+
+            // Index -> character: one offset per range, selected with a 16-entry shuffle
+            const auto characters128 = []( __m128i indices ) noexcept {
+                __m128i range = _mm_subs_epu8( indices, _mm_set1_epi8( 51 ) );
+                range = _mm_or_si128(
+                    range, _mm_and_si128( _mm_cmpgt_epi8( _mm_set1_epi8( 26 ), indices ), _mm_set1_epi8( 13 ) ) );
+                const __m128i offsets = _mm_setr_epi8(
+                    'a' - 26, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52,
+                    '0' - 52, '+' - 62, '/' - 63, 'A', 0, 0 );
+                return _mm_add_epi8( indices, _mm_shuffle_epi8( offsets, range ) );
+            };
+#endif
+
+#if defined( NFX_SERIALIZATION_CODEC_AVX2 )
+            for( ; done + 28 <= size; done += 24, out += 32 )
+            {
+                // Two 12-byte groups, one per 128-bit lane
+                const __m128i low = _mm_loadu_si128( reinterpret_cast<const __m128i*>( in + done ) );
+                const __m128i high = _mm_loadu_si128( reinterpret_cast<const __m128i*>( in + done + 12 ) );
+                __m256i bytes = _mm256_inserti128_si256( _mm256_castsi128_si256( low ), high, 1 );
+
+                bytes = _mm256_shuffle_epi8(
+                    bytes,
+                    _mm256_set_epi8( 10, 11, 9, 10, 7, 8, 6, 7, 4, 5, 3, 4, 1, 2, 0, 1,
+                                     10, 11, 9, 10, 7, 8, 6, 7, 4, 5, 3, 4, 1, 2, 0, 1 ) );
+                const __m256i ac = _mm256_mulhi_epu16( _mm256_and_si256( bytes, _mm256_set1_epi32( 0x0fc0fc00 ) ),
+                                                       _mm256_set1_epi32( 0x04000040 ) );
+                const __m256i bd = _mm256_mullo_epi16( _mm256_and_si256( bytes, _mm256_set1_epi32( 0x003f03f0 ) ),
+                                                       _mm256_set1_epi32( 0x01000010 ) );
+                const __m256i indices = _mm256_or_si256( ac, bd );
+
+                __m256i range = _mm256_subs_epu8( indices, _mm256_set1_epi8( 51 ) );
+                range = _mm256_or_si256(
+                    range,
+                    _mm256_and_si256( _mm256_cmpgt_epi8( _mm256_set1_epi8( 26 ), indices ), _mm256_set1_epi8( 13 ) ) );
+                const __m256i offsets = _mm256_setr_epi8(
+                    'a' - 26, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52,
+                    '0' - 52, '+' - 62, '/' - 63, 'A', 0, 0,
+                    'a' - 26, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52,
+                    '0' - 52, '+' - 62, '/' - 63, 'A', 0, 0 );
+                const __m256i characters = _mm256_add_epi8( indices, _mm256_shuffle_epi8( offsets, range ) );
+
+                _mm256_storeu_si256( reinterpret_cast<__m256i*>( out ), characters );
+            }
+#endif
+
+#if defined( NFX_SERIALIZATION_CODEC_SSSE3 )
+            for( ; done + 16 <= size; done += 12, out += 16 )
+            {
+                const __m128i bytes = _mm_loadu_si128( reinterpret_cast<const __m128i*>( in + done ) );
+                _mm_storeu_si128( reinterpret_cast<__m128i*>( out ), characters128( indices128( bytes ) ) );
+            }
+#endif
+
+            return done;
+        }
+
+        /**
+         * @brief Decode whole blocks of base64 characters
+         * @param in Base64 characters, without padding
+         * @param length Number of characters
+         * @param out Output buffer
+         * @param size Size of the output buffer (length * 3 / 4, rounded down)
+         * @return Number of characters consumed (a multiple of 4); the output holds 3 bytes per 4
+         * @details Each step stores 4 bytes beyond the 12 (24) it decodes, overwritten by the next
+         *          step, so the last 4 bytes of the output are left to the scalar loop. Stops before
+         *          a block holding a character outside the alphabet.
+         */
+        inline std::size_t decodeBase64Blocks(
+            [[maybe_unused]] const char* in,
+            [[maybe_unused]] std::size_t length,
+            [[maybe_unused]] unsigned char* out,
+            [[maybe_unused]] std::size_t size ) noexcept
+        {
+            std::size_t done = 0;
+
+#if defined( NFX_SERIALIZATION_CODEC_AVX2 )
+            for( ; done + 32 <= length && done / 4 * 3 + 28 <= size; done += 32 )
+            {
+                const __m256i c = _mm256_loadu_si256( reinterpret_cast<const __m256i*>( in + done ) );
+                const auto between = [&c]( char first, char last ) noexcept {
+                    const __m256i low = _mm256_set1_epi8( static_cast<char>( first - 1 ) );
+                    const __m256i high = _mm256_set1_epi8( static_cast<char>( last + 1 ) );
+                    return _mm256_and_si256( _mm256_cmpgt_epi8( c, low ), _mm256_cmpgt_epi8( high, c ) );
+                };
+                const __m256i upper = between( 'A', 'Z' );
+                const __m256i lower = between( 'a', 'z' );
+                const __m256i digit = between( '0', '9' );
+                const __m256i plus = _mm256_cmpeq_epi8( c, _mm256_set1_epi8( '+' ) );
+                const __m256i slash = _mm256_cmpeq_epi8( c, _mm256_set1_epi8( '/' ) );
+
+                const __m256i valid = _mm256_or_si256( _mm256_or_si256( upper, lower ),
+                                                       _mm256_or_si256( digit, _mm256_or_si256( plus, slash ) ) );
+                if( static_cast<std::uint32_t>( _mm256_movemask_epi8( valid ) ) != 0xffffffffu )
+                {
+                    break;
+                }
+
+                // Character -> 6-bit value: one offset per range
+                __m256i shift = _mm256_and_si256( upper, _mm256_set1_epi8( -65 ) );
+                shift = _mm256_or_si256( shift, _mm256_and_si256( lower, _mm256_set1_epi8( -71 ) ) );
+                shift = _mm256_or_si256( shift, _mm256_and_si256( digit, _mm256_set1_epi8( 4 ) ) );
+                shift = _mm256_or_si256( shift, _mm256_and_si256( plus, _mm256_set1_epi8( 19 ) ) );
+                shift = _mm256_or_si256( shift, _mm256_and_si256( slash, _mm256_set1_epi8( 16 ) ) );
+                const __m256i values = _mm256_add_epi8( c, shift );
+
+                // a b c d -> 24-bit groups (ab << 12 | cd), then 3 big-endian bytes per lane
+                const __m256i pairs = _mm256_maddubs_epi16( values, _mm256_set1_epi32( 0x01400140 ) );
+                const __m256i groups = _mm256_madd_epi16( pairs, _mm256_set1_epi32( 0x00011000 ) );
+                const __m256i bytes = _mm256_shuffle_epi8(
+                    groups,
+                    _mm256_setr_epi8( 2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1,
+                                      2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1 ) );
+
+                unsigned char* target = out + done / 4 * 3;
+                _mm_storeu_si128( reinterpret_cast<__m128i*>( target ), _mm256_castsi256_si128( bytes ) );
+                _mm_storeu_si128( reinterpret_cast<__m128i*>( target + 12 ), _mm256_extracti128_si256( bytes, 1 ) );
+            }
+#endif
+
+#if defined( NFX_SERIALIZATION_CODEC_SSSE3 )
+            for( ; done + 16 <= length && done / 4 * 3 + 16 <= size; done += 16 )
+            {
+                const __m128i c = _mm_loadu_si128( reinterpret_cast<const __m128i*>( in + done ) );
+                const auto between = [&c]( char first, char last ) noexcept {
+                    return _mm_and_si128( _mm_cmpgt_epi8( c, _mm_set1_epi8( static_cast<char>( first - 1 ) ) ),
+                                          _mm_cmplt_epi8( c, _mm_set1_epi8( static_cast<char>( last + 1 ) ) ) );
+                };
+                const __m128i upper = between( 'A', 'Z' );
+                const __m128i lower = between( 'a', 'z' );
+                const __m128i digit = between( '0', '9' );
+                const __m128i plus = _mm_cmpeq_epi8( c, _mm_set1_epi8( '+' ) );
+                const __m128i slash = _mm_cmpeq_epi8( c, _mm_set1_epi8( '/' ) );
+
+                const __m128i valid =
+                    _mm_or_si128( _mm_or_si128( upper, lower ), _mm_or_si128( digit, _mm_or_si128( plus, slash ) ) );
+                if( _mm_movemask_epi8( valid ) != 0xffff )
+                {
+                    break;
+                }
+
+                __m128i shift = _mm_and_si128( upper, _mm_set1_epi8( -65 ) );
+                shift = _mm_or_si128( shift, _mm_and_si128( lower, _mm_set1_epi8( -71 ) ) );
+                shift = _mm_or_si128( shift, _mm_and_si128( digit, _mm_set1_epi8( 4 ) ) );
+                shift = _mm_or_si128( shift, _mm_and_si128( plus, _mm_set1_epi8( 19 ) ) );
+                shift = _mm_or_si128( shift, _mm_and_si128( slash, _mm_set1_epi8( 16 ) ) );
+                const __m128i values = _mm_add_epi8( c, shift );
+
+                const __m128i pairs = _mm_maddubs_epi16( values, _mm_set1_epi32( 0x01400140 ) );
+                const __m128i groups = _mm_madd_epi16( pairs, _mm_set1_epi32( 0x00011000 ) );
+                const __m128i bytes =
+                    _mm_shuffle_epi8( groups, _mm_setr_epi8( 2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1 ) );
+
+                _mm_storeu_si128( reinterpret_cast<__m128i*>( out + done / 4 * 3 ), bytes );
+            }
+#endif
+
+            return done;
+        }
+
+        //----------------------------------------------
+        // Hex blocks
+        //----------------------------------------------
+
+        /**
+         * @brief Encode whole blocks of bytes as hex
+         * @param in Bytes to encode
+         * @param size Number of bytes
+         * @param out Output buffer
+         * @return Number of bytes consumed; the output holds 2 characters per byte
+         */
+        inline std::size_t encodeHexBlocks(
+            [[maybe_unused]] const unsigned char* in,
+            [[maybe_unused]] std::size_t size,
+            [[maybe_unused]] char* out ) noexcept
+        {
+            std::size_t done = 0;
+
+#if defined( NFX_SERIALIZATION_CODEC_AVX2 )
+            for( ; done + 32 <= size; done += 32 )
+            {
+                const __m256i bytes = _mm256_loadu_si256( reinterpret_cast<const __m256i*>( in + done ) );
+                const __m256i nibbleMask = _mm256_set1_epi8( 0x0f );
+                const __m256i high = _mm256_and_si256( _mm256_srli_epi16( bytes, 4 ), nibbleMask );
+                const __m256i low = _mm256_and_si256( bytes, nibbleMask );
+
+                // Digit d -> '0' + d, plus 'a' - '0' - 10 from 10 on
+                const auto digits = []( __m256i nibbles ) noexcept {
+                    const __m256i letters = _mm256_cmpgt_epi8( nibbles, _mm256_set1_epi8( 9 ) );
+                    return _mm256_add_epi8( _mm256_add_epi8( nibbles, _mm256_set1_epi8( '0' ) ),
+                                            _mm256_and_si256( letters, _mm256_set1_epi8( 'a' - '0' - 10 ) ) );
+                };
+
+                // Interleaving works per 128-bit lane: reorder the lanes back into byte order
+                const __m256i first = digits( _mm256_unpacklo_epi8( high, low ) );
+                const __m256i second = digits( _mm256_unpackhi_epi8( high, low ) );
+                _mm256_storeu_si256( reinterpret_cast<__m256i*>( out + done * 2 ),
+                                     _mm256_permute2x128_si256( first, second, 0x20 ) );
+                _mm256_storeu_si256( reinterpret_cast<__m256i*>( out + done * 2 + 32 ),
+                                     _mm256_permute2x128_si256( first, second, 0x31 ) );
+            }
+#endif
+
+#if defined( NFX_SERIALIZATION_CODEC_SSE2 )
+            for( ; done + 16 <= size; done += 16 )
+            {
+                const __m128i bytes = _mm_loadu_si128( reinterpret_cast<const __m128i*>( in + done ) );
+                const __m128i nibbleMask = _mm_set1_epi8( 0x0f );
+                const __m128i high = _mm_and_si128( _mm_srli_epi16( bytes, 4 ), nibbleMask );
+                const __m128i low = _mm_and_si128( bytes, nibbleMask );
+
+                const auto digits = []( __m128i nibbles ) noexcept {
+                    const __m128i letters = _mm_cmpgt_epi8( nibbles, _mm_set1_epi8( 9 ) );
+                    return _mm_add_epi8( _mm_add_epi8( nibbles, _mm_set1_epi8( '0' ) ),
+                                         _mm_and_si128( letters, _mm_set1_epi8( 'a' - '0' - 10 ) ) );
+                };
+
+                _mm_storeu_si128( reinterpret_cast<__m128i*>( out + done * 2 ),
+                                  digits( _mm_unpacklo_epi8( high, low ) ) );
+                _mm_storeu_si128( reinterpret_cast<__m128i*>( out + done * 2 + 16 ),
+                                  digits( _mm_unpackhi_epi8( high, low ) ) );
+            }
+#endif
+
+            return done;
+        }
+
+        /**
+         * @brief Decode whole blocks of hex digits
+         * @param in Hex digits
+         * @param length Number of digits (even)
+         * @param out Output buffer of length / 2 bytes
+         * @return Number of digits consumed
+         * @details Stops before a block holding a non-hex character.
+         */
+        inline std::size_t decodeHexBlocks(
+            [[maybe_unused]] const char* in,
+            [[maybe_unused]] std::size_t length,
+            [[maybe_unused]] unsigned char* out ) noexcept
+        {
+            std::size_t done = 0;
+
+#if defined( NFX_SERIALIZATION_CODEC_AVX2 )
+            for( ; done + 64 <= length; done += 64 )
+            {
+                bool valid = true;
+                const auto nibbles = [&valid]( const char* digits ) noexcept {
+                    const __m256i c = _mm256_loadu_si256( reinterpret_cast<const __m256i*>( digits ) );
+                    const __m256i folded = _mm256_or_si256( c, _mm256_set1_epi8( 0x20 ) );
+                    const __m256i digit =
+                        _mm256_and_si256( _mm256_cmpgt_epi8( c, _mm256_set1_epi8( '0' - 1 ) ),
+                                          _mm256_cmpgt_epi8( _mm256_set1_epi8( '9' + 1 ), c ) );
+                    const __m256i letter =
+                        _mm256_and_si256( _mm256_cmpgt_epi8( folded, _mm256_set1_epi8( 'a' - 1 ) ),
+                                          _mm256_cmpgt_epi8( _mm256_set1_epi8( 'f' + 1 ), folded ) );
+                    valid = valid && static_cast<std::uint32_t>( _mm256_movemask_epi8(
+                                         _mm256_or_si256( digit, letter ) ) ) == 0xffffffffu;
+                    return _mm256_or_si256(
+                        _mm256_and_si256( digit, _mm256_sub_epi8( c, _mm256_set1_epi8( '0' ) ) ),
+                        _mm256_and_si256( letter, _mm256_sub_epi8( folded, _mm256_set1_epi8( 'a' - 10 ) ) ) );
+                };
+                const __m256i first = nibbles( in + done );
+                const __m256i second = nibbles( in + done + 32 );
+                if( !valid )
+                {
+                    break;
+                }
+
+                // 16-bit lanes hold [high, low]: (high << 4) | low in the low byte, then narrow
+                const auto combine = []( __m256i pairs ) noexcept {
+                    const __m256i high = _mm256_and_si256( _mm256_slli_epi16( pairs, 4 ), _mm256_set1_epi16( 0x00f0 ) );
+                    return _mm256_or_si256( high, _mm256_srli_epi16( pairs, 8 ) );
+                };
+                const __m256i packed = _mm256_packus_epi16( combine( first ), combine( second ) );
+                _mm256_storeu_si256( reinterpret_cast<__m256i*>( out + done / 2 ),
+                                     _mm256_permute4x64_epi64( packed, 0xd8 ) );
+            }
+#endif
+
+#if defined( NFX_SERIALIZATION_CODEC_SSE2 )
+            for( ; done + 32 <= length; done += 32 )
+            {
+                bool valid = true;
+                const auto nibbles = [&valid]( const char* digits ) noexcept {
+                    const __m128i c = _mm_loadu_si128( reinterpret_cast<const __m128i*>( digits ) );
+                    const __m128i folded = _mm_or_si128( c, _mm_set1_epi8( 0x20 ) );
+                    const __m128i digit = _mm_and_si128( _mm_cmpgt_epi8( c, _mm_set1_epi8( '0' - 1 ) ),
+                                                         _mm_cmplt_epi8( c, _mm_set1_epi8( '9' + 1 ) ) );
+                    const __m128i letter = _mm_and_si128( _mm_cmpgt_epi8( folded, _mm_set1_epi8( 'a' - 1 ) ),
+                                                          _mm_cmplt_epi8( folded, _mm_set1_epi8( 'f' + 1 ) ) );
+                    valid = valid && _mm_movemask_epi8( _mm_or_si128( digit, letter ) ) == 0xffff;
+                    return _mm_or_si128( _mm_and_si128( digit, _mm_sub_epi8( c, _mm_set1_epi8( '0' ) ) ),
+                                         _mm_and_si128( letter, _mm_sub_epi8( folded, _mm_set1_epi8( 'a' - 10 ) ) ) );
+                };
+                const __m128i first = nibbles( in + done );
+                const __m128i second = nibbles( in + done + 16 );
+                if( !valid )
+                {
+                    break;
+                }
+
+                const auto combine = []( __m128i pairs ) noexcept {
+                    return _mm_or_si128( _mm_and_si128( _mm_slli_epi16( pairs, 4 ), _mm_set1_epi16( 0x00f0 ) ),
+                                         _mm_srli_epi16( pairs, 8 ) );
+                };
+                _mm_storeu_si128( reinterpret_cast<__m128i*>( out + done / 2 ),
+                                  _mm_packus_epi16( combine( first ), combine( second ) ) );
+            }
+#endif
+
+            return done;
+        }
+
+        //----------------------------------------------
+        // Helpers
+        //----------------------------------------------
+
+        /**
+         * @brief Get the number of base64 characters before the padding
+         * @param text Base64 text
+         * @return Length without the trailing '=' of a padded text
+         */
+        inline std::size_t base64DataLength( std::string_view text ) noexcept
+        {
+            std::size_t length = text.size();
+            if( length % 4 == 0 && length > 0 && text[length - 1] == '=' )
+            {
+                length -= text[length - 2] == '=' ? 2 : 1;
+            }
+            return length;
+        }
+    } // namespace detail
+
+    //=====================================================================
+    // Base64
+    //=====================================================================
+
+    inline std::optional<std::size_t> base64DecodedLength( std::string_view text ) noexcept
+    {
+        const std::size_t length = detail::base64DataLength( text );
+        if( length % 4 == 1 )
+        {
+            return std::nullopt;
+        }
+        return length / 4 * 3 + ( length % 4 == 0 ? 0 : length % 4 - 1 );
+    }
+
+    inline void encodeBase64( std::span<const std::byte> bytes, char* out ) noexcept
+    {
+        const auto* in = reinterpret_cast<const unsigned char*>( bytes.data() );
+        const std::size_t size = bytes.size();
+        const auto alphabet = detail::base64Alphabet;
+
+        std::size_t i = detail::encodeBase64Blocks( in, size, out );
+        out += i / 3 * 4;
+
+        for( ; i + 3 <= size; i += 3, out += 4 )
+        {
+            const std::uint32_t group =
+                ( std::uint32_t{ in[i] } << 16 ) | ( std::uint32_t{ in[i + 1] } << 8 ) | std::uint32_t{ in[i + 2] };
+            out[0] = alphabet[group >> 18];
+            out[1] = alphabet[( group >> 12 ) & 0x3f];
+            out[2] = alphabet[( group >> 6 ) & 0x3f];
+            out[3] = alphabet[group & 0x3f];
+        }
+
+        if( i < size )
+        {
+            // One or two bytes left: two or three characters, padded to four
+            const std::uint32_t group =
+                ( std::uint32_t{ in[i] } << 16 ) | ( i + 1 < size ? std::uint32_t{ in[i + 1] } << 8 : 0 );
+            out[0] = alphabet[group >> 18];
+            out[1] = alphabet[( group >> 12 ) & 0x3f];
+            out[2] = i + 1 < size ? alphabet[( group >> 6 ) & 0x3f] : '=';
+            out[3] = '=';
+        }
+    }
+
+    inline std::string encodeBase64( std::span<const std::byte> bytes )
+    {
+        std::string text( base64EncodedLength( bytes.size() ), '\0' );
+        encodeBase64( bytes, text.data() );
+        return text;
+    }
+
+    inline bool decodeBase64( std::string_view text, std::span<std::byte> out ) noexcept
+    {
+        const auto size = base64DecodedLength( text );
+        if( !size || *size != out.size() )
+        {
+            return false;
+        }
+
+        const char* in = text.data();
+        const std::size_t length = detail::base64DataLength( text );
+        auto* target = reinterpret_cast<unsigned char*>( out.data() );
+        const auto value = [in]( std::size_t at ) -> std::int32_t {
+            return detail::base64Values[static_cast<unsigned char>( in[at] )];
+        };
+
+        std::size_t i = detail::decodeBase64Blocks( in, length, target, out.size() );
+        target += i / 4 * 3;
+
+        for( ; i + 4 <= length; i += 4, target += 3 )
+        {
+            const std::int32_t a = value( i );
+            const std::int32_t b = value( i + 1 );
+            const std::int32_t c = value( i + 2 );
+            const std::int32_t d = value( i + 3 );
+            if( ( a | b | c | d ) < 0 )
+            {
+                return false;
+            }
+            const auto group = static_cast<std::uint32_t>( ( a << 18 ) | ( b << 12 ) | ( c << 6 ) | d );
+            target[0] = static_cast<unsigned char>( group >> 16 );
+            target[1] = static_cast<unsigned char>( group >> 8 );
+            target[2] = static_cast<unsigned char>( group );
+        }
+
+        // Two or three characters left: one or two bytes, the unused low bits must be zero
+        const std::size_t rest = length - i;
+        if( rest >= 2 )
+        {
+            const std::int32_t a = value( i );
+            const std::int32_t b = value( i + 1 );
+            const std::int32_t c = rest == 3 ? value( i + 2 ) : 0;
+            if( ( a | b | c ) < 0 || ( rest == 2 ? b & 0x0f : c & 0x03 ) != 0 )
+            {
+                return false;
+            }
+            target[0] = static_cast<unsigned char>( ( a << 2 ) | ( b >> 4 ) );
+            if( rest == 3 )
+            {
+                target[1] = static_cast<unsigned char>( ( ( b & 0x0f ) << 4 ) | ( c >> 2 ) );
+            }
+        }
+        return true;
+    }
+
+    //=====================================================================
+    // Hex
+    //=====================================================================
+
+    inline std::optional<std::size_t> hexDecodedLength( std::string_view text ) noexcept
+    {
+        if( text.size() % 2 != 0 )
+        {
+            return std::nullopt;
+        }
+        return text.size() / 2;
+    }
+
+    inline void encodeHex( std::span<const std::byte> bytes, char* out ) noexcept
+    {
+        const auto* in = reinterpret_cast<const unsigned char*>( bytes.data() );
+        const std::size_t size = bytes.size();
+
+        for( std::size_t i = detail::encodeHexBlocks( in, size, out ); i < size; ++i )
+        {
+            out[i * 2] = detail::hexDigits[in[i] >> 4];
+            out[i * 2 + 1] = detail::hexDigits[in[i] & 0x0f];
+        }
+    }
+
+    inline std::string encodeHex( std::span<const std::byte> bytes )
+    {
+        std::string text( hexEncodedLength( bytes.size() ), '\0' );
+        encodeHex( bytes, text.data() );
+        return text;
+    }
+
+    inline bool decodeHex( std::string_view text, std::span<std::byte> out ) noexcept
+    {
+        const auto size = hexDecodedLength( text );
+        if( !size || *size != out.size() )
+        {
+            return false;
+        }
+
+        const char* in = text.data();
+        auto* target = reinterpret_cast<unsigned char*>( out.data() );
+
+        for( std::size_t i = detail::decodeHexBlocks( in, text.size(), target ); i < text.size(); i += 2 )
+        {
+            const std::int32_t high = detail::hexValues[static_cast<unsigned char>( in[i] )];
+            const std::int32_t low = detail::hexValues[static_cast<unsigned char>( in[i + 1] )];
+            if( ( high | low ) < 0 )
+            {
+                return false;
+            }
+            target[i / 2] = static_cast<unsigned char>( ( high << 4 ) | low );
+        }
+        return true;
+    }
+} // namespace nfx::serialization::json
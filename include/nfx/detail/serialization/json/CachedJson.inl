@@ -0,0 +1,212 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2026 nfx
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * @file CachedJson.inl
+ * @brief Cached JSON fragment wrapper implementation file
+ */
+
+namespace nfx::serialization::json
+{
+    //=====================================================================
+    // CachedJson class
+    //=====================================================================
+
+    //----------------------------------------------
+    // Construction
+    //----------------------------------------------
+
+    template <typename T>
+    inline CachedJson<T>::CachedJson( T value )
+        : m_value{ std::move( value ) }
+    {
+    }
+
+    template <typename T>
+    inline CachedJson<T>::CachedJson( const CachedJson& other )
+        : m_value{ other.m_value },
+          m_version{ other.m_version }
+    {
+    }
+
+    template <typename T>
+    inline CachedJson<T>::CachedJson( CachedJson&& other ) noexcept
+        : m_value{ std::move( other.m_value ) },
+          m_version{ other.m_version },
+          m_fragments{ other.m_fragments.exchange( nullptr, std::memory_order_relaxed ) }
+    {
+        ++other.m_version;
+    }
+
+    template <typename T>
+    inline CachedJson<T>::~CachedJson()
+    {
+        release();
+    }
+
+    //----------------------------------------------
+    // Assignment
+    //----------------------------------------------
+
+    template <typename T>
+    inline CachedJson<T>& CachedJson<T>::operator=( const CachedJson& other )
+    {
+        if( this != &other )
+        {
+            set( other.m_value );
+        }
+        return *this;
+    }
+
+    template <typename T>
+    inline CachedJson<T>& CachedJson<T>::operator=( CachedJson&& other ) noexcept
+    {
+        if( this != &other )
+        {
+            release();
+            m_value = std::move( other.m_value );
+            ++m_version;
+            m_fragments.store( other.m_fragments.exchange( nullptr, std::memory_order_relaxed ),
+                               std::memory_order_relaxed );
+            ++other.m_version;
+        }
+        return *this;
+    }
+
+    //----------------------------------------------
+    // Accessors
+    //----------------------------------------------
+
+    template <typename T>
+    inline const T& CachedJson<T>::value() const noexcept
+    {
+        return m_value;
+    }
+
+    template <typename T>
+    inline const T& CachedJson<T>::operator*() const noexcept
+    {
+        return m_value;
+    }
+
+    template <typename T>
+    inline const T* CachedJson<T>::operator->() const noexcept
+    {
+        return &m_value;
+    }
+
+    template <typename T>
+    inline std::uint64_t CachedJson<T>::version() const noexcept
+    {
+        return m_version;
+    }
+
+    //----------------------------------------------
+    // Modification
+    //----------------------------------------------
+
+    template <typename T>
+    inline void CachedJson<T>::set( T value )
+    {
+        m_value = std::move( value );
+        invalidate();
+    }
+
+    template <typename T>
+    template <typename F>
+    inline decltype( auto ) CachedJson<T>::modify( F&& mutator )
+    {
+        // Invalidate first: a throwing mutator may already have changed the value
+        invalidate();
+        return std::forward<F>( mutator )( m_value );
+    }
+
+    template <typename T>
+    inline void CachedJson<T>::invalidate() noexcept
+    {
+        release();
+        ++m_version;
+    }
+
+    //----------------------------------------------
+    // Fragment cache
+    //----------------------------------------------
+
+    template <typename T>
+    template <typename Render>
+    inline std::string_view CachedJson<T>::fragment( std::uint64_t format, Render&& render ) const
+    {
+        const Fragment* head = m_fragments.load( std::memory_order_acquire );
+        if( const std::string* cached = findFragment( head, nullptr, format ) )
+        {
+            return *cached;
+        }
+
+        auto* rendered = new Fragment{ format, std::forward<Render>( render )(), head };
+        while( !m_fragments.compare_exchange_weak(
+            head, rendered, std::memory_order_acq_rel, std::memory_order_acquire ) )
+        {
+            // Only fragments pushed since the last look can hold the same format
+            if( const std::string* cached = findFragment( head, rendered->next, format ) )
+            {
+                delete rendered;
+                return *cached;
+            }
+            rendered->next = head;
+        }
+
+        return rendered->json;
+    }
+
+    template <typename T>
+    inline const std::string* CachedJson<T>::cachedFragment( std::uint64_t format ) const noexcept
+    {
+        return findFragment( m_fragments.load( std::memory_order_acquire ), nullptr, format );
+    }
+
+    template <typename T>
+    inline const std::string* CachedJson<T>::findFragment(
+        const Fragment* first, const Fragment* last, std::uint64_t format ) noexcept
+    {
+        for( const Fragment* fragment = first; fragment != last; fragment = fragment->next )
+        {
+            if( fragment->format == format )
+            {
+                return &fragment->json;
+            }
+        }
+        return nullptr;
+    }
+
+    template <typename T>
+    inline void CachedJson<T>::release() noexcept
+    {
+        const Fragment* fragment = m_fragments.exchange( nullptr, std::memory_order_relaxed );
+        while( fragment )
+        {
+            delete std::exchange( fragment, fragment->next );
+        }
+    }
+
+} // namespace nfx::serialization::json
@@ -0,0 +1,220 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2026 nfx
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+/**
+ * @file DeserializeError.inl
+ * @brief Deserialization error and result implementation file
+ */
+
+namespace nfx::serialization::json
+{
+    //=====================================================================
+    // ErrorCode enumeration
+    //=====================================================================
+
+    inline constexpr std::string_view errorMessage( ErrorCode code ) noexcept
+    {
+        switch( code )
+        {
+            case ErrorCode::None:
+            {
+                return "No error";
+            }
+            case ErrorCode::InvalidJson:
+            {
+                return "Invalid JSON";
+            }
+            case ErrorCode::TypeMismatch:
+            {
+                return "JSON value has the wrong type";
+            }
+            case ErrorCode::OutOfRange:
+            {
+                return "Number is out of range for the target type";
+            }
+            case ErrorCode::SizeMismatch:
+            {
+                return "JSON array has the wrong number of elements";
+            }
+            case ErrorCode::MissingField:
+            {
+                return "Required field is missing";
+            }
+            case ErrorCode::InvalidFormat:
+            {
+                return "String value has an invalid format";
+            }
+            case ErrorCode::UnknownVariantTag:
+            {
+                return "Unknown variant tag";
+            }
+            case ErrorCode::NoMatchingAlternative:
+            {
+                return "No variant alternative matches the JSON value";
+            }
+            case ErrorCode::BorrowFailed:
+            {
+                return "String cannot be borrowed as std::string_view";
+            }
+            case ErrorCode::SchemaViolation:
+            {
+                return "JSON value violates the schema of the target type";
+            }
+            case ErrorCode::UnresolvedReference:
+            {
+                return "Shared reference names no preceding object of the target type";
+            }
+            case ErrorCode::Custom:
+            {
+                return "Custom deserialization failed";
+            }
+        }
+
+        return "Unknown error";
+    }
+
+    //=====================================================================
+    // DeserializeError class
+    //=====================================================================
+
+    //----------------------------------------------
+    // Construction
+    //----------------------------------------------
+
+    inline DeserializeError::DeserializeError( ErrorCode code, std::string path, std::size_t offset ) noexcept
+        : m_code{ code },
+          m_path{ std::move( path ) },
+          m_offset{ offset }
+    {
+    }
+
+    //----------------------------------------------
+    // Accessors
+    //----------------------------------------------
+
+    inline ErrorCode DeserializeError::code() const noexcept
+    {
+        return m_code;
+    }
+
+    inline const std::string& DeserializeError::path() const noexcept
+    {
+        return m_path;
+    }
+
+    inline std::size_t DeserializeError::offset() const noexcept
+    {
+        return m_offset;
+    }
+
+    inline std::string_view DeserializeError::message() const noexcept
+    {
+        return errorMessage( m_code );
+    }
+
+    //=====================================================================
+    // DeserializeResult class
+    //=====================================================================
+
+    //----------------------------------------------
+    // Construction
+    //----------------------------------------------
+
+    template <typename T>
+    inline DeserializeResult<T>::DeserializeResult( T value )
+        : m_storage{ std::in_place_index<0>, std::move( value ) }
+    {
+    }
+
+    template <typename T>
+    inline DeserializeResult<T>::DeserializeResult( DeserializeError error ) noexcept
+        : m_storage{ std::in_place_index<1>, std::move( error ) }
+    {
+    }
+
+    //----------------------------------------------
+    // Accessors
+    //----------------------------------------------
+
+    template <typename T>
+    inline bool DeserializeResult<T>::hasValue() const noexcept
+    {
+        return m_storage.index() == 0;
+    }
+
+    template <typename T>
+    inline DeserializeResult<T>::operator bool() const noexcept
+    {
+        return hasValue();
+    }
+
+    template <typename T>
+    inline T& DeserializeResult<T>::value() & noexcept
+    {
+        return *std::get_if<0>( &m_storage );
+    }
+
+    template <typename T>
+    inline const T& DeserializeResult<T>::value() const& noexcept
+    {
+        return *std::get_if<0>( &m_storage );
+    }
+
+    template <typename T>
+    inline T&& DeserializeResult<T>::value() && noexcept
+    {
+        return std::move( *std::get_if<0>( &m_storage ) );
+    }
+
+    template <typename T>
+    inline T& DeserializeResult<T>::operator*() & noexcept
+    {
+        return value();
+    }
+
+    template <typename T>
+    inline const T& DeserializeResult<T>::operator*() const& noexcept
+    {
+        return value();
+    }
+
+    template <typename T>
+    inline T* DeserializeResult<T>::operator->() noexcept
+    {
+        return std::get_if<0>( &m_storage );
+    }
+
+    template <typename T>
+    inline const T* DeserializeResult<T>::operator->() const noexcept
+    {
+        return std::get_if<0>( &m_storage );
+    }
+
+    template <typename T>
+    inline const DeserializeError& DeserializeResult<T>::error() const noexcept
+    {
+        return *std::get_if<1>( &m_storage );
+    }
+} // namespace nfx::serialization::json
@@ -0,0 +1,708 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2026 nfx
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * @file Scanner.inl
+ * @brief Structural JSON scanner implementation file
+ * @details Contains the block classification kernels (AVX2, SSE2 and scalar fallback)
+ *          and the Scanner method implementations.
+ */
+
+#include <bit>
+#include <cstring>
+
+#if !defined( NFX_SERIALIZATION_DISABLE_SIMD )
+#    if defined( __AVX2__ )
+#        include <immintrin.h>
+#        define NFX_SERIALIZATION_SCANNER_AVX2 1
+#    elif defined( __SSE2__ ) || defined( _M_X64 ) || ( defined( _M_IX86_FP ) && _M_IX86_FP >= 2 )
+#        include <emmintrin.h>
+#        define NFX_SERIALIZATION_SCANNER_SSE2 1
+#    endif
+#endif
+
+namespace nfx::serialization::json
+{
+    //=====================================================================
+    // Internal block classification
+    //=====================================================================
+
+    namespace detail
+    {
+        /** @brief Size of a classification block in bytes (one bit per byte in a 64-bit mask) */
+        inline constexpr std::size_t scannerBlockSize = 64;
+
+        /**
+         * @brief Bitmasks describing one 64-byte block of JSON text
+         * @details Bit i is set when byte i of the block matches the class.
+         */
+        struct BlockMasks
+        {
+            std::uint64_t quote;     ///< '"' characters
+            std::uint64_t backslash; ///< '\\' characters
+            std::uint64_t open;      ///< '{' and '[' characters
+            std::uint64_t close;     ///< '}' and ']' characters
+        };
+
+        /**
+         * @brief Classify 64 bytes of JSON text
+         * @param block Pointer to at least 64 readable bytes
+         * @return Quote, backslash and bracket bitmasks
+         * @details '{'/'[' and '}'/']' differ only in bit 0x20, so each bracket pair is
+         *          matched with a single compare after folding that bit.
+         */
+        inline BlockMasks classifyBlock( const char* block ) noexcept
+        {
+#if defined( NFX_SERIALIZATION_SCANNER_AVX2 )
+            const __m256i lo = _mm256_loadu_si256( reinterpret_cast<const __m256i*>( block ) );
+            const __m256i hi = _mm256_loadu_si256( reinterpret_cast<const __m256i*>( block + 32 ) );
+            const __m256i foldedLo = _mm256_or_si256( lo, _mm256_set1_epi8( 0x20 ) );
+            const __m256i foldedHi = _mm256_or_si256( hi, _mm256_set1_epi8( 0x20 ) );
+
+            const auto mask = []( __m256i a, __m256i b, char c ) noexcept -> std::uint64_t {
+                const __m256i needle = _mm256_set1_epi8( c );
+                const auto low = static_cast<std::uint32_t>( _mm256_movemask_epi8( _mm256_cmpeq_epi8( a, needle ) ) );
+                const auto high = static_cast<std::uint32_t>( _mm256_movemask_epi8( _mm256_cmpeq_epi8( b, needle ) ) );
+                return static_cast<std::uint64_t>( low ) | ( static_cast<std::uint64_t>( high ) << 32 );
+            };
+
+            return BlockMasks{ mask( lo, hi, '"' ), mask( lo, hi, '\\' ), mask( foldedLo, foldedHi, '{' ),
+                               mask( foldedLo, foldedHi, '}' ) };
+#elif defined( NFX_SERIALIZATION_SCANNER_SSE2 )
+            __m128i chunks[4];
+            __m128i folded[4];
+            for( std::size_t i = 0; i < 4; ++i )
+            {
+                chunks[i] = _mm_loadu_si128( reinterpret_cast<const __m128i*>( block + i * 16 ) );
+                folded[i] = _mm_or_si128( chunks[i], _mm_set1_epi8( 0x20 ) );
+            }
+
+            const auto mask = []( const __m128i( &v )[4], char c ) noexcept -> std::uint64_t {
+                const __m128i needle = _mm_set1_epi8( c );
+                std::uint64_t result = 0;
+                for( std::size_t i = 0; i < 4; ++i )
+                {
+                    const auto bits = static_cast<std::uint16_t>( _mm_movemask_epi8( _mm_cmpeq_epi8( v[i], needle ) ) );
+                    result |= static_cast<std::uint64_t>( bits ) << ( i * 16 );
+                }
+                return result;
+            };
+
+            return BlockMasks{ mask( chunks, '"' ), mask( chunks, '\\' ), mask( folded, '{' ), mask( folded, '}' ) };
+#else
+            BlockMasks masks{ 0, 0, 0, 0 };
+            for( std::size_t i = 0; i < scannerBlockSize; ++i )
+            {
+                const auto c = static_cast<unsigned char>( block[i] );
+                const std::uint64_t bit = std::uint64_t{ 1 } << i;
+                const auto folded = static_cast<unsigned char>( c | 0x20 );
+                masks.quote |= c == '"' ? bit : 0;
+                masks.backslash |= c == '\\' ? bit : 0;
+                masks.open |= folded == '{' ? bit : 0;
+                masks.close |= folded == '}' ? bit : 0;
+            }
+            return masks;
+#endif
+        }
+
+        /**
+         * @brief Compute the mask of characters escaped by a preceding backslash
+         * @param backslash Backslash mask of the block
+         * @param carry In: 1 if the first byte of the block is escaped. Out: same for the next block
+         * @return Mask of escaped characters
+         * @details Only odd-length backslash runs escape the following character; the run parity is
+         *          resolved for the whole block with one subtraction against the odd bit positions.
+         */
+        inline std::uint64_t escapedMask( std::uint64_t backslash, std::uint64_t& carry ) noexcept
+        {
+            if( backslash == 0 )
+            {
+                const std::uint64_t escaped = carry;
+                carry = 0;
+                return escaped;
+            }
+
+            constexpr std::uint64_t oddBits = 0xAAAAAAAAAAAAAAAAULL;
+
+            const std::uint64_t potentialEscape = backslash & ~carry;
+            const std::uint64_t maybeEscaped = potentialEscape << 1;
+            const std::uint64_t escapeAndTerminal = ( ( maybeEscaped | oddBits ) - potentialEscape ) ^ oddBits;
+            const std::uint64_t escaped = escapeAndTerminal ^ ( backslash | carry );
+            carry = ( escapeAndTerminal & backslash ) >> 63;
+
+            return escaped;
+        }
+
+        /**
+         * @brief Inclusive prefix XOR over the bits of a mask
+         * @param bits Unescaped quote mask
+         * @return Mask with bits set from each opening quote up to (excluding) its closing quote
+         */
+        inline constexpr std::uint64_t prefixXor( std::uint64_t bits ) noexcept
+        {
+            bits ^= bits << 1;
+            bits ^= bits << 2;
+            bits ^= bits << 4;
+            bits ^= bits << 8;
+            bits ^= bits << 16;
+            bits ^= bits << 32;
+            return bits;
+        }
+
+        /**
+         * @brief Get a pointer to 64 readable bytes starting at pos
+         * @param json Source text
+         * @param pos Block start offset (must be < json.size())
+         * @param padding Scratch buffer used when fewer than 64 bytes remain
+         * @return Pointer into the source, or to the space-padded scratch copy of the tail
+         */
+        inline const char* loadBlock(
+            std::string_view json, std::size_t pos, char ( &padding )[scannerBlockSize] ) noexcept
+        {
+            const std::size_t remaining = json.size() - pos;
+            if( remaining >= scannerBlockSize )
+            {
+                return json.data() + pos;
+            }
+
+            std::memset( padding, ' ', scannerBlockSize );
+            std::memcpy( padding, json.data() + pos, remaining );
+            return padding;
+        }
+
+        /**
+         * @brief Check whether a byte terminates a scalar literal (number, true, false, null)
+         * @param c Byte to check
+         * @return True for structural characters and whitespace
+         */
+        inline constexpr bool isScalarDelimiter( char c ) noexcept
+        {
+            return c == ',' || c == '}' || c == ']' || c == ' ' || c == '\n' || c == '\r' || c == '\t';
+        }
+
+        /**
+         * @brief Encode a Unicode code point as UTF-8
+         * @param codePoint Code point to encode
+         * @param out Destination of at least 4 bytes
+         * @return Number of bytes written
+         */
+        inline std::size_t encodeUtf8( std::uint32_t codePoint, char* out ) noexcept
+        {
+            if( codePoint < 0x80 )
+            {
+                out[0] = static_cast<char>( codePoint );
+                return 1;
+            }
+            if( codePoint < 0x800 )
+            {
+                out[0] = static_cast<char>( 0xC0 | ( codePoint >> 6 ) );
+                out[1] = static_cast<char>( 0x80 | ( codePoint & 0x3F ) );
+                return 2;
+            }
+            if( codePoint < 0x10000 )
+            {
+                out[0] = static_cast<char>( 0xE0 | ( codePoint >> 12 ) );
+                out[1] = static_cast<char>( 0x80 | ( ( codePoint >> 6 ) & 0x3F ) );
+                out[2] = static_cast<char>( 0x80 | ( codePoint & 0x3F ) );
+                return 3;
+            }
+
+            out[0] = static_cast<char>( 0xF0 | ( codePoint >> 18 ) );
+            out[1] = static_cast<char>( 0x80 | ( ( codePoint >> 12 ) & 0x3F ) );
+            out[2] = static_cast<char>( 0x80 | ( ( codePoint >> 6 ) & 0x3F ) );
+            out[3] = static_cast<char>( 0x80 | ( codePoint & 0x3F ) );
+            return 4;
+        }
+
+        /**
+         * @brief Parse the four hex digits of a \\u escape
+         * @param raw String contents
+         * @param pos Offset of the first digit
+         * @param value Parsed code unit
+         * @return False if fewer than four hex digits follow
+         */
+        inline bool parseHex4( std::string_view raw, std::size_t pos, std::uint32_t& value ) noexcept
+        {
+            if( pos + 4 > raw.size() )
+            {
+                return false;
+            }
+
+            value = 0;
+            for( std::size_t i = pos; i < pos + 4; ++i )
+            {
+                const char c = raw[i];
+                value <<= 4;
+                if( c >= '0' && c <= '9' )
+                    value |= static_cast<std::uint32_t>( c - '0' );
+                else if( c >= 'a' && c <= 'f' )
+                    value |= static_cast<std::uint32_t>( c - 'a' + 10 );
+                else if( c >= 'A' && c <= 'F' )
+                    value |= static_cast<std::uint32_t>( c - 'A' + 10 );
+                else
+                    return false;
+            }
+            return true;
+        }
+
+        /**
+         * @brief Decode the next character of a JSON string literal
+         * @param raw String contents between the quotes, escapes not decoded
+         * @param pos In: offset of a byte or escape sequence. Out: offset past it
+         * @param out Receives the decoded UTF-8 bytes
+         * @return Number of bytes written (1 to 4), or 0 if the escape sequence is malformed
+         */
+        inline std::size_t decodeJsonChar( std::string_view raw, std::size_t& pos, char ( &out )[4] ) noexcept
+        {
+            if( raw[pos] != '\\' )
+            {
+                out[0] = raw[pos++];
+                return 1;
+            }
+
+            if( pos + 1 >= raw.size() )
+            {
+                return 0;
+            }
+
+            const char escape = raw[pos + 1];
+            pos += 2;
+            switch( escape )
+            {
+                case '"':
+                case '\\':
+                case '/':
+                    out[0] = escape;
+                    return 1;
+                case 'b':
+                    out[0] = '\b';
+                    return 1;
+                case 'f':
+                    out[0] = '\f';
+                    return 1;
+                case 'n':
+                    out[0] = '\n';
+                    return 1;
+                case 'r':
+                    out[0] = '\r';
+                    return 1;
+                case 't':
+                    out[0] = '\t';
+                    return 1;
+                case 'u':
+                {
+                    std::uint32_t codePoint = 0;
+                    if( !parseHex4( raw, pos, codePoint ) )
+                    {
+                        return 0;
+                    }
+                    pos += 4;
+
+                    // Combine UTF-16 surrogate pairs
+                    if( codePoint >= 0xD800 && codePoint < 0xDC00 && pos + 1 < raw.size() && raw[pos] == '\\' &&
+                        raw[pos + 1] == 'u' )
+                    {
+                        std::uint32_t low = 0;
+                        if( parseHex4( raw, pos + 2, low ) && low >= 0xDC00 && low < 0xE000 )
+                        {
+                            codePoint = 0x10000 + ( ( codePoint - 0xD800 ) << 10 ) + ( low - 0xDC00 );
+                            pos += 6;
+                        }
+                    }
+                    return encodeUtf8( codePoint, out );
+                }
+                default:
+                    return 0;
+            }
+        }
+
+        /**
+         * @brief Compare a raw object key against a decoded name
+         * @param rawKey Key contents between the quotes (JSON escapes not decoded)
+         * @param name Decoded member name
+         * @return True if the key decodes to name
+         */
+        inline bool keyEquals( std::string_view rawKey, std::string_view name ) noexcept
+        {
+            if( rawKey.find( '\\' ) == std::string_view::npos )
+            {
+                return rawKey == name;
+            }
+
+            char decoded[4];
+            std::size_t keyPos = 0;
+            std::size_t namePos = 0;
+            while( keyPos < rawKey.size() )
+            {
+                const std::size_t size = decodeJsonChar( rawKey, keyPos, decoded );
+                if( size == 0 || name.size() - namePos < size || name.compare( namePos, size, decoded, size ) != 0 )
+                {
+                    return false;
+                }
+                namePos += size;
+            }
+
+            return namePos == name.size();
+        }
+
+        /**
+         * @brief Compare a raw object key against a JSON Pointer reference token
+         * @param rawKey Key contents between the quotes (JSON escapes not decoded)
+         * @param token Reference token (RFC 6901 escapes "~0" and "~1" not decoded)
+         * @return True if both denote the same member name
+         * @details Both sides are decoded one character at a time, so nothing is allocated.
+         */
+        inline bool keyMatchesToken( std::string_view rawKey, std::string_view token ) noexcept
+        {
+            // Fast path: neither side carries escapes, compare raw bytes
+            if( rawKey.find( '\\' ) == std::string_view::npos && token.find( '~' ) == std::string_view::npos )
+            {
+                return rawKey == token;
+            }
+
+            char decoded[4];
+            std::size_t decodedSize = 0;
+            std::size_t decodedPos = 0;
+            std::size_t keyPos = 0;
+
+            for( std::size_t i = 0; i < token.size(); ++i )
+            {
+                char expected = token[i];
+                if( expected == '~' && i + 1 < token.size() && ( token[i + 1] == '0' || token[i + 1] == '1' ) )
+                {
+                    expected = token[++i] == '0' ? '~' : '/';
+                }
+
+                if( decodedPos == decodedSize )
+                {
+                    if( keyPos >= rawKey.size() )
+                    {
+                        return false;
+                    }
+                    decodedSize = decodeJsonChar( rawKey, keyPos, decoded );
+                    decodedPos = 0;
+                    if( decodedSize == 0 )
+                    {
+                        return false;
+                    }
+                }
+
+                if( decoded[decodedPos++] != expected )
+                {
+                    return false;
+                }
+            }
+
+            return decodedPos == decodedSize && keyPos == rawKey.size();
+        }
+    } // namespace detail
+
+    //=====================================================================
+    // Scanner class
+    //=====================================================================
+
+    //----------------------------------------------
+    // Construction
+    //----------------------------------------------
+
+    inline Scanner::Scanner( std::string_view json ) noexcept
+        : m_json{ json }
+    {
+    }
+
+    //----------------------------------------------
+    // Scanning
+    //----------------------------------------------
+
+    inline std::size_t Scanner::skipWhitespace( std::size_t pos ) const noexcept
+    {
+        while( pos < m_json.size() &&
+               ( m_json[pos] == ' ' || m_json[pos] == '\n' || m_json[pos] == '\r' || m_json[pos] == '\t' ) )
+        {
+            ++pos;
+        }
+        return pos;
+    }
+
+    inline std::size_t Scanner::skipValue( std::size_t pos ) noexcept
+    {
+        pos = skipWhitespace( pos );
+        const std::size_t end = valueEnd( pos );
+        if( end != std::string_view::npos )
+        {
+            m_bytesSkipped += end - pos;
+        }
+        return end;
+    }
+
+    inline std::optional<std::string_view> Scanner::locate( std::string_view pointer ) noexcept
+    {
+        if( !pointer.empty() && pointer.front() != '/' )
+        {
+            return std::nullopt;
+        }
+
+        std::size_t pos = skipWhitespace( 0 );
+        std::size_t tokenStart = 1;
+
+        while( tokenStart <= pointer.size() && !pointer.empty() )
+        {
+            const std::size_t tokenEnd = std::min( pointer.find( '/', tokenStart ), pointer.size() );
+            const std::string_view token = pointer.substr( tokenStart, tokenEnd - tokenStart );
+            tokenStart = tokenEnd + 1;
+
+            if( pos >= m_json.size() )
+            {
+                return std::nullopt;
+            }
+
+            if( m_json[pos] == '{' )
+            {
+                // Walk members, skipping every value whose key does not match
+                bool found = false;
+                pos = skipWhitespace( pos + 1 );
+                while( pos < m_json.size() && m_json[pos] == '"' )
+                {
+                    const std::size_t keyEnd = skipString( pos );
+                    if( keyEnd == std::string_view::npos )
+                    {
+                        return std::nullopt;
+                    }
+                    const std::string_view rawKey = m_json.substr( pos + 1, keyEnd - pos - 2 );
+
+                    pos = skipWhitespace( keyEnd );
+                    if( pos >= m_json.size() || m_json[pos] != ':' )
+                    {
+                        return std::nullopt;
+                    }
+                    pos = skipWhitespace( pos + 1 );
+
+                    if( detail::keyMatchesToken( rawKey, token ) )
+                    {
+                        found = true;
+                        break;
+                    }
+
+                    pos = skipValue( pos );
+                    if( pos == std::string_view::npos )
+                    {
+                        return std::nullopt;
+                    }
+
+                    pos = skipWhitespace( pos );
+                    if( pos >= m_json.size() || m_json[pos] != ',' )
+                    {
+                        break;
+                    }
+                    pos = skipWhitespace( pos + 1 );
+                }
+
+                if( !found )
+                {
+                    return std::nullopt;
+                }
+            }
+            else if( m_json[pos] == '[' )
+            {
+                // Array index: decimal digits without leading zeros
+                if( token.empty() || ( token.size() > 1 && token.front() == '0' ) )
+                {
+                    return std::nullopt;
+                }
+
+                std::size_t index = 0;
+                for( const char c : token )
+                {
+                    if( c < '0' || c > '9' )
+                    {
+                        return std::nullopt;
+                    }
+                    index = index * 10 + static_cast<std::size_t>( c - '0' );
+                }
+
+                pos = skipWhitespace( pos + 1 );
+                if( pos >= m_json.size() || m_json[pos] == ']' )
+                {
+                    return std::nullopt;
+                }
+
+                for( std::size_t i = 0; i < index; ++i )
+                {
+                    pos = skipValue( pos );
+                    if( pos == std::string_view::npos )
+                    {
+                        return std::nullopt;
+                    }
+
+                    pos = skipWhitespace( pos );
+                    if( pos >= m_json.size() || m_json[pos] != ',' )
+                    {
+                        return std::nullopt;
+                    }
+                    pos = skipWhitespace( pos + 1 );
+                }
+            }
+            else
+            {
+                return std::nullopt;
+            }
+        }
+
+        const std::size_t end = valueEnd( pos );
+        if( end == std::string_view::npos )
+        {
+            return std::nullopt;
+        }
+
+        m_bytesDecoded += end - pos;
+        return m_json.substr( pos, end - pos );
+    }
+
+    //----------------------------------------------
+    // Accessors
+    //----------------------------------------------
+
+    inline std::string_view Scanner::source() const noexcept
+    {
+        return m_json;
+    }
+
+    inline std::size_t Scanner::bytesSkipped() const noexcept
+    {
+        return m_bytesSkipped;
+    }
+
+    inline std::size_t Scanner::bytesDecoded() const noexcept
+    {
+        return m_bytesDecoded;
+    }
+
+    inline void Scanner::resetStatistics() noexcept
+    {
+        m_bytesSkipped = 0;
+        m_bytesDecoded = 0;
+    }
+
+    //----------------------------------------------
+    // Private methods
+    //----------------------------------------------
+
+    inline std::size_t Scanner::valueEnd( std::size_t pos ) const noexcept
+    {
+        pos = skipWhitespace( pos );
+        if( pos >= m_json.size() )
+        {
+            return std::string_view::npos;
+        }
+
+        switch( m_json[pos] )
+        {
+            case '"':
+                return skipString( pos );
+            case '{':
+            case '[':
+                return skipContainer( pos );
+            case '}':
+            case ']':
+            case ',':
+            case ':':
+                return std::string_view::npos;
+            default:
+            {
+                // Scalar literal: number, true, false or null
+                std::size_t end = pos;
+                while( end < m_json.size() && !detail::isScalarDelimiter( m_json[end] ) )
+                {
+                    ++end;
+                }
+                return end;
+            }
+        }
+    }
+
+    inline std::size_t Scanner::skipString( std::size_t pos ) const noexcept
+    {
+        char padding[detail::scannerBlockSize];
+        std::uint64_t escapeCarry = 0;
+
+        for( std::size_t block = pos + 1; block < m_json.size(); block += detail::scannerBlockSize )
+        {
+            const detail::BlockMasks masks = detail::classifyBlock( detail::loadBlock( m_json, block, padding ) );
+            const std::uint64_t quotes = masks.quote & ~detail::escapedMask( masks.backslash, escapeCarry );
+            if( quotes != 0 )
+            {
+                return block + static_cast<std::size_t>( std::countr_zero( quotes ) ) + 1;
+            }
+        }
+
+        return std::string_view::npos;
+    }
+
+    inline std::size_t Scanner::skipContainer( std::size_t pos ) const noexcept
+    {
+        char padding[detail::scannerBlockSize];
+        std::uint64_t escapeCarry = 0;
+        std::uint64_t inStringCarry = 0;
+        std::size_t depth = 0;
+
+        for( std::size_t block = pos; block < m_json.size(); block += detail::scannerBlockSize )
+        {
+            const detail::BlockMasks masks = detail::classifyBlock( detail::loadBlock( m_json, block, padding ) );
+
+            // Mask out escaped quotes, then everything between quote pairs
+            const std::uint64_t quotes = masks.quote & ~detail::escapedMask( masks.backslash, escapeCarry );
+            const std::uint64_t inString = detail::prefixXor( quotes ) ^ inStringCarry;
+            inStringCarry = std::uint64_t{ 0 } - ( inString >> 63 );
+
+            const std::uint64_t open = masks.open & ~inString;
+            const std::uint64_t close = masks.close & ~inString;
+
+            // Depth cannot reach zero in this block: account for it in bulk
+            const auto closeCount = static_cast<std::size_t>( std::popcount( close ) );
+            if( depth > closeCount )
+            {
+                depth = depth + static_cast<std::size_t>( std::popcount( open ) ) - closeCount;
+                continue;
+            }
+
+            // Otherwise walk the structural brackets in order
+            std::uint64_t structural = open | close;
+            while( structural != 0 )
+            {
+                const std::uint64_t bit = structural & ( ~structural + 1 );
+                if( ( open & bit ) != 0 )
+                {
+                    ++depth;
+                }
+                else if( --depth == 0 )
+                {
+                    return block + static_cast<std::size_t>( std::countr_zero( bit ) ) + 1;
+                }
+                structural ^= bit;
+            }
+        }
+
+        return std::string_view::npos;
+    }
+} // namespace nfx::serialization::json
@@ -0,0 +1,550 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2026 nfx
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * @file Schema.inl
+ * @brief JSON Schema generation implementation file
+ */
+
+#include <cstdint>
+#include <limits>
+#include <string>
+#include <type_traits>
+#include <utility>
+
+namespace nfx::serialization::json
+{
+    namespace detail
+    {
+        //=====================================================================
+        // Schema fragments
+        //=====================================================================
+
+        /**
+         * @brief Write {"anyOf": [<U>, {"type": "null"}]}
+         * @tparam U Type of the non-null value
+         * @param builder Builder positioned where a schema value is expected
+         */
+        template <typename U>
+        inline void writeNullableSchema( Builder& builder )
+        {
+            builder.writeStartObject();
+            builder.writeKey( "anyOf" );
+            builder.writeStartArray();
+            writeSchema<U>( builder );
+            builder.writeStartObject();
+            builder.write( "type", "null" );
+            builder.writeEndObject();
+            builder.writeEndArray();
+            builder.writeEndObject();
+        }
+
+        /**
+         * @brief Write the schema of a homogeneous JSON array
+         * @tparam Item Element type
+         * @param builder Builder positioned where a schema value is expected
+         * @param uniqueItems Whether elements are distinct (sets)
+         * @param size Exact element count, or 0 for any length
+         */
+        template <typename Item>
+        inline void writeArraySchema( Builder& builder, bool uniqueItems = false, std::size_t size = 0 )
+        {
+            builder.writeStartObject();
+            builder.write( "type", "array" );
+            builder.writeKey( "items" );
+            writeSchema<Item>( builder );
+            if( uniqueItems )
+            {
+                builder.write( "uniqueItems", true );
+            }
+            if( size > 0 )
+            {
+                builder.write( "minItems", static_cast<std::uint64_t>( size ) );
+                builder.write( "maxItems", static_cast<std::uint64_t>( size ) );
+            }
+            builder.writeEndObject();
+        }
+
+        /**
+         * @brief Write the schema of a fixed-length array of heterogeneous elements
+         * @tparam Items Element types in order
+         * @param builder Builder positioned where a schema value is expected
+         */
+        template <typename... Items>
+        inline void writeTupleSchema( Builder& builder )
+        {
+            builder.writeStartObject();
+            builder.write( "type", "array" );
+            builder.writeKey( "prefixItems" );
+            builder.writeStartArray();
+            ( writeSchema<Items>( builder ), ... );
+            builder.writeEndArray();
+            builder.write( "items", false );
+            builder.write( "minItems", static_cast<std::uint64_t>( sizeof...( Items ) ) );
+            builder.write( "maxItems", static_cast<std::uint64_t>( sizeof...( Items ) ) );
+            builder.writeEndObject();
+        }
+
+        template <typename K, typename V>
+        inline void writeKeyValueArraySchema( Builder& builder )
+        {
+            builder.writeStartObject();
+            builder.write( "type", "array" );
+            builder.writeKey( "items" );
+            builder.writeStartObject();
+
+            // Entries are {"key": K, "value": V} objects or [K, V] arrays depending on PairLayout:
+            // the object keywords only apply to objects and the array keywords only to arrays
+            builder.writeKey( "type" );
+            builder.writeStartArray();
+            builder.write( "object" );
+            builder.write( "array" );
+            builder.writeEndArray();
+            builder.writeKey( "properties" );
+            builder.writeStartObject();
+            builder.writeKey( "key" );
+            writeSchema<K>( builder );
+            builder.writeKey( "value" );
+            writeSchema<V>( builder );
+            builder.writeEndObject();
+            builder.writeKey( "required" );
+            builder.writeStartArray();
+            builder.write( "key" );
+            builder.write( "value" );
+            builder.writeEndArray();
+            builder.writeKey( "prefixItems" );
+            builder.writeStartArray();
+            writeSchema<K>( builder );
+            writeSchema<V>( builder );
+            builder.writeEndArray();
+            builder.write( "items", false );
+            builder.write( "minItems", std::uint64_t{ 2 } );
+            builder.write( "maxItems", std::uint64_t{ 2 } );
+            builder.writeEndObject();
+            builder.writeEndObject();
+        }
+
+        /**
+         * @brief Write the schema of a variant tag: {"enum": ["<name>", <index>]}
+         * @tparam V Variant type
+         * @tparam I Alternative index
+         * @param builder Builder positioned where a schema value is expected
+         * @details Both forms are listed since VariantTagFormat selects one at serialization time,
+         *          unless the variant is tagged by index only.
+         */
+        template <typename V, std::size_t I>
+        inline void writeVariantTagSchema( Builder& builder )
+        {
+            builder.writeStartObject();
+            builder.writeKey( "enum" );
+            builder.writeStartArray();
+            if constexpr( !has_index_tags_only_v<V> )
+            {
+                builder.write( variantTagName<V, I>() );
+            }
+            builder.write( static_cast<std::int64_t>( I ) );
+            builder.writeEndArray();
+            builder.writeEndObject();
+        }
+
+        /**
+         * @brief Write the schema of one variant alternative in the variant's layout
+         * @tparam V Variant type
+         * @tparam I Alternative index
+         * @param builder Builder positioned where a schema value is expected
+         */
+        template <typename V, std::size_t I>
+        inline void writeVariantAlternativeSchema( Builder& builder )
+        {
+            using Alternative = std::variant_alternative_t<I, V>;
+            constexpr VariantLayout layout = variantLayout<V>();
+
+            if constexpr( layout == VariantLayout::Untagged )
+            {
+                writeSchema<Alternative>( builder );
+            }
+            else if constexpr( layout == VariantLayout::External )
+            {
+                // {"<name>": value}, or {"<index>": value} with index tags
+                const std::string index = std::to_string( I );
+                builder.writeStartObject();
+                builder.write( "type", "object" );
+                builder.writeKey( "properties" );
+                builder.writeStartObject();
+                if constexpr( !has_index_tags_only_v<V> )
+                {
+                    builder.writeKey( variantTagName<V, I>() );
+                    writeSchema<Alternative>( builder );
+                }
+                builder.writeKey( index );
+                writeSchema<Alternative>( builder );
+                builder.writeEndObject();
+                builder.write( "additionalProperties", false );
+                builder.write( "minProperties", std::uint64_t{ 1 } );
+                builder.write( "maxProperties", std::uint64_t{ 1 } );
+                builder.writeEndObject();
+            }
+            else if constexpr( layout == VariantLayout::Internal )
+            {
+                // The alternative's own object plus the tag member
+                builder.writeStartObject();
+                builder.writeKey( "allOf" );
+                builder.writeStartArray();
+                writeSchema<Alternative>( builder );
+                builder.writeStartObject();
+                builder.write( "type", "object" );
+                builder.writeKey( "properties" );
+                builder.writeStartObject();
+                builder.writeKey( variantTagKey<V>() );
+                writeVariantTagSchema<V, I>( builder );
+                builder.writeEndObject();
+                builder.writeKey( "required" );
+                builder.writeStartArray();
+                builder.write( variantTagKey<V>() );
+                builder.writeEndArray();
+                builder.writeEndObject();
+                builder.writeEndArray();
+                builder.writeEndObject();
+            }
+            else
+            {
+                // {"tag": ..., "data": value}
+                builder.writeStartObject();
+                builder.write( "type", "object" );
+                builder.writeKey( "properties" );
+                builder.writeStartObject();
+                builder.writeKey( "tag" );
+                writeVariantTagSchema<V, I>( builder );
+                builder.writeKey( "data" );
+                writeSchema<Alternative>( builder );
+                builder.writeEndObject();
+                builder.writeKey( "required" );
+                builder.writeStartArray();
+                builder.write( "tag" );
+                builder.write( "data" );
+                builder.writeEndArray();
+                builder.writeEndObject();
+            }
+        }
+
+        /**
+         * @brief Write the schema of a variant
+         * @tparam V Variant type
+         * @param builder Builder positioned where a schema value is expected
+         * @details Tagged layouts are mutually exclusive (oneOf); untagged alternatives may overlap (anyOf).
+         */
+        template <typename V>
+        inline void writeVariantSchema( Builder& builder )
+        {
+            builder.writeStartObject();
+            builder.writeKey( variantLayout<V>() == VariantLayout::Untagged ? "anyOf" : "oneOf" );
+            builder.writeStartArray();
+            [&builder]<std::size_t... I>( std::index_sequence<I...> ) {
+                ( writeVariantAlternativeSchema<V, I>( builder ), ... );
+            }( std::make_index_sequence<std::variant_size_v<V>>{} );
+            builder.writeEndArray();
+            builder.writeEndObject();
+        }
+
+        /**
+         * @brief Write the schema of an integral type, bounded by its range
+         * @tparam U Integral type
+         * @param builder Builder positioned where a schema value is expected
+         */
+        template <typename U>
+        inline void writeIntegerSchema( Builder& builder )
+        {
+            builder.writeStartObject();
+            builder.write( "type", "integer" );
+            if constexpr( std::is_signed_v<U> )
+            {
+                builder.write( "minimum", static_cast<std::int64_t>( std::numeric_limits<U>::min() ) );
+                builder.write( "maximum", static_cast<std::int64_t>( std::numeric_limits<U>::max() ) );
+            }
+            else
+            {
+                builder.write( "minimum", std::uint64_t{ 0 } );
+                builder.write( "maximum", static_cast<std::uint64_t>( std::numeric_limits<U>::max() ) );
+            }
+            builder.writeEndObject();
+        }
+
+        /**
+         * @brief Write the schema of an enumeration: {"anyOf": [{"enum": [names]}, <integer>]}
+         * @tparam E Enumeration type
+         * @param builder Builder positioned where a schema value is expected
+         * @details Underlying values are accepted since EnumFormat::Integer and unnamed values write
+         *          them; flag sets are arrays of such items, or a single underlying value.
+         */
+        template <typename E>
+        inline void writeEnumSchema( Builder& builder )
+        {
+            using Table = EnumTable<E>;
+
+            const auto writeItem = [&builder] {
+                builder.writeStartObject();
+                builder.writeKey( "anyOf" );
+                builder.writeStartArray();
+                builder.writeStartObject();
+                builder.writeKey( "enum" );
+                builder.writeStartArray();
+                for( const auto name : Table::names )
+                {
+                    builder.write( name );
+                }
+                builder.writeEndArray();
+                builder.writeEndObject();
+                writeIntegerSchema<std::underlying_type_t<E>>( builder );
+                builder.writeEndArray();
+                builder.writeEndObject();
+            };
+
+            if constexpr( Table::flags )
+            {
+                builder.writeStartObject();
+                builder.writeKey( "anyOf" );
+                builder.writeStartArray();
+                builder.writeStartObject();
+                builder.write( "type", "array" );
+                builder.writeKey( "items" );
+                writeItem();
+                builder.writeEndObject();
+                writeIntegerSchema<std::underlying_type_t<E>>( builder );
+                builder.writeEndArray();
+                builder.writeEndObject();
+            }
+            else
+            {
+                writeItem();
+            }
+        }
+
+        /**
+         * @brief Write the schema of a byte container: {"anyOf": [<base64>, <hex>, <array of bytes>]}
+         * @tparam U Byte container type
+         * @details The string encoding is chosen by Options::bytesFormat, so both are accepted;
+         *          std::array also bounds the string lengths (base64 padded or not).
+         */
+        template <typename U>
+        inline void writeBytesSchema( Builder& builder )
+        {
+            constexpr std::size_t size = [] {
+                if constexpr( requires { std::tuple_size<U>::value; } )
+                {
+                    return std::tuple_size_v<U>;
+                }
+                else
+                {
+                    return std::size_t{ 0 };
+                }
+            }();
+
+            builder.writeStartObject();
+            builder.writeKey( "anyOf" );
+            builder.writeStartArray();
+
+            builder.writeStartObject();
+            builder.write( "type", "string" );
+            builder.write( "contentEncoding", "base64" );
+            builder.write( "pattern", R"(^(?:[A-Za-z0-9+/]{4})*(?:[A-Za-z0-9+/]{2}(?:==)?|[A-Za-z0-9+/]{3}=?)?$)" );
+            if constexpr( size > 0 )
+            {
+                const std::size_t unpadded = size / 3 * 4 + ( size % 3 == 0 ? 0 : size % 3 + 1 );
+                builder.write( "minLength", static_cast<std::uint64_t>( unpadded ) );
+                builder.write( "maxLength", static_cast<std::uint64_t>( base64EncodedLength( size ) ) );
+            }
+            builder.writeEndObject();
+
+            builder.writeStartObject();
+            builder.write( "type", "string" );
+            builder.write( "pattern", "^(?:[0-9A-Fa-f]{2})*$" );
+            if constexpr( size > 0 )
+            {
+                builder.write( "minLength", static_cast<std::uint64_t>( hexEncodedLength( size ) ) );
+                builder.write( "maxLength", static_cast<std::uint64_t>( hexEncodedLength( size ) ) );
+            }
+            builder.writeEndObject();
+
+            writeArraySchema<std::remove_cv_t<typename U::value_type>>( builder, false, size );
+
+            builder.writeEndArray();
+            builder.writeEndObject();
+        }
+
+        //=====================================================================
+        // Type dispatch
+        //=====================================================================
+
+        template <typename U>
+        inline void writeSchema( Builder& builder )
+        {
+            // Schemas declared by traits take precedence (same order as the serializer's dispatch)
+            if constexpr( has_schema_v<U> )
+            {
+                writeDocument( Document{ SerializationTraits<U>::schema() }, builder );
+            }
+            else if constexpr( has_schema_writer_v<U> )
+            {
+                SerializationTraits<U>::writeSchema( builder );
+            }
+            else if constexpr( has_streaming_serialization_v<U> )
+            {
+                // Custom format without a schema: accept anything
+                builder.writeStartObject();
+                builder.writeEndObject();
+            }
+            else if constexpr( std::is_same_v<U, bool> )
+            {
+                builder.writeStartObject();
+                builder.write( "type", "boolean" );
+                builder.writeEndObject();
+            }
+            else if constexpr( std::is_integral_v<U> )
+            {
+                writeIntegerSchema<U>( builder );
+            }
+            else if constexpr( std::is_floating_point_v<U> )
+            {
+                builder.writeStartObject();
+                builder.write( "type", "number" );
+                builder.writeEndObject();
+            }
+            else if constexpr( std::is_enum_v<U> )
+            {
+                writeEnumSchema<U>( builder );
+            }
+            else if constexpr( std::is_same_v<U, std::string> || std::is_same_v<U, std::string_view> ||
+                               std::is_same_v<U, InternedString> )
+            {
+                builder.writeStartObject();
+                builder.write( "type", "string" );
+                builder.writeEndObject();
+            }
+            else if constexpr( std::is_same_v<U, std::shared_ptr<const std::string>> )
+            {
+                writeNullableSchema<std::string>( builder );
+            }
+            else if constexpr( is_cached_json<U>::value )
+            {
+                writeSchema<typename U::value_type>( builder );
+            }
+            else if constexpr( is_optional<U>::value || is_smart_pointer<U>::value )
+            {
+                writeNullableSchema<std::remove_cvref_t<decltype( *std::declval<U&>() )>>( builder );
+            }
+            else if constexpr( is_byte_container<U>::value )
+            {
+                writeBytesSchema<U>( builder );
+            }
+            else if constexpr( is_span<U>::value )
+            {
+                writeArraySchema<std::remove_cv_t<typename U::element_type>>( builder );
+            }
+            else if constexpr( is_tuple<U>::value )
+            {
+                [&builder]<typename... Items>( std::type_identity<std::tuple<Items...>> ) {
+                    writeTupleSchema<Items...>( builder );
+                }( std::type_identity<U>{} );
+            }
+            else if constexpr( is_variant<U>::value )
+            {
+                writeVariantSchema<U>( builder );
+            }
+            else if constexpr( is_pair<U>::value )
+            {
+                writeTupleSchema<typename U::first_type, typename U::second_type>( builder );
+            }
+            else if constexpr( is_multimap<U>::value || is_unordered_multimap<U>::value )
+            {
+                writeKeyValueArraySchema<typename U::key_type, typename U::mapped_type>( builder );
+            }
+            else if constexpr( is_container<U>::value && requires { typename U::mapped_type; } )
+            {
+                // Map-like containers: JSON object keyed by the (stringified) map key
+                builder.writeStartObject();
+                builder.write( "type", "object" );
+                builder.writeKey( "additionalProperties" );
+                writeSchema<typename U::mapped_type>( builder );
+                builder.writeEndObject();
+            }
+            else if constexpr( is_container<U>::value && requires { std::tuple_size<U>::value; } )
+            {
+                // std::array
+                writeArraySchema<typename U::value_type>( builder, false, std::tuple_size_v<U> );
+            }
+            else if constexpr( is_container<U>::value )
+            {
+                // Sequences, sets (distinct elements) and multisets
+                constexpr bool isSet = requires { typename U::key_type; } && !is_multiset<U>::value &&
+                                       !is_unordered_multiset<U>::value;
+                writeArraySchema<typename U::value_type>( builder, isSet );
+            }
+            else
+            {
+                // Legacy toDocument() types and anything else: accept anything
+                builder.writeStartObject();
+                builder.writeEndObject();
+            }
+        }
+    } // namespace detail
+
+    //=====================================================================
+    // Schema generation
+    //=====================================================================
+
+    template <typename T>
+    inline const Document& SchemaOf()
+    {
+        static const Document schema = [] {
+            if constexpr( detail::has_schema_v<T> )
+            {
+                return Document{ SerializationTraits<T>::schema() };
+            }
+            else
+            {
+                Builder builder;
+                detail::writeSchema<T>( builder );
+                Document document = Document::fromString( builder.toString() ).value();
+                document.set<std::string>( "/$schema", "https://json-schema.org/draft/2020-12/schema" );
+                return document;
+            }
+        }();
+        return schema;
+    }
+
+    template <typename T>
+    inline const SchemaValidator& SchemaValidatorOf()
+    {
+        if constexpr( detail::has_schema_v<T> )
+        {
+            // Shared with validateOnDeserialize
+            return detail::schemaValidator<T>();
+        }
+        else
+        {
+            static const SchemaValidator validator{ SchemaOf<T>() };
+            return validator;
+        }
+    }
+} // namespace nfx::serialization::json
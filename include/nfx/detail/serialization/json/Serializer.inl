@@ -30,19 +30,30 @@
  *          deserialization methods for all supported types.
  */
 
+#include <algorithm>
 #include <array>
+#include <bit>
+#include <charconv>
+#include <cmath>
+#include <concepts>
+#include <cstdio>
+#include <cstdlib>
 #include <deque>
+#include <exception>
 #include <forward_list>
+#include <limits>
 #include <list>
 #include <map>
 #include <memory>
 #include <optional>
 #include <set>
 #include <span>
+#include <stdexcept>
 #include <tuple>
 #include <type_traits>
 #include <unordered_map>
 #include <unordered_set>
+#include <utility>
 #include <variant>
 #include <vector>
 
@@ -376,390 +387,3656 @@ namespace nfx::serialization::json
             }
         }
 
+        //----------------------------------------------
+        // Variant tag lookup
+        //----------------------------------------------
+
         /**
-         * @brief Type trait to detect if a type is std::optional
-         * @tparam T The type to check
-         * @details Base template that evaluates to false. Specialized for std::optional<T>.
+         * @brief Compile-time FNV-1a hash of a tag name
+         * @param text Tag name
+         * @return 64-bit hash
          */
-        template <typename T>
-        struct is_optional : std::false_type
-        {
-        };
-
-        /** @brief Specialization for std::optional */
-        template <typename T>
-        struct is_optional<std::optional<T>> : std::true_type
+        inline constexpr std::uint64_t tagHash( std::string_view text ) noexcept
         {
-        };
+            std::uint64_t hash = 0xCBF29CE484222325ULL;
+            for( const char c : text )
+            {
+                hash = ( hash ^ static_cast<std::uint8_t>( c ) ) * 0x100000001B3ULL;
+            }
+            return hash;
+        }
 
         /**
-         * @brief Type trait to detect if a type is a smart pointer
-         * @tparam T The type to check
-         * @details Base template that evaluates to false. Specialized for std::unique_ptr
-         *          and std::shared_ptr types.
+         * @brief Get the tag name of a variant alternative
+         * @tparam V Variant type
+         * @tparam I Alternative index
+         * @return VariantTraits<V>::names[I] if specialized, otherwise the simplified type name
          */
-        template <typename T>
-        struct is_smart_pointer : std::false_type
-        {
-        };
-
-        /** @brief Specialization for std::unique_ptr */
-        template <typename T>
-        struct is_smart_pointer<std::unique_ptr<T>> : std::true_type
-        {
-        };
-
-        /** @brief Specialization for std::shared_ptr */
-        template <typename T>
-        struct is_smart_pointer<std::shared_ptr<T>> : std::true_type
+        template <typename V, std::size_t I>
+        constexpr std::string_view variantTagName() noexcept
         {
-        };
+            if constexpr( has_variant_tag_names_v<V> )
+            {
+                return VariantTraits<V>::names[I];
+            }
+            else
+            {
+                return type_name<std::variant_alternative_t<I, V>>();
+            }
+        }
 
         /**
-         * @brief Type trait to detect std::span types
-         * @tparam T The type to check
-         * @details Base template that evaluates to false. Specialized for std::span types.
+         * @brief Compile-time tag name table with open-addressing hash lookup
+         * @tparam V Variant type
+         * @details Duplicate names are rejected at compile time: they could not be read back.
          */
-        template <typename T>
-        struct is_span : std::false_type
-        {
-        };
-
-        /** @brief Specialization for std::span */
-        template <typename T, std::size_t Extent>
-        struct is_span<std::span<T, Extent>> : std::true_type
+        template <typename V>
+        struct VariantTagTable
         {
-        };
-    } // namespace detail
+            /** @brief Number of alternatives */
+            static constexpr std::size_t count = std::variant_size_v<V>;
 
-    //=====================================================================
-    // Serializer class
-    //=====================================================================
+            /** @brief Hash table size (power of two, load factor <= 0.5) */
+            static constexpr std::size_t capacity = std::bit_ceil( count * 2 );
 
-    //----------------------------------------------
-    // Serialization options and context
-    //----------------------------------------------
+            /** @brief Tag name per alternative index */
+            static constexpr std::array<std::string_view, count> names =
+                []<std::size_t... I>( std::index_sequence<I...> ) {
+                    return std::array<std::string_view, count>{ variantTagName<V, I>()... };
+                }( std::make_index_sequence<count>{} );
 
-    template <typename T>
-    template <typename U>
-    inline void Serializer<T>::Options::copyFrom( const typename Serializer<U>::Options& other )
-    {
-        includeNullFields = other.includeNullFields;
-        prettyPrint = other.prettyPrint;
-        validateOnDeserialize = other.validateOnDeserialize;
-        escapeNonAscii = other.escapeNonAscii;
-    }
+            static_assert(
+                [] {
+                    for( std::size_t i = 0; i < count; ++i )
+                    {
+                        for( std::size_t j = 0; j < i; ++j )
+                        {
+                            if( names[j] == names[i] )
+                            {
+                                return false;
+                            }
+                        }
+                    }
+                    return true;
+                }(),
+                "Alternatives of this std::variant share a tag name (type names drop namespaces and template "
+                "arguments, e.g. std::vector<int> and std::vector<double> are both \"vector\"): declare distinct "
+                "VariantTraits<V>::names, or tag by index with VariantTraits<V>::tagFormat = VariantTagFormat::Index" );
 
-    template <typename T>
-    template <typename U>
-    inline typename Serializer<T>::Options Serializer<T>::Options::createFrom(
-        const typename Serializer<U>::Options& other )
-    {
-        Options result;
-        result.includeNullFields = other.includeNullFields;
-        result.prettyPrint = other.prettyPrint;
-        result.validateOnDeserialize = other.validateOnDeserialize;
-        result.escapeNonAscii = other.escapeNonAscii;
-        return result;
-    }
+            /**
+             * @brief Hash table slot
+             */
+            struct Slot
+            {
+                std::uint64_t hash = 0; ///< Hash of the tag name
+                std::size_t index = 0;  ///< Alternative index
+                bool used = false;      ///< Whether the slot is occupied
+            };
 
-    //----------------------------------------------
-    // Construction
-    //----------------------------------------------
+            /** @brief Hash table built at compile time */
+            static constexpr std::array<Slot, capacity> slots = [] {
+                std::array<Slot, capacity> table{};
+                for( std::size_t i = 0; i < count; ++i )
+                {
+                    const std::uint64_t hash = tagHash( names[i] );
+                    std::size_t pos = static_cast<std::size_t>( hash ) & ( capacity - 1 );
+                    while( table[pos].used )
+                    {
+                        pos = ( pos + 1 ) & ( capacity - 1 );
+                    }
+                    table[pos] = Slot{ hash, i, true };
+                }
+                return table;
+            }();
 
-    template <typename T>
-    inline Serializer<T>::Serializer( const Options& options ) noexcept
-        : m_options{ options }
-    {
-    }
+            /**
+             * @brief Find the alternative index for a tag name
+             * @param tag Tag name read from JSON
+             * @return Alternative index, or std::nullopt for an unknown tag
+             */
+            static constexpr std::optional<std::size_t> find( std::string_view tag ) noexcept
+            {
+                const std::uint64_t hash = tagHash( tag );
+                for( std::size_t pos = static_cast<std::size_t>( hash ) & ( capacity - 1 ); slots[pos].used;
+                     pos = ( pos + 1 ) & ( capacity - 1 ) )
+                {
+                    if( slots[pos].hash == hash && names[slots[pos].index] == tag )
+                    {
+                        return slots[pos].index;
+                    }
+                }
+                return std::nullopt;
+            }
+        };
 
-    //----------------------------------------------
-    // Options management
-    //----------------------------------------------
+        /**
+         * @brief Get the tag name of a variant alternative
+         * @tparam V Variant type
+         * @param index Alternative index
+         * @return Tag name, or an empty view for variants tagged by index only
+         */
+        template <typename V>
+        constexpr std::string_view variantTagNameAt( std::size_t index ) noexcept
+        {
+            if constexpr( has_index_tags_only_v<V> )
+            {
+                return {};
+            }
+            else
+            {
+                return VariantTagTable<V>::names[index];
+            }
+        }
 
-    template <typename T>
-    inline const Serializer<T>::Options& Serializer<T>::options() const noexcept
-    {
-        return m_options;
-    }
+        /**
+         * @brief Find the alternative index for a tag name
+         * @tparam V Variant type
+         * @param tag Tag name read from JSON
+         * @return Alternative index, or std::nullopt for an unknown tag (always for index-only variants)
+         */
+        template <typename V>
+        constexpr std::optional<std::size_t> findVariantTag( std::string_view tag ) noexcept
+        {
+            if constexpr( has_index_tags_only_v<V> )
+            {
+                return std::nullopt;
+            }
+            else
+            {
+                return VariantTagTable<V>::find( tag );
+            }
+        }
 
-    template <typename T>
-    inline void Serializer<T>::setOptions( const typename Serializer<T>::Options& options ) noexcept
-    {
-        m_options = options;
-    }
+        //----------------------------------------------
+        // Enum name lookup
+        //----------------------------------------------
 
-    //----------------------------------------------
-    // Static convenience serialization methods
-    //----------------------------------------------
+        /**
+         * @brief Extract the name of an enumerator from a template instantiation
+         * @tparam V Enumeration value
+         * @return Unqualified enumerator name, or an empty view if no enumerator has the value
+         * @details Compilers print named values as "Color::Red" and others as a cast, "(Color)3".
+         */
+        template <auto V>
+        constexpr std::string_view enumeratorName() noexcept
+        {
+            constexpr std::string_view full_name =
+#if defined( __clang__ ) || defined( __GNUC__ )
+                __PRETTY_FUNCTION__;
+#elif defined( _MSC_VER )
+                __FUNCSIG__;
+#endif
 
-    template <typename T>
-    inline std::string Serializer<T>::toString( const T& obj, const Serializer<T>::Options& options )
-    {
-        Serializer<T> serializer( options );
-        Builder builder( { .indent = options.prettyPrint ? 2 : 0, .escapeNonAscii = options.escapeNonAscii } );
-        serializer.serializeValue( obj, builder );
+#if defined( _MSC_VER )
+            // MSVC: "enumeratorName<Color::Red>(void)"
+            constexpr std::string_view prefix = "enumeratorName<";
+            constexpr auto prefix_pos = full_name.find( prefix );
+            constexpr auto start = prefix_pos + prefix.size();
+            constexpr auto end = full_name.find( ">(", start );
+#else
+            // GCC/Clang: "[with auto V = Color::Red; ...]" or "[V = Color::Red]"
+            constexpr std::string_view prefix = "V = ";
+            constexpr auto prefix_pos = full_name.find( prefix );
+            constexpr auto start = prefix_pos + prefix.size();
+            constexpr auto end = full_name.find_first_of( ";]", start );
+#endif
 
-        return builder.toString();
-    }
+            if constexpr( prefix_pos == std::string_view::npos || end == std::string_view::npos )
+            {
+                return {};
+            }
+            else
+            {
+                constexpr auto value = full_name.substr( start, end - start );
+                if constexpr( value.empty() || value[0] == '(' || value[0] == '-' ||
+                              ( value[0] >= '0' && value[0] <= '9' ) )
+                {
+                    return {};
+                }
+                else
+                {
+                    constexpr auto last_colon = value.rfind( "::" );
+                    return last_colon == std::string_view::npos ? value : value.substr( last_colon + 2 );
+                }
+            }
+        }
 
-    template <typename T>
-    inline T Serializer<T>::fromString( std::string_view jsonStr, const Serializer<T>::Options& options )
-    {
-        Serializer<T> serializer( options );
-        auto optDoc = Document::fromString( jsonStr );
-        if( !optDoc )
+        /**
+         * @brief Name of the enumerator with a given underlying value
+         * @tparam E Enumeration type
+         * @tparam V Underlying value
+         * @return Enumerator name, or an empty view if V names no enumerator
+         * @details Values outside the range of an enumeration without a fixed underlying type are
+         *          not constant expressions; they are skipped rather than instantiated.
+         */
+        template <typename E, std::int64_t V>
+        constexpr std::string_view enumValueName() noexcept
         {
-            throw std::runtime_error{ "Failed to parse JSON string" };
+            if constexpr( requires { typename std::integral_constant<E, static_cast<E>( V )>; } )
+            {
+                return enumeratorName<static_cast<E>( V )>();
+            }
+            else
+            {
+                return {};
+            }
         }
 
-        // SFINAE dispatch: factory vs mutable deserialization
-        if constexpr( detail::has_factory_deserialization_v<T> )
+        /**
+         * @brief Number of values reflected for an enumeration
+         * @tparam E Enumeration type
+         * @return Bit count for flags (at most 63), otherwise the size of the reflected range
+         */
+        template <typename E>
+        constexpr std::size_t enumCandidateCount() noexcept
         {
-            // Option A: Factory deserialization (works with deleted default ctors)
-            return SerializationTraits<T>::fromDocument( *optDoc );
+            if constexpr( isFlagEnum<E>() )
+            {
+                using Bits = std::make_unsigned_t<std::underlying_type_t<E>>;
+                return std::min<std::size_t>( std::numeric_limits<Bits>::digits, 63 );
+            }
+            else
+            {
+                return static_cast<std::size_t>( enumRangeMax<E>() - enumRangeMin<E>() + 1 );
+            }
         }
-        else
+
+        /**
+         * @brief Value reflected at a position
+         * @tparam E Enumeration type
+         * @param i Position, below enumCandidateCount<E>()
+         * @return Single bit i for flags, otherwise the i-th value of the reflected range
+         */
+        template <typename E>
+        constexpr std::int64_t enumCandidate( std::size_t i ) noexcept
         {
-            // Option B: Mutable deserialization (requires default ctor)
-            T obj{};
-            serializer.deserializeValue( *optDoc, obj );
-            return obj;
+            if constexpr( isFlagEnum<E>() )
+            {
+                return static_cast<std::int64_t>( std::uint64_t{ 1 } << i );
+            }
+            else
+            {
+                return enumRangeMin<E>() + static_cast<std::int64_t>( i );
+            }
         }
-    }
 
-    //----------------------------------------------
-    // Private methods
-    //----------------------------------------------
+        /**
+         * @brief Collect the enumerators of an enumeration
+         * @tparam E Enumeration type
+         * @return EnumTraits<E>::values if declared, otherwise the named values of the reflected
+         *         range (single bits for flags)
+         */
+        template <typename E>
+        constexpr auto enumValues() noexcept
+        {
+            using Underlying = std::underlying_type_t<E>;
 
-    template <typename T>
-    template <typename U>
-    inline void Serializer<T>::serializeValue( const U& obj, Builder& builder ) const
-    {
-        // Priority order (performance-optimized):
-        // 1. SerializationTraits::serialize() - optimal streaming serialization
-        // 2. Built-in types - efficient direct serialization
-        // 3. Custom toDocument() - user override (performance hit: Document → JSON → Builder)
+            if constexpr( has_enum_values_v<E> )
+            {
+                constexpr auto& declared = EnumTraits<E>::values;
+                std::array<E, std::tuple_size_v<std::remove_cvref_t<decltype( declared )>>> values{};
+                for( std::size_t i = 0; i < values.size(); ++i )
+                {
+                    values[i] = static_cast<E>( declared[i] );
+                }
+                return values;
+            }
+            else
+            {
+                constexpr std::size_t candidates = enumCandidateCount<E>();
+                constexpr auto named = []<std::size_t... I>( std::index_sequence<I...> ) {
+                    return std::array<bool, sizeof...( I )>{ !enumValueName<E, enumCandidate<E>( I )>().empty()... };
+                }( std::make_index_sequence<candidates>{} );
+                constexpr auto count = static_cast<std::size_t>( std::count( named.begin(), named.end(), true ) );
 
-        // Fast path
-        if constexpr( detail::has_streaming_serialization_v<U> )
-        {
-            SerializationTraits<U>::serialize( obj, builder );
-            return;
+                std::array<E, count> values{};
+                std::size_t next = 0;
+                for( std::size_t i = 0; i < candidates; ++i )
+                {
+                    if( named[i] )
+                    {
+                        values[next++] = static_cast<E>( static_cast<Underlying>( enumCandidate<E>( i ) ) );
+                    }
+                }
+                return values;
+            }
         }
 
-        // Handle built-in types with library-defined logic
-        if constexpr( std::is_same_v<U, bool> )
+        /**
+         * @brief Seeded mix of a name hash
+         * @param hash tagHash() of the name
+         * @param seed Seed (0 selects the bucket, others the slot)
+         * @return Mixed hash
+         */
+        inline constexpr std::uint64_t mixHash( std::uint64_t hash, std::uint64_t seed ) noexcept
         {
-            // Handle bool separately (before is_integral check)
-            builder.write( obj );
+            hash ^= seed * 0x9E3779B97F4A7C15ULL;
+            hash ^= hash >> 31;
+            hash *= 0xBF58476D1CE4E5B9ULL;
+            hash ^= hash >> 29;
+            return hash;
         }
-        else if constexpr( std::is_integral_v<U> )
+
+        /**
+         * @brief Compile-time enumerator table: names, pre-escaped literals and lookups both ways
+         * @tparam E Enumeration type
+         * @details Names resolve through a perfect hash built at compile time (hash and displace):
+         *          the name hash picks a bucket, whose displacement seed picks the single slot the
+         *          name can be in, so a lookup costs one hash and one comparison. Duplicate names
+         *          resolve to the first enumerator carrying them; values naming several enumerators
+         *          write the first one.
+         */
+        template <typename E>
+        struct EnumTable
         {
-            // Handle integral types (int, long, etc.)
-            builder.write( static_cast<int64_t>( obj ) );
-        }
-        else if constexpr( std::is_floating_point_v<U> )
+            /** @brief Underlying integer type */
+            using Underlying = std::underlying_type_t<E>;
+
+            /** @brief Unsigned counterpart, for flag arithmetic */
+            using Bits = std::make_unsigned_t<Underlying>;
+
+            /** @brief Whether values are sets of flags */
+            static constexpr bool flags = isFlagEnum<E>();
+
+            /** @brief Named enumerators */
+            static constexpr auto values = enumValues<E>();
+
+            /** @brief Number of named enumerators */
+            static constexpr std::size_t count = values.size();
+
+            /** @brief Name per enumerator */
+            static constexpr std::array<std::string_view, count> names = [] {
+                std::array<std::string_view, count> result{};
+                if constexpr( has_enum_names_v<E> )
+                {
+                    static_assert( std::tuple_size_v<std::remove_cvref_t<decltype( EnumTraits<E>::names )>> == count,
+                                   "EnumTraits<E>::names must hold one name per enumerator" );
+                    for( std::size_t i = 0; i < count; ++i )
+                    {
+                        result[i] = EnumTraits<E>::names[i];
+                    }
+                }
+                else
+                {
+                    [&result]<std::size_t... I>( std::index_sequence<I...> ) {
+                        ( ( result[I] = enumeratorName<values[I]>() ), ... );
+                    }( std::make_index_sequence<count>{} );
+                }
+                return result;
+            }();
+
+            //----------------------------------------------
+            // Pre-escaped literals
+            //----------------------------------------------
+
+            /**
+             * @brief Whether a name is written unchanged between quotes
+             * @param name Enumerator name
+             * @return True if it holds only printable ASCII other than quotes and backslashes
+             */
+            static constexpr bool isPlain( std::string_view name ) noexcept
+            {
+                for( const char c : name )
+                {
+                    if( c < 0x20 || c > 0x7E || c == '"' || c == '\\' )
+                    {
+                        return false;
+                    }
+                }
+                return true;
+            }
+
+            /** @brief Bytes of all quoted names */
+            static constexpr std::size_t literalBytes = [] {
+                std::size_t bytes = 1;
+                for( const auto name : names )
+                {
+                    bytes += name.size() + 2;
+                }
+                return bytes;
+            }();
+
+            /** @brief Quoted names, back to back */
+            static constexpr std::array<char, literalBytes> literalData = [] {
+                std::array<char, literalBytes> data{};
+                std::size_t pos = 0;
+                for( const auto name : names )
+                {
+                    data[pos++] = '"';
+                    for( const char c : name )
+                    {
+                        data[pos++] = c;
+                    }
+                    data[pos++] = '"';
+                }
+                return data;
+            }();
+
+            /** @brief JSON literal per enumerator, empty if the name needs escaping */
+            static constexpr std::array<std::string_view, count> literals = [] {
+                std::array<std::string_view, count> result{};
+                std::size_t pos = 0;
+                for( std::size_t i = 0; i < count; ++i )
+                {
+                    if( isPlain( names[i] ) )
+                    {
+                        result[i] = std::string_view{ literalData.data() + pos, names[i].size() + 2 };
+                    }
+                    pos += names[i].size() + 2;
+                }
+                return result;
+            }();
+
+            /**
+             * @brief Write the name of an enumerator
+             * @param index Enumerator index
+             * @param builder Output builder
+             */
+            static void write( std::size_t index, Builder& builder )
+            {
+                if( !literals[index].empty() )
+                {
+                    builder.writeRawJson( literals[index] );
+                }
+                else
+                {
+                    builder.write( names[index] );
+                }
+            }
+
+            //----------------------------------------------
+            // Value lookup
+            //----------------------------------------------
+
+            /**
+             * @brief Enumerator of a value
+             */
+            struct ValueEntry
+            {
+                Underlying value{};    ///< Underlying value
+                std::size_t index = 0; ///< Enumerator index
+            };
+
+            /** @brief Enumerators sorted by value, first declared first among equal values */
+            static constexpr std::array<ValueEntry, count> byValue = [] {
+                std::array<ValueEntry, count> sorted{};
+                for( std::size_t i = 0; i < count; ++i )
+                {
+                    sorted[i] = ValueEntry{ static_cast<Underlying>( values[i] ), i };
+                }
+                // Insertion sort: stable and usable in constant expressions
+                for( std::size_t i = 1; i < count; ++i )
+                {
+                    for( std::size_t j = i; j > 0 && sorted[j].value < sorted[j - 1].value; --j )
+                    {
+                        std::swap( sorted[j], sorted[j - 1] );
+                    }
+                }
+                return sorted;
+            }();
+
+            /** @brief Whether the sorted values are distinct and consecutive */
+            static constexpr bool dense = [] {
+                for( std::size_t i = 1; i < count; ++i )
+                {
+                    if( static_cast<Bits>( byValue[i].value ) != static_cast<Bits>( byValue[i - 1].value ) + 1 )
+                    {
+                        return false;
+                    }
+                }
+                return true;
+            }();
+
+            /**
+             * @brief Find the enumerator of a value
+             * @param value Enumeration value
+             * @return Enumerator index, or std::nullopt for an unnamed value
+             */
+            static constexpr std::optional<std::size_t> indexOf( E value ) noexcept
+            {
+                if constexpr( count == 0 )
+                {
+                    return std::nullopt;
+                }
+                else
+                {
+                    const auto underlying = static_cast<Underlying>( value );
+                    if constexpr( dense )
+                    {
+                        // Consecutive values: direct offset
+                        if( underlying < byValue.front().value || underlying > byValue.back().value )
+                        {
+                            return std::nullopt;
+                        }
+                        return byValue[static_cast<std::size_t>( static_cast<Bits>( underlying ) -
+                                                                 static_cast<Bits>( byValue.front().value ) )]
+                            .index;
+                    }
+                    else
+                    {
+                        const auto it = std::lower_bound(
+                            byValue.begin(), byValue.end(), underlying, []( const ValueEntry& entry, Underlying v ) {
+                                return entry.value < v;
+                            } );
+                        if( it == byValue.end() || it->value != underlying )
+                        {
+                            return std::nullopt;
+                        }
+                        return it->index;
+                    }
+                }
+            }
+
+            /**
+             * @brief Split a flag set into named flags
+             * @param value Flag set
+             * @param onName Callable receiving the index of each named flag, in declaration order
+             * @return Bits no named flag covers (0 if fully named)
+             * @details A flag is taken when all of its bits are still uncovered, so combined masks
+             *          declared before their parts are written instead of the parts.
+             */
+            template <typename Function>
+            static constexpr Underlying decompose( E value, Function&& onName )
+            {
+                auto remaining = static_cast<Bits>( static_cast<Underlying>( value ) );
+                for( std::size_t i = 0; i < count && remaining != 0; ++i )
+                {
+                    const auto flag = static_cast<Bits>( static_cast<Underlying>( values[i] ) );
+                    if( flag != 0 && ( remaining & flag ) == flag )
+                    {
+                        onName( i );
+                        remaining = static_cast<Bits>( remaining & ~flag );
+                    }
+                }
+                return static_cast<Underlying>( remaining );
+            }
+
+            //----------------------------------------------
+            // Name lookup
+            //----------------------------------------------
+
+            /** @brief Bucket and slot count (power of two, load factor <= 0.5) */
+            static constexpr std::size_t capacity = std::bit_ceil( count * 2 + 1 );
+
+            /**
+             * @brief Perfect hash table built at compile time
+             */
+            struct HashTable
+            {
+                /** @brief Per bucket: 0 if empty, seed > 0 for shared buckets, -(slot + 1) for single names */
+                std::array<std::int64_t, capacity> displacement{};
+
+                /** @brief Per slot: enumerator index + 1, 0 if empty */
+                std::array<std::size_t, capacity> slots{};
+            };
+
+            /** @brief Hash table of the distinct names */
+            static constexpr HashTable table = [] {
+                HashTable result{};
+                constexpr std::uint64_t mask = capacity - 1;
+
+                // Bucket members, first occurrence of each name only
+                std::array<std::size_t, count + 1> bucketOf{};
+                std::array<std::size_t, capacity> bucketSize{};
+                std::array<bool, count + 1> distinct{};
+                for( std::size_t i = 0; i < count; ++i )
+                {
+                    distinct[i] = true;
+                    for( std::size_t j = 0; j < i; ++j )
+                    {
+                        distinct[i] = distinct[i] && names[j] != names[i];
+                    }
+                    if( distinct[i] )
+                    {
+                        bucketOf[i] = static_cast<std::size_t>( mixHash( tagHash( names[i] ), 0 ) & mask );
+                        ++bucketSize[bucketOf[i]];
+                    }
+                }
+
+                // Largest buckets first, each with the first seed mapping its names to free slots
+                for( std::size_t size = count; size >= 2; --size )
+                {
+                    for( std::size_t bucket = 0; bucket < capacity; ++bucket )
+                    {
+                        if( bucketSize[bucket] != size )
+                        {
+                            continue;
+                        }
+                        for( std::uint64_t seed = 1;; ++seed )
+                        {
+                            std::array<std::size_t, capacity> taken = result.slots;
+                            bool placed = true;
+                            for( std::size_t i = 0; i < count && placed; ++i )
+                            {
+                                if( distinct[i] && bucketOf[i] == bucket )
+                                {
+                                    const auto slot =
+                                        static_cast<std::size_t>( mixHash( tagHash( names[i] ), seed ) & mask );
+                                    placed = taken[slot] == 0;
+                                    taken[slot] = i + 1;
+                                }
+                            }
+                            if( placed )
+                            {
+                                result.slots = taken;
+                                result.displacement[bucket] = static_cast<std::int64_t>( seed );
+                                break;
+                            }
+                        }
+                    }
+                }
+
+                // Single names take any free slot, stored directly
+                std::size_t freeSlot = 0;
+                for( std::size_t i = 0; i < count; ++i )
+                {
+                    if( distinct[i] && bucketSize[bucketOf[i]] == 1 )
+                    {
+                        while( result.slots[freeSlot] != 0 )
+                        {
+                            ++freeSlot;
+                        }
+                        result.slots[freeSlot] = i + 1;
+                        result.displacement[bucketOf[i]] = -static_cast<std::int64_t>( freeSlot + 1 );
+                    }
+                }
+                return result;
+            }();
+
+            /**
+             * @brief Find the enumerator of a name
+             * @param name Name read from JSON
+             * @return Enumerator index, or std::nullopt for an unknown name
+             */
+            static constexpr std::optional<std::size_t> find( std::string_view name ) noexcept
+            {
+                const std::uint64_t hash = tagHash( name );
+                const std::int64_t displacement =
+                    table.displacement[static_cast<std::size_t>( mixHash( hash, 0 ) & ( capacity - 1 ) )];
+                if( displacement == 0 )
+                {
+                    return std::nullopt;
+                }
+
+                const std::size_t slot =
+                    displacement < 0
+                        ? static_cast<std::size_t>( -displacement - 1 )
+                        : static_cast<std::size_t>( mixHash( hash, static_cast<std::uint64_t>( displacement ) ) &
+                                                    ( capacity - 1 ) );
+                const std::size_t entry = table.slots[slot];
+                if( entry == 0 || names[entry - 1] != name )
+                {
+                    return std::nullopt;
+                }
+                return entry - 1;
+            }
+        };
+
+        /**
+         * @brief Type trait to detect if a type is std::optional
+         * @tparam T The type to check
+         * @details Base template that evaluates to false. Specialized for std::optional<T>.
+         */
+        template <typename T>
+        struct is_optional : std::false_type
+        {
+        };
+
+        /** @brief Specialization for std::optional */
+        template <typename T>
+        struct is_optional<std::optional<T>> : std::true_type
+        {
+        };
+
+        /**
+         * @brief Type trait to detect if a type is a smart pointer
+         * @tparam T The type to check
+         * @details Base template that evaluates to false. Specialized for std::unique_ptr
+         *          and std::shared_ptr types.
+         */
+        template <typename T>
+        struct is_smart_pointer : std::false_type
+        {
+        };
+
+        /** @brief Specialization for std::unique_ptr */
+        template <typename T>
+        struct is_smart_pointer<std::unique_ptr<T>> : std::true_type
+        {
+        };
+
+        /** @brief Specialization for std::shared_ptr */
+        template <typename T>
+        struct is_smart_pointer<std::shared_ptr<T>> : std::true_type
+        {
+        };
+
+        /**
+         * @brief Type trait to detect std::span types
+         * @tparam T The type to check
+         * @details Base template that evaluates to false. Specialized for std::span types.
+         */
+        template <typename T>
+        struct is_span : std::false_type
+        {
+        };
+
+        /** @brief Specialization for std::span */
+        template <typename T, std::size_t Extent>
+        struct is_span<std::span<T, Extent>> : std::true_type
+        {
+        };
+
+        /**
+         * @brief Type trait to detect CachedJson wrappers
+         * @tparam T The type to check
+         * @details Base template that evaluates to false. Specialized for CachedJson<T>.
+         */
+        template <typename T>
+        struct is_cached_json : std::false_type
+        {
+        };
+
+        /** @brief Specialization for CachedJson */
+        template <typename T>
+        struct is_cached_json<CachedJson<T>> : std::true_type
+        {
+        };
+
+        /**
+         * @brief Whether an element type is a raw byte
+         * @tparam T Element type (std::uint8_t is unsigned char)
+         */
+        template <typename T>
+        inline constexpr bool is_byte_v =
+            std::is_same_v<std::remove_cv_t<T>, std::byte> || std::is_same_v<std::remove_cv_t<T>, unsigned char>;
+
+        /**
+         * @brief Type trait to detect contiguous byte containers
+         * @tparam T The type to check
+         * @details Base template that evaluates to false. Specialized for std::vector, std::array
+         *          and std::span of std::byte or unsigned char, written as base64 or hex strings.
+         */
+        template <typename T>
+        struct is_byte_container : std::false_type
+        {
+        };
+
+        /** @brief Specialization for std::vector */
+        template <typename T>
+        struct is_byte_container<std::vector<T>> : std::bool_constant<is_byte_v<T>>
+        {
+        };
+
+        /** @brief Specialization for std::array */
+        template <typename T, std::size_t N>
+        struct is_byte_container<std::array<T, N>> : std::bool_constant<is_byte_v<T>>
+        {
+        };
+
+        /** @brief Specialization for std::span */
+        template <typename T, std::size_t Extent>
+        struct is_byte_container<std::span<T, Extent>> : std::bool_constant<is_byte_v<T>>
+        {
+        };
+
+        /**
+         * @brief Type trait to detect sequence containers whose elements can be overwritten in place
+         * @tparam T The type to check
+         * @details True for containers with resize() and element references (vector, deque, list,
+         *          forward_list) of default-constructible elements. std::vector<bool> is excluded, as
+         *          its elements are proxies.
+         */
+        template <typename T>
+        struct is_resizable_sequence : std::bool_constant<requires( T& container ) {
+            container.resize( std::size_t{} );
+            requires std::is_same_v<decltype( *container.begin() ), typename T::value_type&>;
+            requires std::is_default_constructible_v<typename T::value_type>;
+        }>
+        {
+        };
+
+        //----------------------------------------------
+        // Document streaming
+        //----------------------------------------------
+
+        /**
+         * @brief Write a Document into a Builder
+         * @param doc Document to write
+         * @param builder Builder to write into
+         * @details Walks the document tree once and emits each node through the builder, so
+         *          documents produced by legacy toDocument() methods inherit the builder's
+         *          formatting options without being rendered to an intermediate string.
+         */
+        inline void writeDocument( const Document& doc, Builder& builder )
+        {
+            if( doc.isNull( "" ) )
+            {
+                builder.write( nullptr );
+            }
+            else if( auto objRef = doc.rootRef<Object>() )
+            {
+                builder.writeStartObject();
+                for( const auto& [key, valueDoc] : objRef->get() )
+                {
+                    builder.writeKey( key );
+                    writeDocument( valueDoc, builder );
+                }
+                builder.writeEndObject();
+            }
+            else if( auto arrRef = doc.rootRef<Array>() )
+            {
+                builder.writeStartArray();
+                for( const auto& elementDoc : arrRef->get() )
+                {
+                    writeDocument( elementDoc, builder );
+                }
+                builder.writeEndArray();
+            }
+            else if( auto strRef = doc.rootRef<std::string>() )
+            {
+                builder.write( std::string_view{ strRef->get() } );
+            }
+            else if( auto intRef = doc.rootRef<int64_t>() )
+            {
+                builder.write( intRef->get() );
+            }
+            else if( auto uintRef = doc.rootRef<uint64_t>() )
+            {
+                builder.write( uintRef->get() );
+            }
+            else if( auto doubleRef = doc.rootRef<double>() )
+            {
+                builder.write( doubleRef->get() );
+            }
+            else if( auto boolRef = doc.rootRef<bool>() )
+            {
+                builder.write( boolRef->get() );
+            }
+        }
+
+        /**
+         * @brief Write the members of a compact JSON object into an open object of a Builder
+         * @param json Compact JSON text produced by a Builder
+         * @param builder Builder positioned inside an open object
+         * @return False if the text is not a JSON object
+         * @details Splices each member's raw value through Builder::writeRawJson(); only keys
+         *          containing escapes are decoded, so the members are copied without a parse.
+         */
+        inline bool spliceMembers( std::string_view json, Builder& builder )
+        {
+            Scanner scanner{ json };
+            std::size_t pos = scanner.skipWhitespace( 0 );
+            if( pos >= json.size() || json[pos] != '{' )
+            {
+                return false;
+            }
+
+            pos = scanner.skipWhitespace( pos + 1 );
+            std::string key;
+            while( pos < json.size() && json[pos] == '"' )
+            {
+                const std::size_t keyEnd = scanner.skipValue( pos );
+                const std::string_view rawKey = json.substr( pos + 1, keyEnd - pos - 2 );
+                if( rawKey.find( '\\' ) == std::string_view::npos )
+                {
+                    builder.writeKey( rawKey );
+                }
+                else
+                {
+                    key.clear();
+                    char decoded[4];
+                    for( std::size_t keyPos = 0; keyPos < rawKey.size(); )
+                    {
+                        key.append( decoded, decodeJsonChar( rawKey, keyPos, decoded ) );
+                    }
+                    builder.writeKey( key );
+                }
+
+                const std::size_t valueStart = scanner.skipWhitespace( scanner.skipWhitespace( keyEnd ) + 1 );
+                const std::size_t valueEnd = scanner.skipValue( valueStart );
+                builder.writeRawJson( json.substr( valueStart, valueEnd - valueStart ) );
+
+                pos = scanner.skipWhitespace( valueEnd );
+                if( pos < json.size() && json[pos] == ',' )
+                {
+                    pos = scanner.skipWhitespace( pos + 1 );
+                }
+            }
+
+            return pos < json.size() && json[pos] == '}';
+        }
+
+        //----------------------------------------------
+        // Output size estimation
+        //----------------------------------------------
+
+        /** @brief Size assumed for user types whose traits do not provide estimateSize() */
+        inline constexpr std::size_t unknownValueSizeEstimate = 64;
+
+        /** @brief Longest shortest-round-trip double representation ("-2.2250738585072014e-308") */
+        inline constexpr std::size_t maxFloatingPointWidth = 24;
+
+        /** @brief Widest decimal representation of an integral type, sign included */
+        template <typename I>
+        inline constexpr std::size_t maxIntegralWidth = std::numeric_limits<I>::digits10 + 2;
+
+        /**
+         * @brief Exact decimal width of an unsigned integer
+         * @param value Integer as written by the Builder
+         * @return Number of characters
+         */
+        inline std::size_t decimalWidth( uint64_t value ) noexcept
+        {
+            // 10^19 is the last power of ten below 2^64: stop before the bound overflows
+            std::size_t width = 1;
+            for( uint64_t bound = 10; value >= bound; bound *= 10 )
+            {
+                if( ++width == 20 )
+                {
+                    break;
+                }
+            }
+            return width;
+        }
+
+        /**
+         * @brief Exact decimal width of a signed integer, sign included
+         * @param value Integer as written by the Builder
+         * @return Number of characters
+         */
+        inline std::size_t decimalWidth( int64_t value ) noexcept
+        {
+            const uint64_t magnitude = value < 0 ? 0 - static_cast<uint64_t>( value ) : static_cast<uint64_t>( value );
+            return decimalWidth( magnitude ) + ( value < 0 ? 1 : 0 );
+        }
+
+        /**
+         * @brief Exact width of a double as written by the Builder
+         * @param value Floating point value
+         * @return Number of characters
+         * @details Shortest round-trip form; integral values keep a ".0" suffix and non-finite
+         *          values are written as null.
+         */
+        inline std::size_t doubleWidth( double value ) noexcept
+        {
+            if( !std::isfinite( value ) )
+            {
+                return 4;
+            }
+
+            char buffer[32];
+            const auto result = std::to_chars( buffer, buffer + sizeof( buffer ), value );
+            const std::string_view text{ buffer, static_cast<std::size_t>( result.ptr - buffer ) };
+            return text.find_first_of( ".eE" ) == std::string_view::npos ? text.size() + 2 : text.size();
+        }
+
+        /**
+         * @brief Exact width of a quoted, escaped JSON string
+         * @param text UTF-8 string content
+         * @param escapeNonAscii Whether non-ASCII code points are written as \\uXXXX
+         * @return Number of characters including both quotes
+         */
+        inline std::size_t escapedWidth( std::string_view text, bool escapeNonAscii ) noexcept
+        {
+            // Output width of each ASCII byte: 2 for short escapes, 6 for other control characters
+            static constexpr std::array<std::uint8_t, 128> widths = [] {
+                std::array<std::uint8_t, 128> table{};
+                for( std::size_t c = 0; c < table.size(); ++c )
+                {
+                    table[c] = c < 0x20 ? 6 : 1;
+                }
+                for( const char c : { '"', '\\', '\b', '\f', '\n', '\r', '\t' } )
+                {
+                    table[static_cast<unsigned char>( c )] = 2;
+                }
+                return table;
+            }();
+
+            std::size_t width = 2;
+            for( std::size_t i = 0; i < text.size(); ++i )
+            {
+                const auto c = static_cast<unsigned char>( text[i] );
+                if( c < 0x80 )
+                {
+                    width += widths[c];
+                }
+                else if( !escapeNonAscii )
+                {
+                    ++width;
+                }
+                else
+                {
+                    // One \\uXXXX per UTF-16 unit: 4-byte sequences become a surrogate pair
+                    const std::size_t length = c >= 0xF0 ? 4 : ( c >= 0xE0 ? 3 : 2 );
+                    width += length == 4 ? 12 : 6;
+                    i += length - 1;
+                }
+            }
+            return width;
+        }
+
+        /**
+         * @brief Whether the exact length of a type can be computed without writing it
+         * @tparam U Type to check
+         * @return False if the type contains user types or internally tagged variants, which are
+         *         measured by serializing them into a scratch builder
+         */
+        template <typename U>
+        consteval bool isMeasurable()
+        {
+            constexpr auto allMeasurable =
+                []<template <typename...> class C, typename... Ts>( std::type_identity<C<Ts...>> ) {
+                    return ( isMeasurable<Ts>() && ... );
+                };
+
+            if constexpr( has_streaming_serialization_v<U> )
+            {
+                return false;
+            }
+            else if constexpr( std::is_arithmetic_v<U> || std::is_enum_v<U> || std::is_same_v<U, std::string> ||
+                               std::is_same_v<U, std::string_view> || std::is_same_v<U, InternedString> ||
+                               std::is_same_v<U, std::shared_ptr<const std::string>> )
+            {
+                return true;
+            }
+            else if constexpr( is_optional<U>::value || is_cached_json<U>::value )
+            {
+                return isMeasurable<typename U::value_type>();
+            }
+            else if constexpr( is_smart_pointer<U>::value )
+            {
+                return isMeasurable<typename U::element_type>();
+            }
+            else if constexpr( is_tuple<U>::value || is_pair<U>::value )
+            {
+                return allMeasurable( std::type_identity<U>{} );
+            }
+            else if constexpr( is_variant<U>::value )
+            {
+                return variantLayout<U>() != VariantLayout::Internal && allMeasurable( std::type_identity<U>{} );
+            }
+            else if constexpr( requires { typename U::mapped_type; } )
+            {
+                return isMeasurable<typename U::key_type>() && isMeasurable<typename U::mapped_type>();
+            }
+            else if constexpr( is_span<U>::value || is_container<U>::value )
+            {
+                return isMeasurable<std::remove_cv_t<typename U::value_type>>();
+            }
+            else
+            {
+                return false;
+            }
+        }
+
+        /**
+         * @brief Whether a type always serializes to a short JSON value
+         * @tparam U Type to check
+         * @return True for numbers, booleans and enums, bare or in std::optional, pairs and tuples
+         * @details toString() does not estimate the size of such values: reserving their few bytes
+         *          saves less than the estimate costs.
+         */
+        template <typename U>
+        consteval bool isShortScalar()
+        {
+            if constexpr( has_streaming_serialization_v<U> )
+            {
+                return false;
+            }
+            else if constexpr( std::is_arithmetic_v<U> || std::is_enum_v<U> )
+            {
+                return true;
+            }
+            else if constexpr( is_optional<U>::value )
+            {
+                return isShortScalar<typename U::value_type>();
+            }
+            else if constexpr( is_tuple<U>::value || is_pair<U>::value )
+            {
+                return []<template <typename...> class C, typename... Ts>( std::type_identity<C<Ts...>> ) {
+                    return ( isShortScalar<Ts>() && ... );
+                }( std::type_identity<U>{} );
+            }
+            else
+            {
+                return false;
+            }
+        }
+
+        /**
+         * @brief Whether a Builder can reserve its output buffer
+         * @tparam B Builder type
+         * @details False with nfx-json versions whose Builder does not expose reserve(): callers
+         *          then skip computing a size estimate, which walks the whole value.
+         */
+        template <typename B>
+        inline constexpr bool builderReserves = requires( B& builder, std::size_t capacity ) {
+            builder.reserve( capacity );
+        };
+
+        //----------------------------------------------
+        // Merge patches
+        //----------------------------------------------
+
+        /**
+         * @brief Whether operator== compares the contents of a type
+         * @tparam U Type to check
+         * @return False if the type or any element lacks operator== (standard containers declare it
+         *         unconditionally) or compares addresses (smart pointers)
+         */
+        template <typename U>
+        consteval bool isEqualityComparable()
+        {
+            constexpr auto allComparable =
+                []<template <typename...> class C, typename... Ts>( std::type_identity<C<Ts...>> ) {
+                    return ( isEqualityComparable<Ts>() && ... );
+                };
+
+            if constexpr( is_smart_pointer<U>::value || is_span<U>::value || is_cached_json<U>::value )
+            {
+                return false;
+            }
+            else if constexpr( is_optional<U>::value )
+            {
+                return isEqualityComparable<typename U::value_type>();
+            }
+            else if constexpr( is_tuple<U>::value || is_pair<U>::value || is_variant<U>::value )
+            {
+                return allComparable( std::type_identity<U>{} );
+            }
+            else if constexpr( is_container<U>::value && requires { typename U::mapped_type; } )
+            {
+                return isEqualityComparable<typename U::key_type>() && isEqualityComparable<typename U::mapped_type>();
+            }
+            else if constexpr( is_container<U>::value )
+            {
+                return isEqualityComparable<typename U::value_type>();
+            }
+            else
+            {
+                return std::equality_comparable<U>;
+            }
+        }
+
+        //----------------------------------------------
+        // Shared references
+        //----------------------------------------------
+
+        /**
+         * @brief Address identifying a pointee type without RTTI
+         * @tparam U Pointee type (without const)
+         */
+        template <typename U>
+        inline constexpr char sharedTypeTag = 0;
+
+        /**
+         * @brief Object read under a "$id", with the type it was written as
+         */
+        struct SharedReference
+        {
+            std::shared_ptr<void> object; ///< Shared pointee
+            const void* type = nullptr;   ///< sharedTypeTag of the pointee type
+        };
+
+        //----------------------------------------------
+        // Serialization context
+        //----------------------------------------------
+
+        /**
+         * @brief Per-call state of the active toString() call, visible to nested serializers and traits
+         */
+        struct SerializationContext
+        {
+            PairLayout pairLayout = PairLayout::Object; ///< Options::pairLayout of the outermost call
+            TimeFormat timeFormat = TimeFormat::Ticks;  ///< Options::timeFormat of the outermost call
+            bool preserveSharedReferences = false;      ///< Options::preserveSharedReferences of the outermost call
+
+            /** @brief Shared pointees already written, keyed by address: id and sharedTypeTag */
+            std::unordered_map<const void*, std::pair<std::uint64_t, const void*>> sharedIds{};
+
+            std::uint64_t nextSharedId = 1; ///< Id of the next first occurrence
+        };
+
+        /**
+         * @brief Get the active serialization context of the current thread
+         * @return Reference to the context pointer (nullptr outside of a serialization call)
+         */
+        inline SerializationContext*& currentSerializationContext() noexcept
+        {
+            thread_local SerializationContext* context = nullptr;
+            return context;
+        }
+
+        /**
+         * @brief RAII guard installing a serialization context for the duration of a call
+         * @details An enclosing call's context is kept, so values spliced into its output share its
+         *          reference ids and layout.
+         */
+        class SerializationScope final
+        {
+        public:
+            /**
+             * @brief Install a context unless one is active
+             * @param pairLayout Options::pairLayout
+             * @param timeFormat Options::timeFormat
+             * @param preserveSharedReferences Options::preserveSharedReferences
+             */
+            inline SerializationScope(
+                PairLayout pairLayout, TimeFormat timeFormat, bool preserveSharedReferences ) noexcept
+                : m_context{ pairLayout, timeFormat, preserveSharedReferences },
+                  m_installed{ currentSerializationContext() == nullptr }
+            {
+                if( m_installed )
+                {
+                    currentSerializationContext() = &m_context;
+                }
+            }
+
+            /** @brief Uninstall the context */
+            inline ~SerializationScope()
+            {
+                if( m_installed )
+                {
+                    currentSerializationContext() = nullptr;
+                }
+            }
+
+            SerializationScope( const SerializationScope& ) = delete;
+            SerializationScope& operator=( const SerializationScope& ) = delete;
+
+        private:
+            SerializationContext m_context; ///< State of this call
+            bool m_installed;               ///< Whether this scope installed m_context
+        };
+
+        /**
+         * @brief RAII guard giving scratch writes a context of their own
+         * @details Values written only to be compared are not part of the output: the reference ids
+         *          they assign must not count as written by the enclosing call, so they are written
+         *          without references and with the enclosing layout.
+         */
+        class DetachedSerializationScope final
+        {
+        public:
+            /** @brief Install a fresh context in place of the active one */
+            inline DetachedSerializationScope() noexcept
+                : m_outer{ currentSerializationContext() }
+            {
+                if( m_outer )
+                {
+                    m_context.pairLayout = m_outer->pairLayout;
+                    m_context.timeFormat = m_outer->timeFormat;
+                }
+                currentSerializationContext() = &m_context;
+            }
+
+            /** @brief Restore the enclosing context */
+            inline ~DetachedSerializationScope()
+            {
+                currentSerializationContext() = m_outer;
+            }
+
+            DetachedSerializationScope( const DetachedSerializationScope& ) = delete;
+            DetachedSerializationScope& operator=( const DetachedSerializationScope& ) = delete;
+
+        private:
+            SerializationContext* m_outer;  ///< Context of the enclosing call (nullptr if none)
+            SerializationContext m_context; ///< Context of the scratch writes
+        };
+
+        //----------------------------------------------
+        // Deserialization context
+        //----------------------------------------------
+
+        class PathFrame;
+
+        /**
+         * @brief Per-call state shared by all nested deserializers
+         * @details Installed by fromString() for the calling thread, so values deserialized
+         *          through nested or trait-created serializers see the same context.
+         */
+        struct DeserializationContext
+        {
+            std::string_view source;      ///< JSON input being deserialized
+            StringArena* arena = nullptr; ///< Fallback storage for escaped strings
+            StringPool* pool = nullptr;   ///< Pool for interned strings
+            StringPool callPool{};        ///< Pool for interned strings when none is configured, dropped with the call
+
+            bool throwOnError = true;          ///< Throw on failure (fromString) or record it (tryFromString)
+            ErrorCode error = ErrorCode::None; ///< First recorded failure
+
+            const PathFrame* path = nullptr; ///< Innermost array element or object member being deserialized
+            std::string errorPointer{};      ///< JSON Pointer of the first failure (rendered on failure only)
+
+            bool schemaValidated = false; ///< Inside a value already validated against an enclosing schema
+
+            bool preserveSharedReferences = false; ///< Options::preserveSharedReferences of the outermost call
+
+            /** @brief Objects read under a "$id", for resolving later "$ref"s */
+            std::unordered_map<std::uint64_t, SharedReference> sharedReferences{};
+        };
+
+        /**
+         * @brief Get the active deserialization context of the current thread
+         * @return Reference to the context pointer (nullptr outside fromString)
+         */
+        inline DeserializationContext*& currentDeserializationContext() noexcept
+        {
+            thread_local DeserializationContext* context = nullptr;
+            return context;
+        }
+
+        /**
+         * @brief RAII guard installing a deserialization context for the duration of a call
+         */
+        class DeserializationScope final
+        {
+        public:
+            /**
+             * @brief Install a context for the given input
+             * @param source JSON input buffer
+             * @param arena Storage for escaped strings (may be nullptr)
+             * @param pool Pool for interned strings (may be nullptr)
+             * @param preserveSharedReferences Options::preserveSharedReferences
+             * @param throwOnError Throw on failure, or record the failure in the context
+             */
+            inline DeserializationScope( std::string_view source, StringArena* arena, StringPool* pool,
+                bool preserveSharedReferences, bool throwOnError = true ) noexcept
+                : m_context{ source, arena, pool },
+                  m_previous{ currentDeserializationContext() }
+            {
+                m_context.throwOnError = throwOnError;
+                m_context.preserveSharedReferences = preserveSharedReferences;
+                currentDeserializationContext() = &m_context;
+            }
+
+            /** @brief Restore the previously active context */
+            inline ~DeserializationScope()
+            {
+                currentDeserializationContext() = m_previous;
+            }
+
+            DeserializationScope( const DeserializationScope& ) = delete;
+            DeserializationScope& operator=( const DeserializationScope& ) = delete;
+
+            /**
+             * @brief Get the installed context
+             * @return Context for this call
+             */
+            inline DeserializationContext& context() noexcept
+            {
+                return m_context;
+            }
+
+        private:
+            DeserializationContext m_context;   ///< Context for this call
+            DeserializationContext* m_previous; ///< Context of an enclosing call, if any
+        };
+
+        //----------------------------------------------
+        // Error reporting
+        //----------------------------------------------
+
+        /**
+         * @brief Throw a std::runtime_error, or abort when exceptions are disabled
+         * @param message Error message
+         */
+        [[noreturn]] inline void throwRuntimeError( std::string message )
+        {
+#if NFX_SERIALIZATION_HAS_EXCEPTIONS
+            throw std::runtime_error{ std::move( message ) };
+#else
+            std::fputs( message.c_str(), stderr );
+            std::fputc( '\n', stderr );
+            std::abort();
+#endif
+        }
+
+        /**
+         * @brief One level of the path to the value being deserialized
+         * @details Frames live on the call stack of the container being deserialized and are
+         *          chained through the context, so tracking the location costs a pointer swap per
+         *          container and a store per element. Keys are views into the parsed document;
+         *          nothing is allocated until a failure renders the chain as a JSON Pointer.
+         */
+        class PathFrame final
+        {
+        public:
+            /** @brief Push an (empty) frame onto the path of the active context */
+            inline PathFrame() noexcept
+                : m_context{ currentDeserializationContext() }
+            {
+                if( m_context )
+                {
+                    m_parent = m_context->path;
+                    m_context->path = this;
+#if NFX_SERIALIZATION_HAS_EXCEPTIONS
+                    m_uncaught = m_context->throwOnError ? 0 : std::uncaught_exceptions();
+#endif
+                }
+            }
+
+            /** @brief Pop the frame, capturing the path first if a foreign exception unwinds it */
+            inline ~PathFrame();
+
+            PathFrame( const PathFrame& ) = delete;
+            PathFrame& operator=( const PathFrame& ) = delete;
+
+            /**
+             * @brief Point the frame at an array element
+             * @param index Index of the element about to be deserialized
+             */
+            inline void at( std::size_t index ) noexcept
+            {
+                m_key = {};
+                m_index = index;
+                m_isKey = false;
+                m_valueLocated = false;
+            }
+
+            /**
+             * @brief Point the frame at an object member
+             * @param key Key of the member about to be deserialized (must outlive the frame's use)
+             */
+            inline void at( std::string_view key ) noexcept
+            {
+                m_key = key;
+                m_isKey = true;
+                m_valueLocated = false;
+            }
+
+            /**
+             * @brief Locate the value the frame points at in the input
+             * @param scanner Scanner over the input of the active context
+             * @return Offset of the first byte of the value, or std::string_view::npos
+             * @details Located on demand and cached: enclosing frames are located first, and each
+             *          lookup resumes from the previous sibling, so values read in document order
+             *          are found with a single structural pass over each container.
+             */
+            inline std::size_t valueOffset( Scanner& scanner ) const noexcept;
+
+            /**
+             * @brief Render the path ending at a frame as a JSON Pointer
+             * @param innermost Innermost frame (nullptr for the root)
+             * @return RFC 6901 pointer, e.g. "/users/3/name"
+             */
+            inline static std::string render( const PathFrame* innermost )
+            {
+                std::vector<const PathFrame*> frames;
+                for( const PathFrame* frame = innermost; frame; frame = frame->m_parent )
+                {
+                    frames.push_back( frame );
+                }
+
+                std::string pointer;
+                for( auto it = frames.rbegin(); it != frames.rend(); ++it )
+                {
+                    const PathFrame& frame = **it;
+                    pointer += '/';
+                    if( !frame.m_isKey )
+                    {
+                        pointer += std::to_string( frame.m_index );
+                        continue;
+                    }
+
+                    // RFC 6901 escaping: '~' -> "~0", '/' -> "~1"
+                    for( const char c : frame.m_key )
+                    {
+                        if( c == '~' )
+                        {
+                            pointer += "~0";
+                        }
+                        else if( c == '/' )
+                        {
+                            pointer += "~1";
+                        }
+                        else
+                        {
+                            pointer += c;
+                        }
+                    }
+                }
+
+                return pointer;
+            }
+
+        private:
+            DeserializationContext* m_context;   ///< Context the frame is pushed on (nullptr if none)
+            const PathFrame* m_parent = nullptr; ///< Enclosing frame
+            std::string_view m_key{};            ///< Member key (when m_isKey)
+            std::size_t m_index = 0;             ///< Element index (when !m_isKey)
+            bool m_isKey = false;                ///< Whether the frame points at a member or an element
+
+            mutable std::size_t m_container = std::string_view::npos; ///< Offset of the enclosing array or object
+            mutable std::size_t m_resume = std::string_view::npos;    ///< Offset of the last located element or key
+            mutable std::size_t m_resumeIndex = 0;                    ///< Index of the element at m_resume
+            mutable std::size_t m_value = std::string_view::npos;     ///< Offset of the current value
+            mutable bool m_containerLocated = false;                  ///< Whether m_container is computed
+            mutable bool m_valueLocated = false;                      ///< Whether m_value is computed
+#if NFX_SERIALIZATION_HAS_EXCEPTIONS
+            int m_uncaught = 0; ///< Exceptions in flight on entry (recording mode only)
+#endif
+        };
+
+        inline std::size_t PathFrame::valueOffset( Scanner& scanner ) const noexcept
+        {
+            if( m_valueLocated )
+            {
+                return m_value;
+            }
+            m_valueLocated = true;
+            m_value = std::string_view::npos;
+
+            if( !m_containerLocated )
+            {
+                m_containerLocated = true;
+                m_container = m_parent ? m_parent->valueOffset( scanner ) : scanner.skipWhitespace( 0 );
+            }
+
+            const std::string_view json = scanner.source();
+            if( m_container >= json.size() )
+            {
+                return m_value;
+            }
+
+            if( !m_isKey )
+            {
+                if( json[m_container] != '[' )
+                {
+                    return m_value;
+                }
+
+                // Resume from the previous element when reading forwards
+                std::size_t pos = m_resume;
+                std::size_t index = m_resumeIndex;
+                if( pos == std::string_view::npos || index > m_index )
+                {
+                    pos = scanner.skipWhitespace( m_container + 1 );
+                    index = 0;
+                    if( pos >= json.size() || json[pos] == ']' )
+                    {
+                        return m_value;
+                    }
+                }
+
+                for( ; index < m_index; ++index )
+                {
+                    pos = scanner.skipWhitespace( scanner.skipValue( pos ) );
+                    if( pos >= json.size() || json[pos] != ',' )
+                    {
+                        return m_value;
+                    }
+                    pos = scanner.skipWhitespace( pos + 1 );
+                }
+
+                m_resume = pos;
+                m_resumeIndex = m_index;
+                m_value = pos;
+                return m_value;
+            }
+
+            if( json[m_container] != '{' )
+            {
+                return m_value;
+            }
+
+            // Walk members from a key until the key matches, the object ends or stop is reached
+            const auto find = [&]( std::size_t pos, std::size_t stop ) noexcept {
+                while( pos < json.size() && json[pos] == '"' && pos != stop )
+                {
+                    const std::size_t keyEnd = scanner.skipValue( pos );
+                    if( keyEnd == std::string_view::npos )
+                    {
+                        break;
+                    }
+                    std::size_t value = scanner.skipWhitespace( keyEnd );
+                    if( value >= json.size() || json[value] != ':' )
+                    {
+                        break;
+                    }
+                    value = scanner.skipWhitespace( value + 1 );
+
+                    if( keyEquals( json.substr( pos + 1, keyEnd - pos - 2 ), m_key ) )
+                    {
+                        m_resume = pos;
+                        return value;
+                    }
+
+                    pos = scanner.skipWhitespace( scanner.skipValue( value ) );
+                    if( pos >= json.size() || json[pos] != ',' )
+                    {
+                        break;
+                    }
+                    pos = scanner.skipWhitespace( pos + 1 );
+                }
+                return std::string_view::npos;
+            };
+
+            // Resume from the previous member, then wrap around to the members before it
+            const std::size_t first = scanner.skipWhitespace( m_container + 1 );
+            if( m_resume == std::string_view::npos )
+            {
+                m_value = find( first, std::string_view::npos );
+            }
+            else if( m_value = find( m_resume, std::string_view::npos ); m_value == std::string_view::npos )
+            {
+                m_value = find( first, m_resume );
+            }
+
+            return m_value;
+        }
+
+        /**
+         * @brief Locate a JSON Pointer in the input of a context
+         * @param context Context holding the input
+         * @param pointer JSON Pointer of the value
+         * @return Byte offset of the value, or std::string_view::npos if it cannot be located
+         */
+        inline std::size_t locateOffset( const DeserializationContext& context, std::string_view pointer )
+        {
+            if( const auto located = Scanner{ context.source }.locate( pointer ) )
+            {
+                return static_cast<std::size_t>( located->data() - context.source.data() );
+            }
+
+            return std::string_view::npos;
+        }
+
+        /**
+         * @brief Report a deserialization failure
+         * @tparam Message String type, or callable returning the message
+         * @param code Error code recorded by tryFromString()
+         * @param message Message thrown by fromString(); a callable is only invoked when throwing
+         * @details In a non-throwing context only the first code and its JSON Pointer are recorded
+         *          and the caller is expected to return; the message is never built. A thrown message
+         *          is suffixed with the location of the failing value, e.g. " at /users/3/age (offset 812)".
+         */
+        template <typename Message>
+        inline void reportError( ErrorCode code, Message&& message )
+        {
+            DeserializationContext* context = currentDeserializationContext();
+            if( context && !context->throwOnError )
+            {
+                if( context->error == ErrorCode::None )
+                {
+                    context->error = code;
+                    context->errorPointer = PathFrame::render( context->path );
+                }
+                return;
+            }
+
+            std::string text;
+            if constexpr( std::is_invocable_v<Message> )
+            {
+                text = std::forward<Message>( message )();
+            }
+            else
+            {
+                text = std::string{ std::forward<Message>( message ) };
+            }
+
+            if( context && context->path )
+            {
+                const std::string pointer = PathFrame::render( context->path );
+                text += " at ";
+                text += pointer;
+
+                if( const std::size_t offset = locateOffset( *context, pointer ); offset != std::string_view::npos )
+                {
+                    text += " (offset " + std::to_string( offset ) + ")";
+                }
+            }
+
+            throwRuntimeError( std::move( text ) );
+        }
+
+        inline PathFrame::~PathFrame()
+        {
+            if( !m_context )
+            {
+                return;
+            }
+
+#if NFX_SERIALIZATION_HAS_EXCEPTIONS
+            // A trait threw: keep the location for tryFromString(), which reports it as ErrorCode::Custom
+            if( !m_context->throwOnError && m_context->error == ErrorCode::None &&
+                m_context->errorPointer.empty() && std::uncaught_exceptions() > m_uncaught )
+            {
+                m_context->errorPointer = render( this );
+            }
+#endif
+            m_context->path = m_parent;
+        }
+
+        /**
+         * @brief Check whether a failure has been recorded in the active context
+         * @return True once reportError() recorded a failure (never in throwing mode)
+         */
+        inline bool deserializationFailed() noexcept
+        {
+            const DeserializationContext* context = currentDeserializationContext();
+            return context && context->error != ErrorCode::None;
+        }
+
+        /**
+         * @brief Build the error for the failure recorded in a context
+         * @param context Context holding the failure
+         * @return Error with JSON Pointer and byte offset of the failing value
+         * @details Runs only after a failure: the offset is found by locating the recorded
+         *          pointer in the source with a Scanner.
+         */
+        inline DeserializeError makeDeserializeError( const DeserializationContext& context )
+        {
+            const std::size_t offset = locateOffset( context, context.errorPointer );
+            return DeserializeError{ context.error, context.errorPointer, offset };
+        }
+
+        /**
+         * @brief RAII guard that captures failures instead of throwing while alternatives are tried
+         * @details Used by untagged variants: each failed attempt is recorded and cleared, and the
+         *          enclosing throwing mode is restored on exit.
+         */
+        class ErrorTrap final
+        {
+        public:
+            /** @brief Switch the active context (or a local one) to recording mode */
+            inline ErrorTrap() noexcept
+                : m_context{ currentDeserializationContext() }
+            {
+                if( !m_context )
+                {
+                    m_context = &m_local;
+                    currentDeserializationContext() = &m_local;
+                }
+
+                m_throwOnError = m_context->throwOnError;
+                m_context->throwOnError = false;
+            }
+
+            /** @brief Clear a pending failure and restore the previous mode */
+            inline ~ErrorTrap()
+            {
+                reset();
+                m_context->throwOnError = m_throwOnError;
+                if( m_context == &m_local )
+                {
+                    currentDeserializationContext() = nullptr;
+                }
+            }
+
+            ErrorTrap( const ErrorTrap& ) = delete;
+            ErrorTrap& operator=( const ErrorTrap& ) = delete;
+
+            /**
+             * @brief Check whether the last attempt failed
+             * @return True if a failure was recorded since the last reset()
+             */
+            inline bool failed() const noexcept
+            {
+                return m_context->error != ErrorCode::None;
+            }
+
+            /** @brief Forget a recorded failure before the next attempt */
+            inline void reset() noexcept
+            {
+                m_context->error = ErrorCode::None;
+                m_context->errorPointer.clear();
+            }
+
+        private:
+            DeserializationContext m_local;    ///< Context used when none is active
+            DeserializationContext* m_context; ///< Context switched to recording mode
+            bool m_throwOnError = true;        ///< Mode to restore on exit
+        };
+
+        //----------------------------------------------
+        // Schema validation
+        //----------------------------------------------
+
+        /**
+         * @brief Get the validator for the schema declared by SerializationTraits<U>::schema()
+         * @tparam U Type declaring a schema
+         * @return Validator built on first use and shared by all later calls
+         */
+        template <typename U>
+        inline const SchemaValidator& schemaValidator()
+        {
+            static const SchemaValidator validator{ Document{ SerializationTraits<U>::schema() } };
+            return validator;
+        }
+
+        /**
+         * @brief Validate a value against the schema of its type
+         * @tparam U Type declaring a schema
+         * @param doc Value to validate
+         * @return True if the value is valid or already covered by an enclosing schema
+         * @details Runs nfx-json's SchemaValidator over the parsed value as its own pass, before the
+         *          deserialize walk reads it: validated reads traverse the value twice. A schema
+         *          validates the whole subtree, so values nested inside a validated value are not
+         *          validated again (see SchemaScope).
+         */
+        template <typename U>
+        inline bool validateSchema( const Document& doc )
+        {
+            const DeserializationContext* context = currentDeserializationContext();
+            if( context && context->schemaValidated )
+            {
+                return true;
+            }
+
+            const auto result = schemaValidator<U>().validate( doc );
+            if( result.isValid() ) [[likely]]
+            {
+                return true;
+            }
+
+            reportError( ErrorCode::SchemaViolation, [&result] {
+                const auto& error = result.errors().front();
+                std::string message = "Schema validation failed: " + std::string{ error.message() };
+                if( !error.path().empty() )
+                {
+                    message += " (schema path '" + std::string{ error.path() } + "')";
+                }
+                return message;
+            } );
+            return false;
+        }
+
+        /**
+         * @brief RAII guard marking the values below a schema-validated value as validated
+         */
+        class SchemaScope final
+        {
+        public:
+            /**
+             * @brief Mark the active context as inside a validated value
+             * @param active Whether the value was validated (an inactive scope changes nothing)
+             */
+            inline explicit SchemaScope( bool active = true ) noexcept
+                : m_context{ active ? currentDeserializationContext() : nullptr }
+            {
+                if( m_context )
+                {
+                    m_previous = m_context->schemaValidated;
+                    m_context->schemaValidated = true;
+                }
+            }
+
+            /** @brief Restore the previous state */
+            inline ~SchemaScope()
+            {
+                if( m_context )
+                {
+                    m_context->schemaValidated = m_previous;
+                }
+            }
+
+            SchemaScope( const SchemaScope& ) = delete;
+            SchemaScope& operator=( const SchemaScope& ) = delete;
+
+        private:
+            DeserializationContext* m_context; ///< Context being marked (nullptr if none)
+            bool m_previous = false;           ///< State to restore on exit
+        };
+
+        //----------------------------------------------
+        // In-place construction
+        //----------------------------------------------
+
+        /**
+         * @brief Value produced on conversion, for constructing elements directly in their storage
+         * @tparam U Type of the value
+         * @tparam Factory Callable returning U
+         * @details Passed to emplace()-style functions: the container converts it to U where the element
+         *          lives, and guaranteed copy elision lets the factory's result initialize the element
+         *          without a temporary or a move.
+         */
+        template <typename U, typename Factory>
+        struct Deferred
+        {
+            Factory factory; ///< Produces the value
+
+            /** @brief Produce the value */
+            inline operator U() const
+            {
+                return factory();
+            }
+        };
+
+        /**
+         * @brief Wrap a factory into a deferred value
+         * @tparam U Type of the value
+         * @param factory Callable returning U
+         * @return Deferred value converting to U
+         */
+        template <typename U, typename Factory>
+        inline Deferred<U, Factory> defer( Factory factory )
+        {
+            return Deferred<U, Factory>{ std::move( factory ) };
+        }
+
+        /**
+         * @brief Helper variable template for types that can only be built by a factory fromDocument()
+         * @details Such values are constructed anew instead of being deserialized into an existing object.
+         */
+        template <typename U>
+        inline constexpr bool is_factory_only_v =
+            has_factory_deserialization_v<U> &&
+            !requires( const Document& doc, U& obj ) { SerializationTraits<U>::fromDocument( doc, obj ); };
+
+        //----------------------------------------------
+        // Map keys
+        //----------------------------------------------
+
+        /**
+         * @brief Pass the JSON member name of a map key to a callable
+         * @tparam Key Map key type
+         * @param key Key to name
+         * @param function Callable taking the name as std::string_view
+         * @return Result of the callable
+         * @details String keys are passed as they are; other keys are formatted by MapKeyTraits
+         *          into a stack buffer that lives for the duration of the call.
+         */
+        template <typename Key, typename Function>
+        inline decltype( auto ) withMapKey( const Key& key, Function&& function )
+        {
+            if constexpr( is_string_map_key_v<Key> )
+            {
+                return function( std::string_view{ key } );
+            }
+            else if constexpr( std::is_convertible_v<const Key&, std::string> )
+            {
+                const std::string name( key );
+                return function( std::string_view{ name } );
+            }
+            else
+            {
+                static_assert( has_map_key_traits_v<Key>,
+                               "Map keys must be strings or have a MapKeyTraits specialization" );
+                std::array<char, MapKeyTraits<Key>::maxLength> buffer;
+                return function( MapKeyTraits<Key>::format( key, buffer ) );
+            }
+        }
+
+        /**
+         * @brief Parse a JSON member name into a map key, reporting invalid names
+         * @tparam Key Map key type (not constructible from a string)
+         * @param name Member name
+         * @param key Parsed key
+         * @return True on success
+         */
+        template <typename Key>
+        inline bool parseMapKey( const std::string& name, Key& key )
+        {
+            if( MapKeyTraits<Key>::parse( name, key ) )
+            {
+                return true;
+            }
+
+            reportError( ErrorCode::InvalidFormat,
+                         [&name] { return "Cannot parse map key from member name \"" + name + "\""; } );
+            return false;
+        }
+
+        //----------------------------------------------
+        // Key-value entries
+        //----------------------------------------------
+
+        /**
+         * @brief Get the pair layout of the active serialization call
+         * @return Options::pairLayout of the outermost toString() call, PairLayout::Object outside of one
+         * @details Used by SerializationTraits, whose serialize() does not receive the options.
+         */
+        inline PairLayout currentPairLayout() noexcept
+        {
+            const SerializationContext* context = currentSerializationContext();
+            return context ? context->pairLayout : PairLayout::Object;
+        }
+
+        /**
+         * @brief Get the time format of the active serialization call
+         * @return Options::timeFormat of the outermost toString() call, TimeFormat::Ticks outside of one
+         * @details Used by the std::chrono SerializationTraits.
+         */
+        inline TimeFormat currentTimeFormat() noexcept
+        {
+            const SerializationContext* context = currentSerializationContext();
+            return context ? context->timeFormat : TimeFormat::Ticks;
+        }
+
+        /**
+         * @brief Key and value documents of a multimap or hash map entry
+         */
+        struct KeyValueEntry
+        {
+            const Document* key = nullptr;   ///< Key document, nullptr if the entry is malformed
+            const Document* value = nullptr; ///< Value document, nullptr if the entry is malformed
+            bool compact = false;            ///< Whether the entry was a [K, V] array
+        };
+
+        /**
+         * @brief Locate the key and value of an entry in either PairLayout
+         * @param entry {"key": K, "value": V} object or [K, V] array
+         * @return Entry documents, both null if the entry has neither shape
+         * @details Members are found in a single pass without copying the documents.
+         */
+        inline KeyValueEntry findKeyValue( const Document& entry )
+        {
+            KeyValueEntry result;
+            if( const auto elements = entry.rootRef<Array>() )
+            {
+                if( elements->get().size() == 2 )
+                {
+                    auto it = elements->get().begin();
+                    result.key = &*it;
+                    result.value = &*++it;
+                    result.compact = true;
+                }
+            }
+            else if( const auto members = entry.rootRef<Object>() )
+            {
+                for( const auto& [name, member] : members->get() )
+                {
+                    if( name == "key" )
+                    {
+                        result.key = &member;
+                    }
+                    else if( name == "value" )
+                    {
+                        result.value = &member;
+                    }
+                }
+                if( !result.key || !result.value )
+                {
+                    result = {};
+                }
+            }
+            return result;
+        }
+
+        //----------------------------------------------
+        // Checked integral conversion
+        //----------------------------------------------
+
+        /**
+         * @brief Read an integral value, rejecting numbers that do not convert exactly
+         * @tparam U Target integral type (not bool)
+         * @param doc Document holding the number
+         * @param obj Target value (left unchanged on failure)
+         * @details Integer input is checked with std::in_range; floating point input must have no
+         *          fractional part and lie within [min, max + 1), compared against exact powers of two.
+         */
+        template <typename U>
+        inline void readCheckedIntegral( const Document& doc, U& obj )
+        {
+            // std::in_range only accepts standard integer types: check character types via their equivalent
+            using Checked = std::conditional_t<std::is_signed_v<U>, std::make_signed_t<U>, std::make_unsigned_t<U>>;
+
+            if( const auto signedRef = doc.rootRef<int64_t>() )
+            {
+                if( std::in_range<Checked>( signedRef->get() ) ) [[likely]]
+                {
+                    obj = static_cast<U>( signedRef->get() );
+                    return;
+                }
+            }
+            else if( const auto unsignedRef = doc.rootRef<uint64_t>() )
+            {
+                if( std::in_range<Checked>( unsignedRef->get() ) ) [[likely]]
+                {
+                    obj = static_cast<U>( unsignedRef->get() );
+                    return;
+                }
+            }
+            else if( const auto doubleRef = doc.rootRef<double>() )
+            {
+                constexpr double upper =
+                    2.0 * static_cast<double>( std::uintmax_t{ 1 } << ( std::numeric_limits<U>::digits - 1 ) );
+                constexpr double lower = std::is_signed_v<U> ? -upper : 0.0;
+
+                const double value = doubleRef->get();
+                if( value != std::trunc( value ) )
+                {
+                    reportError( ErrorCode::TypeMismatch, "Cannot deserialize fractional number as integral type" );
+                    return;
+                }
+                if( value >= lower && value < upper )
+                {
+                    obj = static_cast<U>( value );
+                    return;
+                }
+            }
+            else
+            {
+                reportError( ErrorCode::TypeMismatch, "Cannot deserialize value as integral type" );
+                return;
+            }
+
+            reportError( ErrorCode::OutOfRange, "Integer value out of range for target type" );
+        }
+
+        //----------------------------------------------
+        // Borrowed and interned strings
+        //----------------------------------------------
+
+        /**
+         * @brief Map a decoded string onto bytes of the input buffer
+         * @param value Decoded string value
+         * @return View into the input buffer, or into the arena for strings that were escaped
+         * @details The literal is located by position, from the path of the value being read. Its
+         *          bytes are used when they equal the decoded value, i.e. when it has no escape.
+         * @throws std::runtime_error if the string cannot be borrowed and no arena is available
+         *         (recorded as ErrorCode::BorrowFailed in a non-throwing context)
+         */
+        inline std::string_view borrowString( const std::string& value )
+        {
+            if( value.empty() )
+            {
+                return {};
+            }
+
+            DeserializationContext* context = currentDeserializationContext();
+            if( !context || context->source.empty() )
+            {
+                reportError( ErrorCode::BorrowFailed,
+                             "std::string_view can only be deserialized from a JSON string buffer" );
+                return {};
+            }
+
+            const std::string_view source = context->source;
+            Scanner scanner{ source };
+            const std::size_t offset =
+                context->path ? context->path->valueOffset( scanner ) : scanner.skipWhitespace( 0 );
+            if( offset < source.size() && source[offset] == '"' )
+            {
+                const std::size_t end = scanner.skipValue( offset );
+                if( end != std::string_view::npos && end - offset - 2 == value.size() &&
+                    source.compare( offset + 1, value.size(), value ) == 0 )
+                {
+                    return source.substr( offset + 1, value.size() );
+                }
+            }
+
+            if( !context->arena )
+            {
+                reportError( ErrorCode::BorrowFailed,
+                             "Cannot borrow escaped string as std::string_view without Options::stringArena" );
+                return {};
+            }
+
+            return context->arena->store( value );
+        }
+
+        /**
+         * @brief Intern a decoded string
+         * @param value Decoded string value
+         * @return Interned string from the configured pool, or from a pool shared by this call only
+         * @details Without a configured pool, equal values share storage within one call; nothing
+         *          is retained afterwards, so high-cardinality input cannot accumulate across calls.
+         */
+        inline InternedString internString( std::string_view value )
+        {
+            DeserializationContext* context = currentDeserializationContext();
+            if( !context )
+            {
+                return InternedString{ std::make_shared<const std::string>( value ) };
+            }
+
+            return ( context->pool ? *context->pool : context->callPool ).intern( value );
+        }
+
+        //----------------------------------------------
+        // Byte containers
+        //----------------------------------------------
+
+        /**
+         * @brief Write bytes as a base64 or hex string
+         * @param bytes Contents of the byte container
+         * @param format BytesFormat::Base64 or BytesFormat::Hex
+         * @param builder Output builder
+         * @details The encoding never needs escaping: the quoted text is encoded into a scratch
+         *          buffer (on the stack for small values) and written raw.
+         */
+        inline void writeBytes( std::span<const std::byte> bytes, BytesFormat format, Builder& builder )
+        {
+            const bool hex = format == BytesFormat::Hex;
+            const std::size_t length = hex ? hexEncodedLength( bytes.size() ) : base64EncodedLength( bytes.size() );
+
+            std::array<char, 256> stackBuffer;
+            std::unique_ptr<char[]> heapBuffer;
+            char* text = stackBuffer.data();
+            if( length + 2 > stackBuffer.size() )
+            {
+                heapBuffer = std::make_unique_for_overwrite<char[]>( length + 2 );
+                text = heapBuffer.get();
+            }
+
+            text[0] = '"';
+            hex ? encodeHex( bytes, text + 1 ) : encodeBase64( bytes, text + 1 );
+            text[length + 1] = '"';
+            builder.writeRawJson( std::string_view{ text, length + 2 } );
+        }
+
+        /**
+         * @brief Decode a base64 or hex string into a byte container
+         * @tparam U Byte container type (std::vector or std::array)
+         * @param text Encoded bytes
+         * @param format BytesFormat::Hex for hex, base64 otherwise
+         * @param obj Container to fill: vectors are resized and decoded into in place, arrays must
+         *            match the decoded length
+         */
+        template <typename U>
+        inline void readBytes( std::string_view text, BytesFormat format, U& obj )
+        {
+            const bool hex = format == BytesFormat::Hex;
+            const std::optional<std::size_t> size = hex ? hexDecodedLength( text ) : base64DecodedLength( text );
+            if( !size )
+            {
+                reportError( ErrorCode::InvalidFormat,
+                             hex ? "Hex string has an odd length" : "Base64 string has an invalid length" );
+                return;
+            }
+
+            if constexpr( requires { obj.resize( *size ); } )
+            {
+                obj.resize( *size );
+            }
+            else if( *size != obj.size() )
+            {
+                reportError( ErrorCode::SizeMismatch, [&] {
+                    return "Cannot decode " + std::to_string( *size ) + " bytes into std::array with " +
+                           std::to_string( obj.size() ) + " elements";
+                } );
+                return;
+            }
+
+            const std::span<std::byte> out = std::as_writable_bytes( std::span{ obj } );
+            if( !( hex ? decodeHex( text, out ) : decodeBase64( text, out ) ) )
+            {
+                reportError( ErrorCode::InvalidFormat,
+                             hex ? "Invalid character in hex string" : "Invalid character in base64 string" );
+            }
+        }
+    } // namespace detail
+
+    //=====================================================================
+    // Serializer class
+    //=====================================================================
+
+    //----------------------------------------------
+    // Serialization options and context
+    //----------------------------------------------
+
+    template <typename T>
+    template <typename U>
+    inline void Serializer<T>::Options::copyFrom( const typename Serializer<U>::Options& other )
+    {
+        includeNullFields = other.includeNullFields;
+        prettyPrint = other.prettyPrint;
+        validateOnDeserialize = other.validateOnDeserialize;
+        escapeNonAscii = other.escapeNonAscii;
+        stringArena = other.stringArena;
+        stringPool = other.stringPool;
+        variantTagFormat = other.variantTagFormat;
+        pairLayout = other.pairLayout;
+        enumFormat = other.enumFormat;
+        timeFormat = other.timeFormat;
+        bytesFormat = other.bytesFormat;
+        preserveSharedReferences = other.preserveSharedReferences;
+    }
+
+    template <typename T>
+    template <typename U>
+    inline typename Serializer<T>::Options Serializer<T>::Options::createFrom(
+        const typename Serializer<U>::Options& other )
+    {
+        Options result;
+        result.includeNullFields = other.includeNullFields;
+        result.prettyPrint = other.prettyPrint;
+        result.validateOnDeserialize = other.validateOnDeserialize;
+        result.escapeNonAscii = other.escapeNonAscii;
+        result.stringArena = other.stringArena;
+        result.stringPool = other.stringPool;
+        result.variantTagFormat = other.variantTagFormat;
+        result.pairLayout = other.pairLayout;
+        result.enumFormat = other.enumFormat;
+        result.timeFormat = other.timeFormat;
+        result.bytesFormat = other.bytesFormat;
+        result.preserveSharedReferences = other.preserveSharedReferences;
+        return result;
+    }
+
+    //----------------------------------------------
+    // Construction
+    //----------------------------------------------
+
+    template <typename T>
+    inline Serializer<T>::Serializer( const Options& options ) noexcept
+        : m_options{ options }
+    {
+    }
+
+    //----------------------------------------------
+    // Options management
+    //----------------------------------------------
+
+    template <typename T>
+    inline const Serializer<T>::Options& Serializer<T>::options() const noexcept
+    {
+        return m_options;
+    }
+
+    template <typename T>
+    inline void Serializer<T>::setOptions( const typename Serializer<T>::Options& options ) noexcept
+    {
+        m_options = options;
+    }
+
+    //----------------------------------------------
+    // Static convenience serialization methods
+    //----------------------------------------------
+
+    template <typename T>
+    inline std::string Serializer<T>::toString( const T& obj, const Serializer<T>::Options& options )
+    {
+        Serializer<T> serializer( options );
+        Builder builder( { .indent = options.prettyPrint ? 2 : 0, .escapeNonAscii = options.escapeNonAscii } );
+        detail::SerializationScope scope{ options.pairLayout, options.timeFormat, options.preserveSharedReferences };
+
+        // Size the buffer once: the length recorded for this shape, otherwise an estimate (short
+        // scalars are written without either)
+        if constexpr( detail::builderReserves<Builder> && !detail::isShortScalar<T>() )
+        {
+            const bool hinted = options.sizeHint && *options.sizeHint != 0;
+            builder.reserve( hinted ? *options.sizeHint : serializer.measureValue( obj, 0, false ) );
+        }
+        serializer.serializeValue( obj, builder );
+
+        std::string json = builder.toString();
+        if( options.sizeHint )
+        {
+            *options.sizeHint = json.size();
+        }
+
+        return json;
+    }
+
+    template <typename T>
+    inline std::size_t Serializer<T>::estimateSize( const T& obj, const Serializer<T>::Options& options )
+    {
+        // Traits estimating their size read their layout from the context, as in serializedSize()
+        detail::SerializationScope scope{ options.pairLayout, options.timeFormat, options.preserveSharedReferences };
+        return Serializer<T>( options ).measureValue( obj, 0, false );
+    }
+
+    template <typename T>
+    inline std::size_t Serializer<T>::serializedSize( const T& obj, const Serializer<T>::Options& options )
+    {
+        if( options.preserveSharedReferences )
+        {
+            // References depend on which pointees were written before: only writing tells
+            return toString( obj, options ).size();
+        }
+
+        // Traits measured by writing them read their layout from the context
+        detail::SerializationScope scope{ options.pairLayout, options.timeFormat, options.preserveSharedReferences };
+        return Serializer<T>( options ).measureValue( obj, 0, true );
+    }
+
+    template <typename T>
+    inline std::string Serializer<T>::toMergePatch(
+        const T& before, const T& after, const Serializer<T>::Options& options )
+    {
+        Serializer<T> serializer( options );
+        Builder builder( { .indent = options.prettyPrint ? 2 : 0, .escapeNonAscii = options.escapeNonAscii } );
+        detail::SerializationScope scope{ options.pairLayout, options.timeFormat, options.preserveSharedReferences };
+        serializer.writeMergePatch( before, after, builder );
+
+        return builder.toString();
+    }
+
+    template <typename T>
+    inline T Serializer<T>::fromString( std::string_view jsonStr, const Serializer<T>::Options& options )
+    {
+        Serializer<T> serializer( options );
+        detail::DeserializationScope scope{
+            jsonStr, options.stringArena, options.stringPool, options.preserveSharedReferences };
+        auto optDoc = Document::fromString( jsonStr );
+        if( !optDoc )
+        {
+            detail::throwRuntimeError( "Failed to parse JSON string" );
+        }
+
+        // SFINAE dispatch: factory vs mutable deserialization
+        if constexpr( detail::has_factory_deserialization_v<T> )
+        {
+            // Option A: Factory deserialization (works with deleted default ctors)
+            if constexpr( detail::has_schema_v<T> )
+            {
+                if( options.validateOnDeserialize )
+                {
+                    detail::validateSchema<T>( *optDoc );
+                }
+            }
+
+            detail::SchemaScope schemaScope{ detail::has_schema_v<T> && options.validateOnDeserialize };
+            return SerializationTraits<T>::fromDocument( *optDoc );
+        }
+        else
+        {
+            // Option B: Mutable deserialization (requires default ctor)
+            T obj{};
+            serializer.deserializeValue( *optDoc, obj );
+            return obj;
+        }
+    }
+
+    template <typename T>
+    inline void Serializer<T>::deserializeInto(
+        std::string_view jsonStr, T& obj, const Serializer<T>::Options& options )
+    {
+        Serializer<T> serializer( options );
+        detail::DeserializationScope scope{
+            jsonStr, options.stringArena, options.stringPool, options.preserveSharedReferences };
+        auto optDoc = Document::fromString( jsonStr );
+        if( !optDoc )
+        {
+            detail::throwRuntimeError( "Failed to parse JSON string" );
+        }
+
+        if constexpr( detail::has_factory_deserialization_v<T> )
+        {
+            // Factory types can only be replaced as a whole
+            if constexpr( detail::has_schema_v<T> )
+            {
+                if( options.validateOnDeserialize )
+                {
+                    detail::validateSchema<T>( *optDoc );
+                }
+            }
+
+            detail::SchemaScope schemaScope{ detail::has_schema_v<T> && options.validateOnDeserialize };
+            obj = SerializationTraits<T>::fromDocument( *optDoc );
+        }
+        else
+        {
+            serializer.deserializeValue( *optDoc, obj );
+        }
+    }
+
+    template <typename T>
+    inline DeserializeResult<T> Serializer<T>::tryFromString(
+        std::string_view jsonStr, const Serializer<T>::Options& options )
+    {
+        detail::DeserializationScope scope{
+            jsonStr, options.stringArena, options.stringPool, options.preserveSharedReferences, false };
+        auto optDoc = Document::fromString( jsonStr );
+        if( !optDoc )
+        {
+            return DeserializeError{ ErrorCode::InvalidJson };
+        }
+
+#if NFX_SERIALIZATION_HAS_EXCEPTIONS
+        // User traits may still throw (any std::exception): report them as ErrorCode::Custom
+        try
+        {
+#endif
+            if constexpr( detail::has_factory_deserialization_v<T> )
+            {
+                if constexpr( detail::has_schema_v<T> )
+                {
+                    if( options.validateOnDeserialize && !detail::validateSchema<T>( *optDoc ) )
+                    {
+                        return detail::makeDeserializeError( scope.context() );
+                    }
+                }
+
+                detail::SchemaScope schemaScope{ detail::has_schema_v<T> && options.validateOnDeserialize };
+                T obj = SerializationTraits<T>::fromDocument( *optDoc );
+                if( scope.context().error == ErrorCode::None )
+                {
+                    return DeserializeResult<T>{ std::move( obj ) };
+                }
+            }
+            else
+            {
+                Serializer<T> serializer( options );
+                T obj{};
+                serializer.deserializeValue( *optDoc, obj );
+                if( scope.context().error == ErrorCode::None )
+                {
+                    return DeserializeResult<T>{ std::move( obj ) };
+                }
+            }
+#if NFX_SERIALIZATION_HAS_EXCEPTIONS
+        }
+        catch( const std::exception& )
+        {
+            scope.context().error = ErrorCode::Custom;
+        }
+#endif
+
+        return detail::makeDeserializeError( scope.context() );
+    }
+
+    template <typename T>
+    inline T Serializer<T>::fromStringAt(
+        std::string_view jsonStr, std::string_view pointer, const Serializer<T>::Options& options )
+    {
+        Scanner scanner{ jsonStr };
+        return fromStringAt( scanner, pointer, options );
+    }
+
+    template <typename T>
+    inline T Serializer<T>::fromStringAt(
+        Scanner& scanner, std::string_view pointer, const Serializer<T>::Options& options )
+    {
+        const auto located = scanner.locate( pointer );
+        if( !located )
+        {
+            detail::throwRuntimeError( "JSON pointer '" + std::string{ pointer } + "' does not resolve to a value" );
+        }
+
+        return fromString( *located, options );
+    }
+
+    template <typename T>
+    inline void Serializer<T>::applyMergePatch(
+        std::string_view patchJson, T& obj, const Serializer<T>::Options& options )
+    {
+        Serializer<T> serializer( options );
+        detail::DeserializationScope scope{
+            patchJson, options.stringArena, options.stringPool, options.preserveSharedReferences };
+        auto optDoc = Document::fromString( patchJson );
+        if( !optDoc )
+        {
+            detail::throwRuntimeError( "Failed to parse JSON merge patch" );
+        }
+
+        serializer.applyPatchValue( *optDoc, obj );
+    }
+
+    //----------------------------------------------
+    // Private methods
+    //----------------------------------------------
+
+    template <typename T>
+    template <typename U>
+    inline void Serializer<T>::serializeValue( const U& obj, Builder& builder ) const
+    {
+        // Priority order (performance-optimized):
+        // 1. SerializationTraits::serialize() - optimal streaming serialization
+        // 2. Built-in types - efficient direct serialization
+        // 3. Custom toDocument() - user override (performance hit: Document → JSON → Builder)
+
+        // Fast path
+        if constexpr( detail::has_streaming_serialization_v<U> )
+        {
+            SerializationTraits<U>::serialize( obj, builder );
+            return;
+        }
+
+        // Byte containers: one base64 or hex string instead of an array of numbers
+        if constexpr( !detail::has_streaming_serialization_v<U> && detail::is_byte_container<U>::value )
+        {
+            if( m_options.bytesFormat != BytesFormat::Array )
+            {
+                detail::writeBytes( std::as_bytes( std::span{ obj } ), m_options.bytesFormat, builder );
+                return;
+            }
+        }
+
+        // Handle built-in types with library-defined logic
+        if constexpr( std::is_same_v<U, bool> )
+        {
+            // Handle bool separately (before is_integral check)
+            builder.write( obj );
+        }
+        else if constexpr( std::is_integral_v<U> )
+        {
+            // Handle integral types (int, long, etc.): unsigned values above INT64_MAX stay positive
+            if constexpr( std::is_signed_v<U> )
+            {
+                builder.write( static_cast<int64_t>( obj ) );
+            }
+            else
+            {
+                builder.write( static_cast<uint64_t>( obj ) );
+            }
+        }
+        else if constexpr( std::is_floating_point_v<U> )
+        {
+            // Handle floating point types
+            builder.write( static_cast<double>( obj ) );
+        }
+        else if constexpr( std::is_enum_v<U> )
+        {
+            // Handle enumerations: pre-escaped name literals, flag sets as arrays of names,
+            // unnamed values and EnumFormat::Integer as the underlying value
+            using Table = detail::EnumTable<U>;
+            using Underlying = std::underlying_type_t<U>;
+
+            if( m_options.enumFormat == EnumFormat::Integer )
+            {
+                serializeValue( static_cast<Underlying>( obj ), builder );
+            }
+            else if constexpr( Table::flags )
+            {
+                builder.writeStartArray();
+                const Underlying remainder =
+                    Table::decompose( obj, [&builder]( std::size_t index ) { Table::write( index, builder ); } );
+                if( remainder != 0 )
+                {
+                    serializeValue( remainder, builder );
+                }
+                builder.writeEndArray();
+            }
+            else if( const auto index = Table::indexOf( obj ) )
+            {
+                Table::write( *index, builder );
+            }
+            else
+            {
+                serializeValue( static_cast<Underlying>( obj ), builder );
+            }
+        }
+        else if constexpr( std::is_same_v<U, std::string> || std::is_same_v<U, std::string_view> )
+        {
+            // Handle std::string and std::string_view
+            builder.write( obj );
+        }
+        else if constexpr( std::is_same_v<U, InternedString> )
+        {
+            // Handle interned strings
+            builder.write( obj.view() );
+        }
+        else if constexpr( std::is_same_v<U, std::shared_ptr<const std::string>> )
+        {
+            // Handle shared immutable strings
+            if( obj )
+            {
+                builder.write( *obj );
+            }
+            else
+            {
+                builder.write( nullptr );
+            }
+        }
+        else if constexpr( detail::is_cached_json<U>::value )
+        {
+            if( m_options.prettyPrint || m_options.preserveSharedReferences )
+            {
+                // Indentation depends on the nesting depth, which the builder does not expose,
+                // and reference ids on what the enclosing output has already written
+                serializeValue( obj.value(), builder );
+            }
+            else
+            {
+                builder.writeRawJson( obj.fragment( fragmentFormat(), [&] {
+                    Builder fragmentBuilder( { .indent = 0, .escapeNonAscii = m_options.escapeNonAscii } );
+                    serializeValue( obj.value(), fragmentBuilder );
+                    return fragmentBuilder.toString();
+                } ) );
+            }
+        }
+        else if constexpr( detail::is_optional<U>::value )
+        {
+            if( obj.has_value() )
+            {
+                serializeValue( obj.value(), builder );
+            }
+            else
+            {
+                builder.write( nullptr );
+            }
+        }
+        else if constexpr( detail::is_smart_pointer<U>::value )
+        {
+            if( !obj )
+            {
+                builder.write( nullptr );
+                return;
+            }
+
+            if constexpr( !std::is_same_v<U, std::unique_ptr<typename U::element_type>> )
+            {
+                // Pointee owned elsewhere too: written once under an id, referenced afterwards
+                detail::SerializationContext* context = detail::currentSerializationContext();
+                if( context && context->preserveSharedReferences && obj.use_count() > 1 )
+                {
+                    const void* type = &detail::sharedTypeTag<std::remove_const_t<typename U::element_type>>;
+                    const auto [it, inserted] =
+                        context->sharedIds.try_emplace( obj.get(), context->nextSharedId, type );
+                    if( inserted )
+                    {
+                        // Registered before the contents, so a cycle back to it writes a "$ref"
+                        builder.writeStartObject();
+                        builder.write( "$id", context->nextSharedId++ );
+                        builder.writeKey( "$value" );
+                        serializeValue( *obj, builder );
+                        builder.writeEndObject();
+                        return;
+                    }
+                    if( it->second.second == type )
+                    {
+                        builder.writeStartObject();
+                        builder.write( "$ref", it->second.first );
+                        builder.writeEndObject();
+                        return;
+                    }
+                    // Same address seen as another type (e.g. a first member): written in full
+                }
+            }
+
+            serializeValue( *obj, builder );
+        }
+        else if constexpr( detail::is_span<U>::value )
+        {
+            // Handle std::span - serialize as array (serialization only, no deserialization)
+            // Note: std::span is a non-owning view, cannot deserialize into it directly
+            // Users should deserialize to std::vector and create span from it if needed
+            builder.writeStartArray();
+            for( const auto& item : obj )
+            {
+                serializeValue( item, builder );
+            }
+            builder.writeEndArray();
+        }
+        else if constexpr( detail::is_tuple<U>::value )
+        {
+            // Handle std::tuple - serialize as array [elem0, elem1, ...]
+            builder.writeStartArray();
+            std::apply(
+                [&]( const auto&... elems ) {
+                    ( serializeValue( elems, builder ), ... ); // fold expression
+                },
+                obj );
+            builder.writeEndArray();
+        }
+        else if constexpr( detail::is_variant<U>::value )
+        {
+            // Handle std::variant - layout selected by VariantTraits (default {"tag": ..., "data": ...})
+            // Uses std::visit to dispatch to the active alternative
+            constexpr VariantLayout layout = detail::variantLayout<U>();
+
+            std::visit(
+                [&]( const auto& value ) {
+                    if constexpr( layout == VariantLayout::Adjacent )
+                    {
+                        builder.writeStartObject();
+                        builder.writeKey( "tag" );
+                        serializeVariantTag( obj, builder );
+                        builder.writeKey( "data" );
+                        serializeValue( value, builder );
+                        builder.writeEndObject();
+                    }
+                    else if constexpr( layout == VariantLayout::External )
+                    {
+                        // {"Name": value} - index tags become decimal keys
+                        builder.writeStartObject();
+                        if( detail::variantTagFormat<U>( m_options.variantTagFormat ) == VariantTagFormat::Index )
+                        {
+                            builder.writeKey( std::to_string( obj.index() ) );
+                        }
+                        else
+                        {
+                            builder.writeKey( detail::variantTagNameAt<U>( obj.index() ) );
+                        }
+                        serializeValue( value, builder );
+                        builder.writeEndObject();
+                    }
+                    else if constexpr( layout == VariantLayout::Internal )
+                    {
+                        // {"type": "Name", ...fields}: the tag, then the alternative's members in the same object
+                        builder.writeStartObject();
+                        builder.writeKey( detail::variantTagKey<U>() );
+                        serializeVariantTag( obj, builder );
+                        serializeMembers( value, builder );
+                        builder.writeEndObject();
+                    }
+                    else
+                    {
+                        // Untagged: the bare alternative value
+                        serializeValue( value, builder );
+                    }
+                },
+                obj );
+        }
+        else if constexpr( detail::is_container<U>::value )
+        {
+            // Handle std::pair - serialize as array [first, second]
+            if constexpr( detail::is_pair<U>::value )
+            {
+                builder.writeStartArray();
+                serializeValue( obj.first, builder );
+                serializeValue( obj.second, builder );
+                builder.writeEndArray();
+            }
+            // Handle std::multimap/std::unordered_multimap - serialize as array of {"key": K, "value": V}
+            // (or of [K, V] with PairLayout::Array)
+            else if constexpr( detail::is_multimap<U>::value || detail::is_unordered_multimap<U>::value )
+            {
+                const bool compact = m_options.pairLayout == PairLayout::Array;
+                builder.writeStartArray();
+
+                for( const auto& pair : obj )
+                {
+                    if( compact )
+                    {
+                        builder.writeStartArray();
+                        serializeValue( pair.first, builder );
+                        serializeValue( pair.second, builder );
+                        builder.writeEndArray();
+                    }
+                    else
+                    {
+                        builder.writeStartObject();
+                        builder.writeKey( "key" );
+                        serializeValue( pair.first, builder );
+                        builder.writeKey( "value" );
+                        serializeValue( pair.second, builder );
+                        builder.writeEndObject();
+                    }
+                }
+
+                builder.writeEndArray();
+            }
+            // Handle std::multiset/std::unordered_multiset - serialize as array (allows duplicates)
+            else if constexpr( detail::is_multiset<U>::value || detail::is_unordered_multiset<U>::value )
+            {
+                builder.writeStartArray();
+
+                for( const auto& item : obj )
+                {
+                    serializeValue( item, builder );
+                }
+
+                builder.writeEndArray();
+            }
+            else if constexpr( requires { typename U::mapped_type; } )
+            {
+                // Map-like containers (std::map, std::unordered_map) - serialize as JSON object
+                builder.writeStartObject();
+
+                for( const auto& pair : obj )
+                {
+                    detail::withMapKey( pair.first, [&builder]( std::string_view key ) { builder.writeKey( key ); } );
+                    serializeValue( pair.second, builder );
+                }
+
+                builder.writeEndObject();
+            }
+            else
+            {
+                // Sequence containers - serialize as JSON array
+                builder.writeStartArray();
+
+                for( const auto& item : obj )
+                {
+                    serializeValue( item, builder );
+                }
+
+                builder.writeEndArray();
+            }
+        }
+        else
+        {
+            // User-defined types - check for custom toDocument() method first
+            if constexpr( detail::has_toDocument_method<U>::value )
+            {
+                // Custom toDocument() method - performance hit (Document → Builder)
+                // NOTE: For better performance, implement SerializationTraits::serialize() instead
+                // Create a properly-typed serializer for this object
+                typename Serializer<U>::Options objOptions;
+                objOptions.template copyFrom<T>( m_options );
+                Serializer<U> objSerializer( objOptions );
+
+                Document tempDoc;
+                tempDoc.set<nfx::json::Object>( "" );
+                obj.toDocument( objSerializer, tempDoc );
+
+                // Stream the document straight into the builder (no intermediate JSON string)
+                detail::writeDocument( tempDoc, builder );
+            }
+            // NOTE: No fallback to SerializationTraits::toDocument() - all types must either:
+            //       - Have SerializationTraits::serialize() (checked above)
+            //       - Have custom toDocument() method (checked above)
+            //       - Be built-in types (checked above)
+            // If none match, compilation will fail (by design)
+        }
+    }
+
+    template <typename T>
+    template <typename U>
+    inline void Serializer<T>::serializeMembers( const U& obj, Builder& builder ) const
+    {
+        if constexpr( detail::has_member_serialization_v<U> )
+        {
+            SerializationTraits<U>::serializeMembers( obj, builder );
+        }
+        else if constexpr( !detail::has_streaming_serialization_v<U> && detail::is_container<U>::value &&
+                           requires { typename U::mapped_type; } && !detail::is_multimap<U>::value &&
+                           !detail::is_unordered_multimap<U>::value )
+        {
+            for( const auto& pair : obj )
+            {
+                detail::withMapKey( pair.first, [&builder]( std::string_view key ) { builder.writeKey( key ); } );
+                serializeValue( pair.second, builder );
+            }
+        }
+        else if constexpr( !detail::has_streaming_serialization_v<U> && detail::has_toDocument_method<U>::value )
+        {
+            // Legacy toDocument(): replay the document's members, nothing is rendered
+            typename Serializer<U>::Options objOptions;
+            objOptions.template copyFrom<T>( m_options );
+            Serializer<U> objSerializer( objOptions );
+
+            Document tempDoc;
+            tempDoc.set<nfx::json::Object>( "" );
+            obj.toDocument( objSerializer, tempDoc );
+
+            const auto object = tempDoc.template rootRef<Object>();
+            if( !object )
+            {
+                detail::throwRuntimeError( "Internally tagged variant alternative must serialize as a JSON object" );
+            }
+
+            for( const auto& [key, member] : object->get() )
+            {
+                builder.writeKey( key );
+                detail::writeDocument( member, builder );
+            }
+        }
+        else
+        {
+            // Render the object compactly once; compact output splices its members' raw JSON straight
+            // into the destination, pretty output replays them so that they follow its indentation
+            Builder objectBuilder( { .indent = 0, .escapeNonAscii = m_options.escapeNonAscii } );
+            serializeValue( obj, objectBuilder );
+            const std::string json = objectBuilder.toString();
+
+            if( !m_options.prettyPrint )
+            {
+                if( !detail::spliceMembers( json, builder ) )
+                {
+                    detail::throwRuntimeError(
+                        "Internally tagged variant alternative must serialize as a JSON object" );
+                }
+                return;
+            }
+
+            const auto doc = Document::fromString( json );
+            const auto object = doc ? doc->template rootRef<Object>() : std::nullopt;
+            if( !object )
+            {
+                detail::throwRuntimeError( "Internally tagged variant alternative must serialize as a JSON object" );
+            }
+
+            for( const auto& [key, member] : object->get() )
+            {
+                builder.writeKey( key );
+                detail::writeDocument( member, builder );
+            }
+        }
+    }
+
+    template <typename T>
+    template <typename U>
+    inline std::size_t Serializer<T>::measureValue( const U& obj, std::size_t depth, bool exact ) const
+    {
+        // Mirrors serializeValue(). Brackets, separators and pretty-print layout are always counted
+        // exactly; exact mode also formats numbers, scans strings for escapes and measures user types
+        // by writing them, estimate mode uses upper bounds and unescaped lengths instead
+        const bool pretty = m_options.prettyPrint;
+        const bool escapeNonAscii = m_options.escapeNonAscii;
+        const std::size_t keyOverhead = pretty ? 4 : 3; // quotes, colon and space
+
+        // Object or array of count members at the given depth, content excluding separators
+        const auto composite = [pretty]( std::size_t at, std::size_t count, std::size_t content ) -> std::size_t {
+            if( count == 0 )
+            {
+                return 2;
+            }
+            const std::size_t newlines = pretty ? count * ( 1 + 2 * ( at + 1 ) ) + 1 + 2 * at : 0;
+            return 2 + content + ( count - 1 ) + newlines;
+        };
+        const auto stringWidth = [&]( std::string_view text ) {
+            return exact ? detail::escapedWidth( text, escapeNonAscii ) : text.size() + 2;
+        };
+        const auto keyWidth = [&]( std::string_view key ) { return stringWidth( key ) - 2 + keyOverhead; };
+
+        if constexpr( !detail::has_streaming_serialization_v<U> && detail::is_byte_container<U>::value )
+        {
+            if( m_options.bytesFormat == BytesFormat::Hex )
+            {
+                return hexEncodedLength( obj.size() ) + 2;
+            }
+            if( m_options.bytesFormat == BytesFormat::Base64 )
+            {
+                return base64EncodedLength( obj.size() ) + 2;
+            }
+        }
+
+        if constexpr( detail::has_streaming_serialization_v<U> )
+        {
+            if( exact )
+            {
+                return measureWritten( obj, depth );
+            }
+            if constexpr( detail::has_size_estimate_v<U> )
+            {
+                return SerializationTraits<U>::estimateSize( obj );
+            }
+            return detail::unknownValueSizeEstimate;
+        }
+        else if constexpr( std::is_same_v<U, bool> )
+        {
+            return exact && obj ? 4 : 5;
+        }
+        else if constexpr( std::is_integral_v<U> )
+        {
+            if constexpr( std::is_signed_v<U> )
+            {
+                return exact ? detail::decimalWidth( static_cast<int64_t>( obj ) ) : detail::maxIntegralWidth<U>;
+            }
+            else
+            {
+                return exact ? detail::decimalWidth( static_cast<uint64_t>( obj ) ) : detail::maxIntegralWidth<U>;
+            }
+        }
+        else if constexpr( std::is_floating_point_v<U> )
+        {
+            return exact ? detail::doubleWidth( static_cast<double>( obj ) ) : detail::maxFloatingPointWidth;
+        }
+        else if constexpr( std::is_enum_v<U> )
+        {
+            using Table = detail::EnumTable<U>;
+            using Underlying = std::underlying_type_t<U>;
+
+            if( m_options.enumFormat == EnumFormat::Integer )
+            {
+                return measureValue( static_cast<Underlying>( obj ), depth, exact );
+            }
+            else if constexpr( Table::flags )
+            {
+                // ["Name", ..., remainder]
+                std::size_t count = 0;
+                std::size_t content = 0;
+                const Underlying remainder = Table::decompose( obj, [&]( std::size_t index ) {
+                    ++count;
+                    content += stringWidth( Table::names[index] );
+                } );
+                if( remainder != 0 )
+                {
+                    ++count;
+                    content += measureValue( remainder, depth + 1, exact );
+                }
+                return composite( depth, count, content );
+            }
+            else if( const auto index = Table::indexOf( obj ) )
+            {
+                return stringWidth( Table::names[*index] );
+            }
+            else
+            {
+                return measureValue( static_cast<Underlying>( obj ), depth, exact );
+            }
+        }
+        else if constexpr( std::is_same_v<U, std::string> || std::is_same_v<U, std::string_view> )
+        {
+            return stringWidth( obj );
+        }
+        else if constexpr( std::is_same_v<U, InternedString> )
+        {
+            return stringWidth( obj.view() );
+        }
+        else if constexpr( std::is_same_v<U, std::shared_ptr<const std::string>> )
+        {
+            return obj ? stringWidth( *obj ) : 4;
+        }
+        else if constexpr( detail::is_optional<U>::value || detail::is_smart_pointer<U>::value )
+        {
+            return obj ? measureValue( *obj, depth, exact ) : 4;
+        }
+        else if constexpr( detail::is_cached_json<U>::value )
+        {
+            const std::string* cached = pretty ? nullptr : obj.cachedFragment( fragmentFormat() );
+            return cached ? cached->size() : measureValue( obj.value(), depth, exact );
+        }
+        else if constexpr( detail::is_tuple<U>::value )
+        {
+            return std::apply(
+                [&]( const auto&... elems ) {
+                    const std::size_t content = ( std::size_t{ 0 } + ... + measureValue( elems, depth + 1, exact ) );
+                    return composite( depth, sizeof...( elems ), content );
+                },
+                obj );
+        }
+        else if constexpr( detail::is_variant<U>::value )
+        {
+            constexpr VariantLayout layout = detail::variantLayout<U>();
+
+            if constexpr( layout == VariantLayout::Internal )
+            {
+                // The alternative's members share the tag's object: only writing tells the exact size
+                if( exact )
+                {
+                    return measureWritten( obj, depth );
+                }
+            }
+
+            const bool indexTags =
+                detail::variantTagFormat<U>( m_options.variantTagFormat ) == VariantTagFormat::Index;
+            const std::string_view name = detail::variantTagNameAt<U>( obj.index() );
+            const std::size_t index = exact ? detail::decimalWidth( static_cast<int64_t>( obj.index() ) )
+                                            : detail::maxIntegralWidth<std::size_t>;
+
+            const std::size_t innerDepth = layout == VariantLayout::Untagged ? depth : depth + 1;
+            const std::size_t value = std::visit(
+                [&]( const auto& alternative ) { return measureValue( alternative, innerDepth, exact ); }, obj );
+
+            if constexpr( layout == VariantLayout::Adjacent )
+            {
+                const std::size_t tag = indexTags ? index : stringWidth( name );
+                return composite( depth, 2, keyWidth( "tag" ) + tag + keyWidth( "data" ) + value );
+            }
+            else if constexpr( layout == VariantLayout::External )
+            {
+                const std::size_t tagKey = indexTags ? index + keyOverhead : keyWidth( name );
+                return composite( depth, 1, tagKey + value );
+            }
+            else if constexpr( layout == VariantLayout::Internal )
+            {
+                const std::size_t tag = indexTags ? index : stringWidth( name );
+                return keyWidth( detail::variantTagKey<U>() ) + tag + 1 + value;
+            }
+            else
+            {
+                return value;
+            }
+        }
+        else if constexpr( detail::is_pair<U>::value )
+        {
+            return composite(
+                depth, 2, measureValue( obj.first, depth + 1, exact ) + measureValue( obj.second, depth + 1, exact ) );
+        }
+        else if constexpr( detail::is_multimap<U>::value || detail::is_unordered_multimap<U>::value )
+        {
+            // [{"key": K, "value": V}, ...] or [[K, V], ...]
+            const std::size_t names =
+                m_options.pairLayout == PairLayout::Array ? 0 : keyWidth( "key" ) + keyWidth( "value" );
+            std::size_t count = 0;
+            std::size_t content = 0;
+            for( const auto& pair : obj )
+            {
+                ++count;
+                content += composite( depth + 1,
+                                      2,
+                                      names + measureValue( pair.first, depth + 2, exact ) +
+                                          measureValue( pair.second, depth + 2, exact ) );
+            }
+            return composite( depth, count, content );
+        }
+        else if constexpr( detail::is_span<U>::value || detail::is_container<U>::value )
+        {
+            if constexpr( !requires { typename U::mapped_type; } &&
+                          std::is_arithmetic_v<std::remove_cv_t<typename U::value_type>> &&
+                          requires { obj.size(); } )
+            {
+                if( !exact )
+                {
+                    // Every number has the same bound: the estimate needs the count, not a walk
+                    const std::size_t count = obj.size();
+                    const std::size_t bound = measureValue( typename U::value_type{}, depth + 1, false );
+                    return composite( depth, count, count * bound );
+                }
+            }
+
+            std::size_t count = 0;
+            std::size_t content = 0;
+            for( const auto& item : obj )
+            {
+                ++count;
+                if constexpr( requires { typename U::mapped_type; } )
+                {
+                    using Key = std::remove_cvref_t<decltype( item.first )>;
+                    if constexpr( !detail::is_string_map_key_v<Key> && detail::has_map_key_traits_v<Key> )
+                    {
+                        // Estimates take the bound instead of formatting every key
+                        content += exact ? detail::withMapKey( item.first, keyWidth )
+                                         : MapKeyTraits<Key>::maxLength + keyOverhead;
+                    }
+                    else
+                    {
+                        content += detail::withMapKey( item.first, keyWidth );
+                    }
+                    content += measureValue( item.second, depth + 1, exact );
+                }
+                else
+                {
+                    content += measureValue( item, depth + 1, exact );
+                }
+            }
+            return composite( depth, count, content );
+        }
+        else
+        {
+            // Legacy toDocument() types
+            if( exact )
+            {
+                return measureWritten( obj, depth );
+            }
+            if constexpr( detail::has_size_estimate_v<U> )
+            {
+                return SerializationTraits<U>::estimateSize( obj );
+            }
+            return detail::unknownValueSizeEstimate;
+        }
+    }
+
+    template <typename T>
+    template <typename U>
+    inline std::size_t Serializer<T>::measureWritten( const U& obj, std::size_t depth ) const
+    {
+        Builder scratch( { .indent = m_options.prettyPrint ? 2 : 0, .escapeNonAscii = m_options.escapeNonAscii } );
+        serializeValue( obj, scratch );
+        const std::string json = scratch.toString();
+
+        // Newlines only come from pretty-printing (escaped inside strings); each continuation line is
+        // indented by the enclosing depth as well
+        const auto lines = static_cast<std::size_t>( std::count( json.begin(), json.end(), '\n' ) );
+        return json.size() + lines * 2 * depth;
+    }
+
+    template <typename T>
+    inline std::uint64_t Serializer<T>::fragmentFormat() const noexcept
+    {
+        // Every option that changes compact output selects its own cached fragment
+        const auto field = []( auto format, unsigned shift ) {
+            return static_cast<std::uint64_t>( format ) << shift;
+        };
+        return field( m_options.escapeNonAscii, 0 ) | field( m_options.includeNullFields, 1 ) |
+               field( m_options.variantTagFormat, 8 ) | field( m_options.pairLayout, 16 ) |
+               field( m_options.enumFormat, 24 ) | field( m_options.timeFormat, 32 ) |
+               field( m_options.bytesFormat, 40 );
+    }
+
+    template <typename T>
+    template <typename U>
+    inline void Serializer<T>::writeMergePatch( const U& before, const U& after, Builder& builder ) const
+    {
+        if constexpr( detail::has_merge_patch_writer_v<U> )
         {
-            // Handle floating point types
-            builder.write( static_cast<double>( obj ) );
+            // User types list their members
+            builder.writeStartObject();
+            MergePatchWriter patch( builder, m_options );
+            SerializationTraits<U>::writeMergePatch( before, after, patch );
+            builder.writeEndObject();
         }
-        else if constexpr( std::is_same_v<U, std::string> )
+        else if constexpr( detail::is_cached_json<U>::value )
         {
-            // Handle std::string
-            builder.write( obj );
+            writeMergePatch( before.value(), after.value(), builder );
         }
-        else if constexpr( detail::is_optional<U>::value )
+        else if constexpr( detail::is_optional<U>::value || detail::is_smart_pointer<U>::value )
         {
-            if( obj.has_value() )
+            // Present on both sides: diff the contents, otherwise the new value (or null) replaces it
+            if( before && after )
             {
-                serializeValue( obj.value(), builder );
+                writeMergePatch( *before, *after, builder );
             }
             else
             {
-                builder.write( nullptr );
+                serializeValue( after, builder );
             }
         }
-        else if constexpr( detail::is_smart_pointer<U>::value )
+        else if constexpr( !detail::has_streaming_serialization_v<U> && detail::is_container<U>::value &&
+                           !detail::is_multimap<U>::value && !detail::is_unordered_multimap<U>::value &&
+                           requires { typename U::mapped_type; } )
         {
-            if( obj )
+            // JSON objects: removed keys become null, added keys are written whole, changed ones diffed
+            const auto writeKey = [&builder]( const auto& key ) {
+                detail::withMapKey( key, [&builder]( std::string_view name ) { builder.writeKey( name ); } );
+            };
+
+            builder.writeStartObject();
+            if constexpr( requires { typename U::key_compare; } )
             {
-                serializeValue( *obj, builder );
+                // Ordered maps: a single merge walk over both sides
+                const auto less = before.key_comp();
+                auto previous = before.begin();
+                auto current = after.begin();
+                while( previous != before.end() || current != after.end() )
+                {
+                    if( current == after.end() ||
+                        ( previous != before.end() && less( previous->first, current->first ) ) )
+                    {
+                        writeKey( previous->first );
+                        builder.write( nullptr );
+                        ++previous;
+                    }
+                    else if( previous == before.end() || less( current->first, previous->first ) )
+                    {
+                        writeKey( current->first );
+                        serializeValue( current->second, builder );
+                        ++current;
+                    }
+                    else
+                    {
+                        if( !sameValue( previous->second, current->second ) )
+                        {
+                            writeKey( current->first );
+                            writeMergePatch( previous->second, current->second, builder );
+                        }
+                        ++previous;
+                        ++current;
+                    }
+                }
             }
             else
             {
-                builder.write( nullptr );
+                for( const auto& pair : before )
+                {
+                    if( after.find( pair.first ) == after.end() )
+                    {
+                        writeKey( pair.first );
+                        builder.write( nullptr );
+                    }
+                }
+                for( const auto& pair : after )
+                {
+                    const auto previous = before.find( pair.first );
+                    if( previous == before.end() )
+                    {
+                        writeKey( pair.first );
+                        serializeValue( pair.second, builder );
+                    }
+                    else if( !sameValue( previous->second, pair.second ) )
+                    {
+                        writeKey( pair.first );
+                        writeMergePatch( previous->second, pair.second, builder );
+                    }
+                }
             }
+            builder.writeEndObject();
         }
-        else if constexpr( detail::is_span<U>::value )
+        else
         {
-            // Handle std::span - serialize as array (serialization only, no deserialization)
-            // Note: std::span is a non-owning view, cannot deserialize into it directly
-            // Users should deserialize to std::vector and create span from it if needed
-            builder.writeStartArray();
-            for( const auto& item : obj )
-            {
-                serializeValue( item, builder );
-            }
-            builder.writeEndArray();
+            // Arrays, scalars and user types without writeMergePatch(): replaced whole
+            serializeValue( after, builder );
         }
-        else if constexpr( detail::is_tuple<U>::value )
+    }
+
+    template <typename T>
+    template <typename U>
+    inline bool Serializer<T>::sameValue( const U& before, const U& after ) const
+    {
+        if constexpr( detail::is_optional<U>::value || detail::is_smart_pointer<U>::value )
         {
-            // Handle std::tuple - serialize as array [elem0, elem1, ...]
-            builder.writeStartArray();
-            std::apply(
-                [&]( const auto&... elems ) {
-                    ( serializeValue( elems, builder ), ... ); // fold expression
-                },
-                obj );
-            builder.writeEndArray();
+            return before && after ? sameValue( *before, *after ) : !before && !after;
         }
-        else if constexpr( detail::is_variant<U>::value )
+        else if constexpr( detail::is_cached_json<U>::value )
         {
-            // Handle std::variant - serialize as {"tag": "TypeName", "data": value}
-            // Uses std::visit to dispatch to the active alternative
-            std::visit(
-                [&]( const auto& value ) {
-                    using ActiveType = std::decay_t<decltype( value )>;
-
-                    builder.writeStartObject();
-
-                    // Write the type tag for deserialization
-                    builder.writeKey( "tag" );
-                    builder.write( std::string( detail::type_name<ActiveType>() ) );
+            return sameValue( before.value(), after.value() );
+        }
+        else if constexpr( detail::isEqualityComparable<U>() )
+        {
+            return before == after;
+        }
+        else
+        {
+            // No usable operator==: compare the JSON both values produce, outside the output's references
+            detail::DetachedSerializationScope scope;
+            const Builder::Options compact{ .indent = 0, .escapeNonAscii = m_options.escapeNonAscii };
+            Builder beforeBuilder( compact );
+            Builder afterBuilder( compact );
+            serializeValue( before, beforeBuilder );
+            serializeValue( after, afterBuilder );
+            return beforeBuilder.toString() == afterBuilder.toString();
+        }
+    }
 
-                    // Write the actual value
-                    builder.writeKey( "data" );
-                    serializeValue( value, builder );
+    template <typename T>
+    template <typename U>
+    inline void Serializer<T>::applyPatchValue( const Document& patch, U& obj ) const
+    {
+        const auto members = patch.rootRef<Object>();
 
-                    builder.writeEndObject();
-                },
-                obj );
-        }
-        else if constexpr( detail::is_container<U>::value )
+        if constexpr( detail::has_merge_patch_reader_v<U> )
         {
-            // Handle std::pair - serialize as array [first, second]
-            if constexpr( detail::is_pair<U>::value )
+            // User types list their members
+            if( members )
             {
-                builder.writeStartArray();
-                serializeValue( obj.first, builder );
-                serializeValue( obj.second, builder );
-                builder.writeEndArray();
+                MergePatchReader reader( members->get(), m_options );
+                SerializationTraits<U>::applyMergePatch( reader, obj );
+                return;
             }
-            // Handle std::multimap/std::unordered_multimap - serialize as array of {"key": K, "value": V}
-            else if constexpr( detail::is_multimap<U>::value || detail::is_unordered_multimap<U>::value )
+        }
+        else if constexpr( detail::is_cached_json<U>::value )
+        {
+            obj.modify( [&]( typename U::value_type& value ) { applyPatchValue( patch, value ); } );
+            return;
+        }
+        else if constexpr( detail::is_optional<U>::value || detail::is_smart_pointer<U>::value )
+        {
+            // Present: patch the contents (shared pointees are updated for every owner)
+            if constexpr( !std::is_const_v<std::remove_reference_t<decltype( *obj )>> )
             {
-                builder.writeStartArray();
-
-                for( const auto& pair : obj )
+                if( obj && !patch.isNull( "" ) )
                 {
-                    builder.writeStartObject();
-                    builder.writeKey( "key" );
-                    serializeValue( pair.first, builder );
-                    builder.writeKey( "value" );
-                    serializeValue( pair.second, builder );
-                    builder.writeEndObject();
+                    applyPatchValue( patch, *obj );
+                    return;
                 }
-
-                builder.writeEndArray();
             }
-            // Handle std::multiset/std::unordered_multiset - serialize as array (allows duplicates)
-            else if constexpr( detail::is_multiset<U>::value || detail::is_unordered_multiset<U>::value )
+        }
+        else if constexpr( !detail::has_streaming_serialization_v<U> && detail::is_container<U>::value &&
+                           !detail::is_multimap<U>::value && !detail::is_unordered_multimap<U>::value &&
+                           requires {
+                               typename U::mapped_type;
+                               requires std::is_constructible_v<typename U::key_type, const std::string&> ||
+                                            detail::has_map_key_traits_v<typename U::key_type>;
+                           } )
+        {
+            // JSON objects: null erases a key, existing entries are patched, new ones inserted
+            if( members )
             {
-                builder.writeStartArray();
-
-                for( const auto& item : obj )
-                {
-                    serializeValue( item, builder );
-                }
+                const auto patchEntry = [&]( const auto& key, const Document& valueDoc ) {
+                    if( valueDoc.isNull( "" ) )
+                    {
+                        obj.erase( key );
+                        return;
+                    }
 
-                builder.writeEndArray();
-            }
-            else if constexpr( requires { typename U::mapped_type; } )
-            {
-                // Map-like containers (std::map, std::unordered_map) - serialize as JSON object
-                builder.writeStartObject();
+                    const auto [it, inserted] = obj.try_emplace( key );
+                    if( inserted )
+                    {
+                        deserializeValue( valueDoc, it->second );
+                    }
+                    else
+                    {
+                        applyPatchValue( valueDoc, it->second );
+                    }
+                };
 
-                for( const auto& pair : obj )
+                detail::PathFrame frame;
+                for( const auto& [name, valueDoc] : members->get() )
                 {
-                    std::string key;
-                    if constexpr( std::is_convertible_v<decltype( pair.first ), std::string> )
+                    frame.at( std::string_view{ name } );
+                    if constexpr( std::is_constructible_v<typename U::key_type, const std::string&> )
                     {
-                        key = std::string( pair.first );
+                        patchEntry( name, valueDoc );
                     }
                     else
                     {
-                        key = std::to_string( pair.first );
+                        typename U::key_type key{};
+                        if( !detail::parseMapKey( name, key ) )
+                        {
+                            return;
+                        }
+                        patchEntry( key, valueDoc );
+                    }
+                    if( detail::deserializationFailed() )
+                    {
+                        return;
                     }
+                }
+                return;
+            }
+        }
 
-                    builder.writeKey( key );
-                    serializeValue( pair.second, builder );
+        // Arrays, scalars and user types without applyMergePatch(): replaced in place
+        deserializeValue( patch, obj );
+    }
+
+    template <typename T>
+    template <typename U>
+    inline auto Serializer<T>::constructValue( const Document& doc ) const
+    {
+        return detail::defer<U>( [this, &doc]() -> U {
+            if constexpr( detail::has_factory_deserialization_v<U> )
+            {
+                // Same schema handling as a top-level factory type; the value is built either way
+                if constexpr( detail::has_schema_v<U> )
+                {
+                    if( m_options.validateOnDeserialize )
+                    {
+                        detail::validateSchema<U>( doc );
+                    }
                 }
 
-                builder.writeEndObject();
+                detail::SchemaScope schemaScope{ detail::has_schema_v<U> && m_options.validateOnDeserialize };
+                return SerializationTraits<U>::fromDocument( doc );
             }
             else
             {
-                // Sequence containers - serialize as JSON array
-                builder.writeStartArray();
+                U value{};
+                deserializeValue( doc, value );
+                return value;
+            }
+        } );
+    }
 
-                for( const auto& item : obj )
-                {
-                    serializeValue( item, builder );
-                }
+    template <typename T>
+    template <typename U>
+    inline bool Serializer<T>::readSharedReference( const Object& members, U& obj ) const
+    {
+        using Element = std::remove_const_t<typename U::element_type>;
 
-                builder.writeEndArray();
+        std::optional<std::uint64_t> id;
+        std::optional<std::uint64_t> ref;
+        const Document* value = nullptr;
+        for( const auto& [key, valueDoc] : members )
+        {
+            if( key == "$id" )
+            {
+                id = valueDoc.template get<std::uint64_t>( "" );
+            }
+            else if( key == "$ref" )
+            {
+                ref = valueDoc.template get<std::uint64_t>( "" );
+            }
+            else if( key == "$value" )
+            {
+                value = &valueDoc;
             }
         }
-        else
+
+        detail::DeserializationContext* context = detail::currentDeserializationContext();
+        const void* type = &detail::sharedTypeTag<Element>;
+        if( ref )
         {
-            // User-defined types - check for custom toDocument() method first
-            if constexpr( detail::has_toDocument_method<U>::value )
+            // Only ids already read resolve: a cycle back to an enclosing object is rejected
+            const detail::SharedReference* shared = nullptr;
+            if( context )
             {
-                // Custom toDocument() method - performance hit (Document → JSON → Builder)
-                // NOTE: For better performance, implement SerializationTraits::serialize() instead
-                // Create a properly-typed serializer for this object
-                typename Serializer<U>::Options objOptions;
-                objOptions.includeNullFields = m_options.includeNullFields;
-                objOptions.prettyPrint = m_options.prettyPrint;
-                objOptions.validateOnDeserialize = m_options.validateOnDeserialize;
-                Serializer<U> objSerializer( objOptions );
-
-                Document tempDoc;
-                tempDoc.set<nfx::json::Object>( "" );
-                obj.toDocument( objSerializer, tempDoc );
-
-                std::string tempJson = tempDoc.toString( m_options.prettyPrint ? 2 : 0 );
-                builder.writeRawJson( tempJson );
+                const auto it = context->sharedReferences.find( *ref );
+                if( it != context->sharedReferences.end() && it->second.type == type )
+                {
+                    shared = &it->second;
+                }
             }
-            // NOTE: No fallback to SerializationTraits::toDocument() - all types must either:
-            //       - Have SerializationTraits::serialize() (checked above)
-            //       - Have custom toDocument() method (checked above)
-            //       - Be built-in types (checked above)
-            // If none match, compilation will fail (by design)
+            if( !shared )
+            {
+                detail::reportError( ErrorCode::UnresolvedReference, [&ref] {
+                    return "Unresolved \"$ref\": " + std::to_string( *ref );
+                } );
+                return true;
+            }
+            obj = std::static_pointer_cast<Element>( shared->object );
+            return true;
         }
+        if( !id || !value )
+        {
+            return false;
+        }
+
+        detail::PathFrame frame;
+        frame.at( std::string_view{ "$value" } );
+        auto shared = std::make_shared<Element>( constructValue<Element>( *value ) );
+        if( detail::deserializationFailed() )
+        {
+            return true;
+        }
+        if( context )
+        {
+            context->sharedReferences.insert_or_assign( *id, detail::SharedReference{ shared, type } );
+        }
+        obj = std::move( shared );
+        return true;
     }
 
     template <typename T>
     template <typename U>
     inline void Serializer<T>::deserializeValue( const Document& doc, U& obj ) const
     {
+        // Byte containers: strings decode straight into the container's storage, arrays of numbers
+        // are read element by element below
+        if constexpr( !detail::has_streaming_serialization_v<U> && detail::is_byte_container<U>::value &&
+                      !detail::is_span<U>::value )
+        {
+            if( const auto text = doc.rootRef<std::string>() )
+            {
+                detail::readBytes( text->get(), m_options.bytesFormat, obj );
+                return;
+            }
+        }
+
         // Handle built-in types with library-defined logic
         if constexpr( std::is_same_v<U, bool> )
         {
             // Handle bool
             auto val = doc.get<bool>( "" );
             if( !val )
-                throw std::runtime_error{ "Cannot deserialize value as bool" };
+            {
+                detail::reportError( ErrorCode::TypeMismatch, "Cannot deserialize value as bool" );
+                return;
+            }
             obj = *val;
         }
         else if constexpr( std::is_integral_v<U> )
         {
-            // Handle integral types
+            // Handle integral types (strict range and fraction checks when validating)
+            if( m_options.validateOnDeserialize )
+            {
+                detail::readCheckedIntegral( doc, obj );
+                return;
+            }
+
+            if constexpr( std::is_unsigned_v<U> )
+            {
+                // Values above INT64_MAX are only held as uint64_t
+                if( const auto unsignedRef = doc.rootRef<uint64_t>() )
+                {
+                    obj = static_cast<U>( unsignedRef->get() );
+                    return;
+                }
+            }
+
             auto val = doc.get<int64_t>( "" );
             if( !val )
             {
-                throw std::runtime_error{ "Cannot deserialize value as integral type" };
+                detail::reportError( ErrorCode::TypeMismatch, "Cannot deserialize value as integral type" );
+                return;
             }
             obj = static_cast<U>( *val );
         }
@@ -768,16 +4045,121 @@ namespace nfx::serialization::json
             // Handle floating point types
             auto val = doc.get<double>( "" );
             if( !val )
-                throw std::runtime_error{ "Cannot deserialize value as floating point type" };
+            {
+                detail::reportError( ErrorCode::TypeMismatch, "Cannot deserialize value as floating point type" );
+                return;
+            }
             obj = static_cast<U>( *val );
         }
+        else if constexpr( std::is_enum_v<U> && !detail::has_streaming_serialization_v<U> )
+        {
+            // Handle enumerations: names through the perfect hash table, flag sets as arrays of
+            // names or values, and underlying values in either format
+            using Table = detail::EnumTable<U>;
+            using Underlying = std::underlying_type_t<U>;
+
+            if( const auto name = doc.rootRef<std::string>() )
+            {
+                const auto index = Table::find( name->get() );
+                if( !index )
+                {
+                    detail::reportError( ErrorCode::InvalidFormat, [&name] {
+                        return "Unknown " + std::string{ detail::type_name<U>() } + " enumerator \"" + name->get() +
+                               "\"";
+                    } );
+                    return;
+                }
+                obj = Table::values[*index];
+                return;
+            }
+
+            if constexpr( Table::flags )
+            {
+                if( const auto elements = doc.rootRef<Array>() )
+                {
+                    using Bits = typename Table::Bits;
+
+                    Bits bits = 0;
+                    std::size_t arrayIndex = 0;
+                    detail::PathFrame frame;
+                    for( const auto& elementDoc : elements->get() )
+                    {
+                        frame.at( arrayIndex++ );
+                        U flag{};
+                        deserializeValue( elementDoc, flag );
+                        if( detail::deserializationFailed() )
+                        {
+                            return;
+                        }
+                        bits = static_cast<Bits>( bits | static_cast<Bits>( static_cast<Underlying>( flag ) ) );
+                    }
+                    obj = static_cast<U>( static_cast<Underlying>( bits ) );
+                    return;
+                }
+            }
+
+            Underlying value{};
+            deserializeValue( doc, value );
+            if( !detail::deserializationFailed() )
+            {
+                obj = static_cast<U>( value );
+            }
+        }
         else if constexpr( std::is_same_v<U, std::string> )
         {
-            // Handle std::string
-            auto val = doc.get<std::string>( "" );
+            // Handle std::string (assigned in place, keeping the existing capacity)
+            auto val = doc.rootRef<std::string>();
             if( !val )
-                throw std::runtime_error{ "Cannot deserialize value as string" };
-            obj = *val;
+            {
+                detail::reportError( ErrorCode::TypeMismatch, "Cannot deserialize value as string" );
+                return;
+            }
+            obj.assign( val->get() );
+        }
+        else if constexpr( std::is_same_v<U, std::string_view> )
+        {
+            // Handle std::string_view (borrowed from the input buffer)
+            auto val = doc.rootRef<std::string>();
+            if( !val )
+            {
+                detail::reportError( ErrorCode::TypeMismatch, "Cannot deserialize value as string" );
+                return;
+            }
+            obj = detail::borrowString( val->get() );
+        }
+        else if constexpr( std::is_same_v<U, InternedString> )
+        {
+            // Handle interned strings (shared storage from the string pool)
+            auto val = doc.rootRef<std::string>();
+            if( !val )
+            {
+                detail::reportError( ErrorCode::TypeMismatch, "Cannot deserialize value as string" );
+                return;
+            }
+            obj = detail::internString( val->get() );
+        }
+        else if constexpr( std::is_same_v<U, std::shared_ptr<const std::string>> )
+        {
+            // Handle shared immutable strings (interned, null maps to nullptr)
+            if( doc.isNull( "" ) )
+            {
+                obj = nullptr;
+            }
+            else
+            {
+                auto val = doc.rootRef<std::string>();
+                if( !val )
+                {
+                    detail::reportError( ErrorCode::TypeMismatch, "Cannot deserialize value as string" );
+                    return;
+                }
+                obj = detail::internString( val->get() ).storage();
+            }
+        }
+        else if constexpr( detail::is_cached_json<U>::value )
+        {
+            // Replaces the value, dropping its cached fragments
+            obj.modify( [&]( typename U::value_type& value ) { deserializeValue( doc, value ); } );
         }
         else if constexpr( detail::is_optional<U>::value )
         {
@@ -788,30 +4170,73 @@ namespace nfx::serialization::json
             }
             else
             {
-                typename U::value_type value{};
-                deserializeValue( doc, value );
-                obj = std::move( value );
+                // Engaged: overwrite the existing value, otherwise build it in the optional
+                if constexpr( !detail::is_factory_only_v<typename U::value_type> )
+                {
+                    if( obj )
+                    {
+                        deserializeValue( doc, *obj );
+                        return;
+                    }
+                }
+                obj.emplace( constructValue<typename U::value_type>( doc ) );
             }
         }
         else if constexpr( detail::is_smart_pointer<U>::value )
         {
+            // Overwrite a pointee no one else sees; shared or const pointees are replaced
+            using Element = std::remove_const_t<typename U::element_type>;
+            constexpr bool isUnique = std::is_same_v<U, std::unique_ptr<typename U::element_type>>;
+
             if( doc.isNull( "" ) )
             {
                 obj = nullptr;
+                return;
             }
-            else
+
+            if constexpr( !isUnique )
+            {
+                // Read from the context: serializers created by traits carry default options
+                const detail::DeserializationContext* context = detail::currentDeserializationContext();
+                if( context ? context->preserveSharedReferences : m_options.preserveSharedReferences )
+                {
+                    if( const auto members = doc.rootRef<Object>() )
+                    {
+                        if( readSharedReference( members->get(), obj ) )
+                        {
+                            return;
+                        }
+                    }
+                }
+            }
+
+            if constexpr( !std::is_const_v<typename U::element_type> && !detail::is_factory_only_v<Element> )
             {
-                auto value = std::make_unique<typename U::element_type>();
-                deserializeValue( doc, *value );
-                if constexpr( std::is_same_v<U, std::unique_ptr<typename U::element_type>> )
+                bool exclusive = false;
+                if constexpr( isUnique )
                 {
-                    obj = std::move( value );
+                    exclusive = obj != nullptr;
                 }
                 else
                 {
-                    obj = std::shared_ptr<typename U::element_type>( value.release() );
+                    exclusive = obj.use_count() == 1;
+                }
+                if( exclusive )
+                {
+                    deserializeValue( doc, *obj );
+                    return;
                 }
             }
+
+            // Control block and pointee share one allocation
+            if constexpr( isUnique )
+            {
+                obj = std::make_unique<typename U::element_type>( constructValue<Element>( doc ) );
+            }
+            else
+            {
+                obj = std::make_shared<typename U::element_type>( constructValue<Element>( doc ) );
+            }
         }
 
         else if constexpr( detail::is_tuple<U>::value )
@@ -827,77 +4252,160 @@ namespace nfx::serialization::json
 
                     if( arr.size() != tupleSize )
                     {
-                        throw std::runtime_error{ "Cannot deserialize array with " + std::to_string( arr.size() ) +
-                                                  " elements into std::tuple with " + std::to_string( tupleSize ) +
-                                                  " elements" };
+                        detail::reportError( ErrorCode::SizeMismatch, [&] {
+                            return "Cannot deserialize array with " + std::to_string( arr.size() ) +
+                                   " elements into std::tuple with " + std::to_string( tupleSize ) + " elements";
+                        } );
+                        return;
                     }
 
-                    // Use index_sequence to deserialize each element
+                    // Use index_sequence to deserialize each element (stops at the first failure)
+                    detail::PathFrame frame;
                     [&]<std::size_t... Indices>( std::index_sequence<Indices...> ) {
-                        ( deserializeValue( arr[Indices], std::get<Indices>( obj ) ), ... );
+                        [[maybe_unused]] const auto element =
+                            [&]<std::size_t I>( std::integral_constant<std::size_t, I> ) {
+                                frame.at( I );
+                                deserializeValue( arr[I], std::get<I>( obj ) );
+                                return !detail::deserializationFailed();
+                            };
+                        static_cast<void>( ( element( std::integral_constant<std::size_t, Indices>{} ) && ... ) );
                     }( std::make_index_sequence<tupleSize>{} );
                 }
             }
             else if( !doc.isNull( "" ) )
             {
-                throw std::runtime_error{ "Cannot deserialize non-array JSON value into std::tuple" };
+                detail::reportError( ErrorCode::TypeMismatch, "Cannot deserialize non-array JSON value into std::tuple" );
             }
         }
 
         else if constexpr( detail::is_variant<U>::value )
         {
-            // Handle std::variant - expect {"tag": "TypeName", "data": value}
-            if( doc.is<Object>( "" ) )
+            // Handle std::variant - layout selected by VariantTraits (default {"tag": ..., "data": ...})
+            constexpr VariantLayout layout = detail::variantLayout<U>();
+
+            if constexpr( layout == VariantLayout::Untagged )
             {
-                auto tagOpt = doc.get<std::string>( "/tag" );
-                if( !tagOpt )
+                if constexpr( detail::has_variant_discriminator_v<U> )
                 {
-                    throw std::runtime_error{ "Variant JSON object missing 'tag' field" };
+                    const std::size_t index = static_cast<std::size_t>( VariantTraits<U>::discriminate( doc ) );
+                    if( index >= std::variant_size_v<U> )
+                    {
+                        detail::reportError( ErrorCode::UnknownVariantTag, [index] {
+                            return "Variant discriminator returned out-of-range index: " + std::to_string( index );
+                        } );
+                        return;
+                    }
+                    deserializeVariantAlternative( index, doc, obj );
                 }
-
-                auto dataDocOpt = doc.get<Document>( "/data" );
-                if( !dataDocOpt )
+                else
                 {
-                    throw std::runtime_error{ "Variant JSON object missing 'data' field" };
+                    // Trial: first alternative (in declaration order) that deserializes without error.
+                    // Failures are recorded by the trap instead of thrown, so rejected alternatives are cheap.
+                    const auto tryAlternative = [&]<std::size_t I>( std::integral_constant<std::size_t, I> ) {
+                        detail::ErrorTrap trap;
+                        using Alternative = std::variant_alternative_t<I, U>;
+#if NFX_SERIALIZATION_HAS_EXCEPTIONS
+                        // Candidates are built aside: only a successful one replaces the value
+                        std::optional<Alternative> value;
+                        try
+                        {
+                            value.emplace( constructValue<Alternative>( doc ) );
+                        }
+                        catch( const std::exception& )
+                        {
+                            return false;
+                        }
+#else
+                        std::optional<Alternative> value{ std::in_place, constructValue<Alternative>( doc ) };
+#endif
+                        if( trap.failed() )
+                        {
+                            return false;
+                        }
+
+                        obj.template emplace<I>( std::move( *value ) );
+                        return true;
+                    };
+
+                    const bool found = [&]<std::size_t... I>( std::index_sequence<I...> ) {
+                        return ( tryAlternative( std::integral_constant<std::size_t, I>{} ) || ... );
+                    }( std::make_index_sequence<std::variant_size_v<U>>{} );
+
+                    if( !found )
+                    {
+                        detail::reportError(
+                            ErrorCode::NoMatchingAlternative, "No variant alternative matches the JSON value" );
+                    }
                 }
+            }
+            else if( doc.is<Object>( "" ) )
+            {
+                if constexpr( layout == VariantLayout::Adjacent )
+                {
+                    const auto index = resolveVariantTag<U>( doc, "/tag" );
+                    if( !index )
+                    {
+                        return;
+                    }
 
-                const std::string& tag = *tagOpt;
-                const Document& dataDoc = *dataDocOpt;
+                    auto dataDocOpt = doc.get<Document>( "/data" );
+                    if( !dataDocOpt )
+                    {
+                        detail::reportError( ErrorCode::MissingField, "Variant JSON object missing 'data' field" );
+                        return;
+                    }
 
-                // Try to deserialize into each variant alternative
-                bool found = false;
-                constexpr std::size_t variantSize = std::variant_size_v<U>;
+                    detail::PathFrame frame;
+                    frame.at( std::string_view{ "data" } );
+                    deserializeVariantAlternative( *index, *dataDocOpt, obj );
+                }
+                else if constexpr( layout == VariantLayout::External )
+                {
+                    // Exactly one member: its key is the tag, its value the alternative
+                    const auto members = doc.rootRef<Object>();
+                    if( !members || members->get().size() != 1 )
+                    {
+                        detail::reportError( ErrorCode::TypeMismatch,
+                                             "Externally tagged variant must be an object with exactly one member" );
+                        return;
+                    }
 
-                // Helper lambda to try alternatives recursively
-                auto tryAlternative = [&]<std::size_t I>( auto&& self ) -> void {
-                    if constexpr( I < variantSize )
+                    const auto& [key, valueDoc] = *members->get().begin();
+                    std::optional<std::size_t> index = detail::findVariantTag<U>( key );
+                    if( !index )
                     {
-                        using AltType = std::variant_alternative_t<I, U>;
-                        if( tag == detail::type_name<AltType>() )
+                        std::size_t parsed = 0;
+                        const auto [end, ec] = std::from_chars( key.data(), key.data() + key.size(), parsed );
+                        if( ec == std::errc{} && end == key.data() + key.size() && parsed < std::variant_size_v<U> )
                         {
-                            AltType value{};
-                            deserializeValue( dataDoc, value );
-                            obj = std::move( value );
-                            found = true;
-                        }
-                        else
-                        {
-                            // Try next alternative
-                            self.template operator()<I + 1>( self );
+                            index = parsed;
                         }
                     }
-                };
-
-                tryAlternative.template operator()<0>( tryAlternative );
+                    if( !index )
+                    {
+                        detail::reportError( ErrorCode::UnknownVariantTag,
+                                             [&key] { return "Unknown variant tag: '" + std::string{ key } + "'"; } );
+                        return;
+                    }
 
-                if( !found )
+                    detail::PathFrame frame;
+                    frame.at( std::string_view{ key } );
+                    deserializeVariantAlternative( *index, valueDoc, obj );
+                }
+                else
                 {
-                    throw std::runtime_error{ "Unknown variant tag: '" + tag + "'" };
+                    // Tag and fields share one object: the alternative reads the same document
+                    static const std::string tagPath = "/" + std::string{ detail::variantTagKey<U>() };
+                    if( const auto index = resolveVariantTag<U>( doc, tagPath ) )
+                    {
+                        deserializeVariantAlternative( *index, doc, obj );
+                    }
                 }
             }
             else if( !doc.isNull( "" ) )
             {
-                throw std::runtime_error{ "Cannot deserialize non-object JSON value into std::variant" };
+                detail::reportError(
+                    ErrorCode::TypeMismatch, "Cannot deserialize non-object JSON value into std::variant" );
             }
         }
 
@@ -912,52 +4420,73 @@ namespace nfx::serialization::json
                     if( arrOpt.has_value() && arrOpt.value().size() >= 2 )
                     {
                         // Deserialize from array elements
+                        detail::PathFrame frame;
+                        frame.at( std::size_t{ 0 } );
                         deserializeValue( arrOpt.value()[0], obj.first );
+                        if( detail::deserializationFailed() )
+                        {
+                            return;
+                        }
+                        frame.at( std::size_t{ 1 } );
                         deserializeValue( arrOpt.value()[1], obj.second );
                     }
                     else if( arrOpt.has_value() )
                     {
-                        throw std::runtime_error{ "Cannot deserialize array with less than 2 elements into std::pair" };
+                        detail::reportError(
+                            ErrorCode::SizeMismatch, "Cannot deserialize array with less than 2 elements into std::pair" );
                     }
                 }
                 else if( !doc.isNull( "" ) )
                 {
-                    throw std::runtime_error{ "Cannot deserialize non-array JSON value into std::pair" };
+                    detail::reportError(
+                        ErrorCode::TypeMismatch, "Cannot deserialize non-array JSON value into std::pair" );
                 }
             }
-            // Handle std::multimap/std::unordered_multimap - expect array of {"key": K, "value": V}
+            // Handle std::multimap/std::unordered_multimap - expect array of {"key": K, "value": V} or [K, V]
             else if constexpr( detail::is_multimap<U>::value || detail::is_unordered_multimap<U>::value )
             {
                 obj.clear();
 
-                if( doc.is<Array>( "" ) )
+                if( const auto elements = doc.rootRef<Array>() )
                 {
-                    auto arrOpt = doc.get<Array>( "" );
-                    if( arrOpt.has_value() )
+                    std::size_t arrayIndex = 0;
+                    detail::PathFrame frame;
+
+                    for( const auto& elementDoc : elements->get() )
                     {
-                        for( const auto& elementDoc : arrOpt.value() )
+                        frame.at( arrayIndex++ );
+                        const detail::KeyValueEntry entry = detail::findKeyValue( elementDoc );
+                        if( !entry.key )
                         {
-                            if( elementDoc.is<Object>( "" ) )
-                            {
-                                typename U::key_type key{};
-                                typename U::mapped_type value{};
+                            continue;
+                        }
 
-                                auto keyDoc = elementDoc.get<Document>( "key" );
-                                auto valueDoc = elementDoc.get<Document>( "value" );
+                        detail::PathFrame member;
+                        entry.compact ? member.at( std::size_t{ 0 } ) : member.at( std::string_view{ "key" } );
+                        typename U::key_type key = constructValue<typename U::key_type>( *entry.key );
+                        if( detail::deserializationFailed() )
+                        {
+                            return;
+                        }
 
-                                if( keyDoc && valueDoc )
-                                {
-                                    deserializeValue( *keyDoc, key );
-                                    deserializeValue( *valueDoc, value );
-                                    obj.insert( { std::move( key ), std::move( value ) } );
-                                }
-                            }
+                        // The mapped value is built directly in the new node, linked after the
+                        // last one when the input is sorted
+                        entry.compact ? member.at( std::size_t{ 1 } ) : member.at( std::string_view{ "value" } );
+                        obj.emplace_hint( obj.end(),
+                                          std::piecewise_construct,
+                                          std::forward_as_tuple( std::move( key ) ),
+                                          std::forward_as_tuple(
+                                              constructValue<typename U::mapped_type>( *entry.value ) ) );
+                        if( detail::deserializationFailed() )
+                        {
+                            return;
                         }
                     }
                 }
                 else if( !doc.isNull( "" ) )
                 {
-                    throw std::runtime_error{ "Cannot deserialize non-array JSON value into multimap container" };
+                    detail::reportError(
+                        ErrorCode::TypeMismatch, "Cannot deserialize non-array JSON value into multimap container" );
                 }
             }
             // Handle std::multiset/std::unordered_multiset - expect array (allows duplicates)
@@ -970,17 +4499,24 @@ namespace nfx::serialization::json
                     auto arrOpt = doc.get<Array>( "" );
                     if( arrOpt.has_value() )
                     {
+                        std::size_t arrayIndex = 0;
+                        detail::PathFrame frame;
+
                         for( const auto& elementDoc : arrOpt.value() )
                         {
-                            typename U::value_type item{};
-                            deserializeValue( elementDoc, item );
-                            obj.insert( std::move( item ) );
+                            frame.at( arrayIndex++ );
+                            obj.emplace_hint( obj.end(), constructValue<typename U::value_type>( elementDoc ) );
+                            if( detail::deserializationFailed() )
+                            {
+                                return;
+                            }
                         }
                     }
                 }
                 else if( !doc.isNull( "" ) )
                 {
-                    throw std::runtime_error{ "Cannot deserialize non-array JSON value into multiset container" };
+                    detail::reportError(
+                        ErrorCode::TypeMismatch, "Cannot deserialize non-array JSON value into multiset container" );
                 }
             }
             // Handle std::array (fixed-size, no .clear() method) - special case
@@ -1001,25 +4537,36 @@ namespace nfx::serialization::json
 
                         if( arr.size() != arraySize )
                         {
-                            throw std::runtime_error{ "Cannot deserialize array with " + std::to_string( arr.size() ) +
-                                                      " elements into std::array with " + std::to_string( arraySize ) +
-                                                      " elements" };
+                            detail::reportError( ErrorCode::SizeMismatch, [&] {
+                                return "Cannot deserialize array with " + std::to_string( arr.size() ) +
+                                       " elements into std::array with " + std::to_string( arraySize ) + " elements";
+                            } );
+                            return;
                         }
 
+                        detail::PathFrame frame;
                         for( std::size_t i = 0; i < arraySize; ++i )
                         {
+                            frame.at( i );
                             deserializeValue( arr[i], obj[i] );
+                            if( detail::deserializationFailed() )
+                            {
+                                return;
+                            }
                         }
                     }
                 }
                 else if( !doc.isNull( "" ) )
                 {
-                    throw std::runtime_error{ "Cannot deserialize non-array JSON value into std::array" };
+                    detail::reportError(
+                        ErrorCode::TypeMismatch, "Cannot deserialize non-array JSON value into std::array" );
                 }
             }
             // Handle STL containers with flexible JSON input types
-            // (Skip for multimap/multiset which were already handled above)
-            else if constexpr( requires { obj.clear(); } )
+            // (Skip for multimap/multiset which were already handled above; maps and resizable
+            // sequences overwrite their existing elements below instead)
+            else if constexpr( requires { obj.clear(); } && !requires { typename U::mapped_type; } &&
+                               !detail::is_resizable_sequence<U>::value )
             {
                 obj.clear();
             }
@@ -1030,27 +4577,112 @@ namespace nfx::serialization::json
                           } )
             {
                 // Map-like containers: only accept JSON objects
-                if( doc.is<Object>( "" ) )
+                if( const auto members = doc.rootRef<Object>() )
                 {
-                    // Object → map: iterate over object fields using Object::iterator
-                    auto objOpt = doc.get<Object>( "" );
-                    if( objOpt.has_value() )
+                    using Key = typename U::key_type;
+                    constexpr bool stringKeys = std::is_constructible_v<Key, const std::string&>;
+
+                    // Object → map: entries already present are overwritten in place (keeping their
+                    // nodes and storage), missing ones inserted
+                    [[maybe_unused]] auto hint = obj.begin();
+                    const auto readEntry = [&]( const auto& key, const Document& valueDoc ) {
+                        if constexpr( std::is_default_constructible_v<typename U::mapped_type> &&
+                                      !detail::is_factory_only_v<typename U::mapped_type> &&
+                                      requires { obj.try_emplace( hint, key ); } )
+                        {
+                            // Sorted keys (as ordered maps are written) land next to the hint: the entry
+                            // after the previous one, found or linked without descending the tree
+                            const auto it = obj.try_emplace( hint, key );
+                            deserializeValue( valueDoc, it->second );
+                            hint = std::next( it );
+                        }
+                        else if constexpr( std::is_default_constructible_v<typename U::mapped_type> &&
+                                           !detail::is_factory_only_v<typename U::mapped_type> )
+                        {
+                            deserializeValue( valueDoc, obj[key] );
+                        }
+                        else
+                        {
+                            // Factory-built values are constructed directly in a fresh node
+                            if( const auto it = obj.find( key ); it != obj.end() )
+                            {
+                                obj.erase( it );
+                            }
+                            obj.try_emplace( key, constructValue<typename U::mapped_type>( valueDoc ) );
+                        }
+                    };
+
+                    detail::PathFrame frame;
+                    for( const auto& [name, valueDoc] : members->get() )
+                    {
+                        frame.at( std::string_view{ name } );
+                        if constexpr( stringKeys )
+                        {
+                            readEntry( name, valueDoc );
+                        }
+                        else
+                        {
+                            // Other keys are parsed from the member name, without a string per key
+                            Key key{};
+                            if( !detail::parseMapKey( name, key ) )
+                            {
+                                return;
+                            }
+                            readEntry( key, valueDoc );
+                        }
+                        if( detail::deserializationFailed() )
+                        {
+                            return;
+                        }
+                    }
+
+                    if constexpr( requires { obj.erase( obj.begin() ); } )
                     {
-                        for( const auto& [key, valueDoc] : objOpt.value() )
+                        if( obj.size() > members->get().size() )
                         {
-                            typename U::mapped_type value{};
-                            deserializeValue( valueDoc, value );
-                            obj[key] = std::move( value );
+                            // Shape changed: drop the entries the JSON no longer has, compared by the
+                            // names keys are written as (parsed names are formatted back to match)
+                            std::vector<std::conditional_t<stringKeys, std::string_view, std::string>> keys;
+                            keys.reserve( members->get().size() );
+                            for( const auto& member : members->get() )
+                            {
+                                if constexpr( stringKeys )
+                                {
+                                    keys.emplace_back( member.first );
+                                }
+                                else
+                                {
+                                    Key key{};
+                                    MapKeyTraits<Key>::parse( member.first, key );
+                                    detail::withMapKey( key, [&keys]( std::string_view name ) {
+                                        keys.emplace_back( name );
+                                    } );
+                                }
+                            }
+                            std::sort( keys.begin(), keys.end() );
+
+                            for( auto it = obj.begin(); it != obj.end(); )
+                            {
+                                const bool kept = detail::withMapKey( it->first, [&keys]( std::string_view name ) {
+                                    return std::binary_search( keys.begin(), keys.end(), name );
+                                } );
+                                it = kept ? std::next( it ) : obj.erase( it );
+                            }
                         }
                     }
                 }
                 else if( doc.isNull( "" ) )
                 {
                     // Handle null → empty map
+                    if constexpr( requires { obj.clear(); } )
+                    {
+                        obj.clear();
+                    }
                 }
                 else
                 {
-                    throw std::runtime_error{ "Cannot deserialize non-object JSON value into map container" };
+                    detail::reportError(
+                        ErrorCode::TypeMismatch, "Cannot deserialize non-object JSON value into map container" );
                 }
             }
 
@@ -1061,64 +4693,129 @@ namespace nfx::serialization::json
                 !detail::is_unordered_multiset<U>::value && !requires { typename U::mapped_type; } )
             {
                 // Non-map containers: accept arrays and single values
-                if( doc.is<Array>( "" ) )
+                if constexpr( detail::is_resizable_sequence<U>::value )
+                {
+                    if( const auto elements = doc.rootRef<Array>() )
+                    {
+                        // Overwrite existing elements in place, growing or shrinking only the tail
+                        obj.resize( elements->get().size() );
+
+                        auto it = obj.begin();
+                        std::size_t arrayIndex = 0;
+                        detail::PathFrame frame;
+
+                        for( const auto& elementDoc : elements->get() )
+                        {
+                            frame.at( arrayIndex++ );
+                            deserializeValue( elementDoc, *it++ );
+                            if( detail::deserializationFailed() )
+                            {
+                                return;
+                            }
+                        }
+                    }
+                    else if( doc.isNull( "" ) )
+                    {
+                        // Handle null → empty container
+                        obj.clear();
+                    }
+                    else
+                    {
+                        // Single value → container
+                        obj.resize( 1 );
+                        deserializeValue( doc, obj.front() );
+                    }
+                }
+                else if( doc.is<Array>( "" ) )
                 {
                     // Standard case: JSON array → container using Array::iterator
-                    auto arrOpt = doc.get<Array>( "" );
-                    if( arrOpt.has_value() )
+                    if( const auto elements = doc.rootRef<Array>() )
                     {
-                        Array& arr = arrOpt.value();
+                        const Array& arr = elements->get();
 
-                        if constexpr( std::is_same_v<U, std::vector<typename U::value_type>> )
+                        if constexpr( requires { obj.reserve( arr.size() ); } )
                         {
                             obj.reserve( arr.size() );
                         }
 
                         size_t arrayIndex = 0;
+                        detail::PathFrame frame;
 
-                        for( const auto& elementDoc : arr )
+                        // Singly linked lists append after their last node
+                        [[maybe_unused]] auto tail = obj.end();
+                        if constexpr( requires { obj.before_begin(); } )
                         {
-                            typename U::value_type item{};
+                            tail = obj.before_begin();
+                        }
 
-                            deserializeValue( elementDoc, item );
+                        for( const auto& elementDoc : arr )
+                        {
+                            // Elements are built directly in the container's storage
+                            const auto item = constructValue<typename U::value_type>( elementDoc );
 
-                            if constexpr( requires { obj.push_back( std::move( item ) ); } )
+                            frame.at( arrayIndex );
+                            if constexpr( requires { obj.emplace_back( item ); } )
+                            {
+                                obj.emplace_back( item );
+                            }
+                            else if constexpr( requires { obj.emplace_after( tail, item ); } )
+                            {
+                                tail = obj.emplace_after( tail, item );
+                            }
+                            else if constexpr( requires { obj.emplace_front( item ); } )
+                            {
+                                // Containers with only emplace_front - will reverse after loop
+                                obj.emplace_front( item );
+                            }
+                            else if constexpr( requires { obj.emplace_hint( obj.end(), item ); } )
+                            {
+                                // Sorted input (as ordered sets are written) is linked at the end in
+                                // constant time; out-of-order elements fall back to a regular insertion
+                                obj.emplace_hint( obj.end(), item );
+                            }
+                            else if constexpr( requires { obj.emplace( item ); } )
                             {
-                                obj.push_back( std::move( item ) );
+                                obj.emplace( item );
                             }
-                            else if constexpr( requires { obj.push_front( std::move( item ) ); } )
+                            else if constexpr( requires { obj.push_back( item ); } )
                             {
-                                // forward_list only has push_front - will reverse after loop
-                                obj.push_front( std::move( item ) );
+                                obj.push_back( item );
                             }
-                            else if constexpr( requires { obj.insert( std::move( item ) ); } )
+                            else if constexpr( requires { obj.insert( item ); } )
                             {
-                                obj.insert( std::move( item ) );
+                                obj.insert( item );
                             }
-                            else if constexpr( requires { obj.insert( obj.end(), std::move( item ) ); } )
+                            else if constexpr( requires { obj.insert( obj.end(), item ); } )
                             {
-                                obj.insert( obj.end(), std::move( item ) );
+                                obj.insert( obj.end(), item );
                             }
-                            else if constexpr( requires { obj[arrayIndex] = std::move( item ); } )
+                            else if constexpr( requires { obj[arrayIndex] = item; } )
                             {
                                 if( arrayIndex < obj.size() )
                                 {
-                                    obj[arrayIndex] = std::move( item );
+                                    obj[arrayIndex] = item;
                                 }
                             }
                             else
                             {
-                                static_assert(
-                                    std::is_void_v<U>,
-                                    "Container doesn't support push_back, push_front, insert, or indexed assignment" );
+                                static_assert( std::is_void_v<U>,
+                                               "Container doesn't support emplace, push_back, insert, or indexed "
+                                               "assignment" );
+                            }
+                            if( detail::deserializationFailed() )
+                            {
+                                return;
                             }
 
                             ++arrayIndex;
                         }
 
-                        // Reverse forward_list since we used push_front (only if no push_back available)
-                        if constexpr(
-                            !requires { obj.push_back( typename U::value_type{} ); } && requires { obj.reverse(); } )
+                        // Restore the order after emplace_front (only if no emplace_back/emplace_after available)
+                        if constexpr( !requires( typename U::value_type&& value ) {
+                                          obj.emplace_back( std::move( value ) );
+                                      } && !requires( typename U::value_type&& value ) {
+                                          obj.emplace_after( obj.before_begin(), std::move( value ) );
+                                      } && requires { obj.reverse(); } )
                         {
                             obj.reverse();
                         }
@@ -1131,20 +4828,27 @@ namespace nfx::serialization::json
                 else
                 {
                     // Single value → container
-                    typename U::value_type item{};
-                    deserializeValue( doc, item );
+                    const auto item = constructValue<typename U::value_type>( doc );
 
-                    if constexpr( std::is_same_v<U, std::vector<typename U::value_type>> )
+                    if constexpr( requires { obj.emplace_back( item ); } )
+                    {
+                        obj.emplace_back( item );
+                    }
+                    else if constexpr( requires { obj.emplace_front( item ); } )
+                    {
+                        obj.emplace_front( item );
+                    }
+                    else if constexpr( requires { obj.emplace( item ); } )
                     {
-                        obj.push_back( std::move( item ) );
+                        obj.emplace( item );
                     }
-                    else if constexpr( requires { obj.insert( std::move( item ) ); } )
+                    else if constexpr( requires { obj.insert( item ); } )
                     {
-                        obj.insert( std::move( item ) );
+                        obj.insert( item );
                     }
-                    else if constexpr( requires { obj.insert( obj.end(), std::move( item ) ); } )
+                    else if constexpr( requires { obj.insert( obj.end(), item ); } )
                     {
-                        obj.insert( obj.end(), std::move( item ) );
+                        obj.insert( obj.end(), item );
                     }
                     else
                     {
@@ -1153,10 +4857,240 @@ namespace nfx::serialization::json
                 }
             }
         }
+        else if constexpr( detail::is_factory_only_v<U> )
+        {
+            // Factory types nested in place (tuple and std::array elements) are rebuilt and assigned
+            obj = static_cast<U>( constructValue<U>( doc ) );
+        }
         else
         {
+            // Types declaring a schema are validated once, before their traits read the value
+            if constexpr( detail::has_schema_v<U> )
+            {
+                if( m_options.validateOnDeserialize )
+                {
+                    if( !detail::validateSchema<U>( doc ) )
+                    {
+                        return;
+                    }
+
+                    detail::SchemaScope schemaScope{};
+                    SerializationTraits<U>::fromDocument( doc, obj );
+                    return;
+                }
+            }
+
             // Fall back to SerializationTraits::fromDocument() (custom types: nfx extensions and user types)
             SerializationTraits<U>::fromDocument( doc, obj );
         }
     }
+
+    template <typename T>
+    template <typename U>
+    inline void Serializer<T>::serializeVariantTag( const U& obj, Builder& builder ) const
+    {
+        if( detail::variantTagFormat<U>( m_options.variantTagFormat ) == VariantTagFormat::Index )
+        {
+            builder.write( static_cast<int64_t>( obj.index() ) );
+        }
+        else
+        {
+            // No allocation: names are compile-time string views
+            builder.write( detail::variantTagNameAt<U>( obj.index() ) );
+        }
+    }
+
+    template <typename T>
+    template <typename U>
+    inline std::optional<std::size_t> Serializer<T>::resolveVariantTag( const Document& doc, std::string_view path )
+    {
+        constexpr std::size_t variantSize = std::variant_size_v<U>;
+
+        // Numeric tags index directly, names go through the compile-time hash table
+        if( auto indexOpt = doc.get<int64_t>( path ) )
+        {
+            if( *indexOpt < 0 || static_cast<std::uint64_t>( *indexOpt ) >= variantSize )
+            {
+                const int64_t index = *indexOpt;
+                detail::reportError( ErrorCode::UnknownVariantTag,
+                                     [index] { return "Variant tag index out of range: " + std::to_string( index ); } );
+                return std::nullopt;
+            }
+            return static_cast<std::size_t>( *indexOpt );
+        }
+
+        if( auto tagOpt = doc.get<std::string>( path ) )
+        {
+            const auto found = detail::findVariantTag<U>( *tagOpt );
+            if( !found )
+            {
+                detail::reportError(
+                    ErrorCode::UnknownVariantTag, [&tagOpt] { return "Unknown variant tag: '" + *tagOpt + "'"; } );
+            }
+            return found;
+        }
+
+        detail::reportError( ErrorCode::MissingField, [path] {
+            return "Variant JSON object missing '" + std::string{ path.substr( 1 ) } + "' field";
+        } );
+        return std::nullopt;
+    }
+
+    template <typename T>
+    template <typename U>
+    inline void Serializer<T>::deserializeVariantAlternative( std::size_t index, const Document& doc, U& obj ) const
+    {
+        // Dispatch through a per-alternative function table (constant time in the variant size)
+        using Loader = void ( * )( const Serializer&, const Document&, U& );
+        static constexpr auto loaders = []<std::size_t... I>( std::index_sequence<I...> ) {
+            return std::array<Loader, sizeof...( I )>{
+                +[]( const Serializer& serializer, const Document& valueDoc, U& target ) {
+                    using Alternative = std::variant_alternative_t<I, U>;
+
+                    // Same alternative: overwrite it in place, otherwise build the new one in the variant
+                    if constexpr( !detail::is_factory_only_v<Alternative> )
+                    {
+                        if( target.index() == I )
+                        {
+                            serializer.deserializeValue( valueDoc, std::get<I>( target ) );
+                            return;
+                        }
+                    }
+
+                    target.template emplace<I>( serializer.template constructValue<Alternative>( valueDoc ) );
+                }... };
+        }( std::make_index_sequence<std::variant_size_v<U>>{} );
+
+        loaders[index]( *this, doc, obj );
+    }
+
+    //=====================================================================
+    // MergePatchWriter class
+    //=====================================================================
+
+    //----------------------------------------------
+    // Construction
+    //----------------------------------------------
+
+    template <typename Options>
+    inline MergePatchWriter::MergePatchWriter( Builder& builder, const Options& options )
+        : m_builder{ builder },
+          m_includeNullFields{ options.includeNullFields },
+          m_prettyPrint{ options.prettyPrint },
+          m_escapeNonAscii{ options.escapeNonAscii },
+          m_variantTagFormat{ options.variantTagFormat },
+          m_pairLayout{ options.pairLayout },
+          m_enumFormat{ options.enumFormat },
+          m_timeFormat{ options.timeFormat },
+          m_bytesFormat{ options.bytesFormat },
+          m_preserveSharedReferences{ options.preserveSharedReferences }
+    {
+    }
+
+    //----------------------------------------------
+    // Patch members
+    //----------------------------------------------
+
+    template <typename V>
+    inline void MergePatchWriter::member( std::string_view key, const V& before, const V& after )
+    {
+        typename Serializer<V>::Options options;
+        options.includeNullFields = m_includeNullFields;
+        options.prettyPrint = m_prettyPrint;
+        options.escapeNonAscii = m_escapeNonAscii;
+        options.variantTagFormat = m_variantTagFormat;
+        options.pairLayout = m_pairLayout;
+        options.enumFormat = m_enumFormat;
+        options.timeFormat = m_timeFormat;
+        options.bytesFormat = m_bytesFormat;
+        options.preserveSharedReferences = m_preserveSharedReferences;
+
+        const Serializer<V> serializer( options );
+        if( serializer.sameValue( before, after ) )
+        {
+            return;
+        }
+
+        m_builder.writeKey( key );
+        serializer.writeMergePatch( before, after, m_builder );
+    }
+
+    inline void MergePatchWriter::removed( std::string_view key )
+    {
+        m_builder.writeKey( key );
+        m_builder.write( nullptr );
+    }
+
+    inline Builder& MergePatchWriter::builder() noexcept
+    {
+        return m_builder;
+    }
+
+    //=====================================================================
+    // MergePatchReader class
+    //=====================================================================
+
+    //----------------------------------------------
+    // Construction
+    //----------------------------------------------
+
+    template <typename Options>
+    inline MergePatchReader::MergePatchReader( const Object& patch, const Options& options )
+        : m_patch{ patch },
+          m_validateOnDeserialize{ options.validateOnDeserialize },
+          m_stringArena{ options.stringArena },
+          m_stringPool{ options.stringPool },
+          m_variantTagFormat{ options.variantTagFormat },
+          m_pairLayout{ options.pairLayout },
+          m_enumFormat{ options.enumFormat },
+          m_timeFormat{ options.timeFormat },
+          m_bytesFormat{ options.bytesFormat },
+          m_preserveSharedReferences{ options.preserveSharedReferences }
+    {
+    }
+
+    //----------------------------------------------
+    // Patch members
+    //----------------------------------------------
+
+    template <typename V>
+    inline bool MergePatchReader::member( std::string_view key, V& value )
+    {
+        // Patches are small: a linear scan beats building an index
+        for( const auto& [name, valueDoc] : m_patch )
+        {
+            if( name != key )
+            {
+                continue;
+            }
+
+            detail::PathFrame frame;
+            frame.at( std::string_view{ name } );
+            if( valueDoc.isNull( "" ) )
+            {
+                value = V{};
+                return true;
+            }
+
+            typename Serializer<V>::Options options;
+            options.validateOnDeserialize = m_validateOnDeserialize;
+            options.stringArena = m_stringArena;
+            options.stringPool = m_stringPool;
+            options.variantTagFormat = m_variantTagFormat;
+            options.pairLayout = m_pairLayout;
+            options.enumFormat = m_enumFormat;
+            options.timeFormat = m_timeFormat;
+            options.bytesFormat = m_bytesFormat;
+            options.preserveSharedReferences = m_preserveSharedReferences;
+            Serializer<V>( options ).applyPatchValue( valueDoc, value );
+            return true;
+        }
+
+        return false;
+    }
+
+    inline const Object& MergePatchReader::patch() const noexcept
+    {
+        return m_patch;
+    }
 } // namespace nfx::serialization::json
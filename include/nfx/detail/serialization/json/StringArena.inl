@@ -0,0 +1,92 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2026 nfx
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * @file StringArena.inl
+ * @brief String arena implementation file
+ */
+
+#include <cstring>
+
+namespace nfx::serialization::json
+{
+    //=====================================================================
+    // StringArena class
+    //=====================================================================
+
+    //----------------------------------------------
+    // Construction
+    //----------------------------------------------
+
+    inline StringArena::StringArena( std::size_t blockSize ) noexcept
+        : m_blockSize{ blockSize == 0 ? 1 : blockSize }
+    {
+    }
+
+    //----------------------------------------------
+    // Storage
+    //----------------------------------------------
+
+    inline std::string_view StringArena::store( std::string_view text )
+    {
+        if( text.empty() )
+        {
+            return {};
+        }
+
+        if( m_blocks.empty() || m_blocks.back().capacity - m_blockUsed < text.size() )
+        {
+            const std::size_t capacity = text.size() > m_blockSize ? text.size() : m_blockSize;
+            m_blocks.push_back( Block{ std::make_unique<char[]>( capacity ), capacity } );
+            m_blockUsed = 0;
+        }
+
+        char* destination = m_blocks.back().data.get() + m_blockUsed;
+        std::memcpy( destination, text.data(), text.size() );
+        m_blockUsed += text.size();
+        m_size += text.size();
+
+        return std::string_view{ destination, text.size() };
+    }
+
+    inline void StringArena::clear() noexcept
+    {
+        if( m_blocks.size() > 1 )
+        {
+            m_blocks.resize( 1 );
+        }
+
+        m_blockUsed = 0;
+        m_size = 0;
+    }
+
+    //----------------------------------------------
+    // Accessors
+    //----------------------------------------------
+
+    inline std::size_t StringArena::size() const noexcept
+    {
+        return m_size;
+    }
+} // namespace nfx::serialization::json
@@ -0,0 +1,159 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2026 nfx
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * @file StringPool.inl
+ * @brief String pool and interned string implementation file
+ */
+
+#include <cstring>
+
+namespace nfx::serialization::json
+{
+    //=====================================================================
+    // InternedString class
+    //=====================================================================
+
+    //----------------------------------------------
+    // Construction
+    //----------------------------------------------
+
+    inline InternedString::InternedString( std::shared_ptr<const std::string> storage ) noexcept
+        : m_storage{ std::move( storage ) }
+    {
+    }
+
+    //----------------------------------------------
+    // Accessors
+    //----------------------------------------------
+
+    inline std::string_view InternedString::view() const noexcept
+    {
+        return m_storage ? std::string_view{ *m_storage } : std::string_view{};
+    }
+
+    inline const std::shared_ptr<const std::string>& InternedString::storage() const noexcept
+    {
+        return m_storage;
+    }
+
+    inline InternedString::operator std::string_view() const noexcept
+    {
+        return view();
+    }
+
+    //----------------------------------------------
+    // Comparison
+    //----------------------------------------------
+
+    inline bool InternedString::operator==( const InternedString& other ) const noexcept
+    {
+        return m_storage == other.m_storage || view() == other.view();
+    }
+
+    inline bool InternedString::operator==( std::string_view other ) const noexcept
+    {
+        return view() == other;
+    }
+
+    inline std::strong_ordering InternedString::operator<=>( const InternedString& other ) const noexcept
+    {
+        return view() <=> other.view();
+    }
+
+    //=====================================================================
+    // StringPool class
+    //=====================================================================
+
+    //----------------------------------------------
+    // Interning
+    //----------------------------------------------
+
+    inline InternedString StringPool::intern( std::string_view text )
+    {
+        // Heterogeneous lookup: no allocation for strings already pooled
+        if( const auto it = m_strings.find( text ); it != m_strings.end() )
+        {
+            return InternedString{ it->second };
+        }
+
+        auto storage = std::make_shared<const std::string>( text );
+        m_strings.emplace( std::string_view{ *storage }, storage );
+
+        return InternedString{ std::move( storage ) };
+    }
+
+    inline void StringPool::clear() noexcept
+    {
+        m_strings.clear();
+    }
+
+    //----------------------------------------------
+    // Accessors
+    //----------------------------------------------
+
+    inline std::size_t StringPool::size() const noexcept
+    {
+        return m_strings.size();
+    }
+
+    //----------------------------------------------
+    // Hashing
+    //----------------------------------------------
+
+    inline std::size_t StringPool::Hash::operator()( std::string_view text ) const noexcept
+    {
+        constexpr std::uint64_t multiplier = 0x9E3779B97F4A7C15ULL;
+
+        std::uint64_t hash = text.size() * multiplier;
+        const char* data = text.data();
+        std::size_t remaining = text.size();
+
+        while( remaining >= 8 )
+        {
+            std::uint64_t word;
+            std::memcpy( &word, data, 8 );
+            hash = ( hash ^ word ) * multiplier;
+            hash ^= hash >> 32;
+            data += 8;
+            remaining -= 8;
+        }
+
+        if( remaining > 0 )
+        {
+            std::uint64_t word = 0;
+            std::memcpy( &word, data, remaining );
+            hash = ( hash ^ word ) * multiplier;
+        }
+
+        // Final avalanche (MurmurHash3 fmix64)
+        hash ^= hash >> 33;
+        hash *= 0xFF51AFD7ED558CCDULL;
+        hash ^= hash >> 33;
+        hash *= 0xC4CEB9FE1A85EC53ULL;
+        hash ^= hash >> 33;
+
+        return static_cast<std::size_t>( hash );
+    }
+} // namespace nfx::serialization::json
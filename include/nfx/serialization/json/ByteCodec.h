@@ -0,0 +1,157 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2026 nfx
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * @file ByteCodec.h
+ * @brief Base64 and hex encoding of binary data
+ * @details Byte containers (std::vector<std::uint8_t>, std::vector<std::byte>,
+ *          std::array<std::uint8_t, N>, ...) serialize as one base64 string (RFC 4648) instead of
+ *          an array of numbers, or as hex with BytesFormat::Hex. The codecs below do the encoding
+ *          for the serializer and for SerializationTraits that store binary members themselves.
+ *
+ *          Base64 kernels translate 12 bytes to 16 characters per step with SSSE3 (24 to 32 with
+ *          AVX2), hex kernels 16 bytes per step with SSE2; remaining bytes and other targets use
+ *          table-driven scalar code. NFX_SERIALIZATION_DISABLE_SIMD forces the scalar path.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <span>
+#include <string>
+#include <string_view>
+
+namespace nfx::serialization::json
+{
+    //=====================================================================
+    // Bytes format
+    //=====================================================================
+
+    /**
+     * @brief JSON form of byte containers
+     * @details Base64 and hex strings cannot be told apart reliably, so the reader decodes strings
+     *          in the selected encoding (base64 for BytesFormat::Array). Arrays of numbers are
+     *          accepted regardless of the option.
+     */
+    enum class BytesFormat : std::uint8_t
+    {
+        Base64 = 0, ///< Padded base64 string, "AQID" (default, 4 characters per 3 bytes)
+        Hex,        ///< Lowercase hex string, "010203" (2 characters per byte)
+        Array       ///< Array of numbers, [1,2,3]
+    };
+
+    //=====================================================================
+    // Base64
+    //=====================================================================
+
+    /**
+     * @brief Get the length of the padded base64 encoding of a byte count
+     * @param byteCount Number of bytes to encode
+     * @return Number of characters written by encodeBase64()
+     */
+    [[nodiscard]] constexpr std::size_t base64EncodedLength( std::size_t byteCount ) noexcept
+    {
+        return ( byteCount + 2 ) / 3 * 4;
+    }
+
+    /**
+     * @brief Get the number of bytes a base64 text decodes to
+     * @param text Base64 text, padded or not
+     * @return Decoded byte count, or std::nullopt if no base64 text has this length
+     * @details Only the length and padding are checked; decodeBase64() validates the characters.
+     */
+    [[nodiscard]] inline std::optional<std::size_t> base64DecodedLength( std::string_view text ) noexcept;
+
+    /**
+     * @brief Encode bytes as padded base64
+     * @param bytes Bytes to encode
+     * @param out Output buffer of at least base64EncodedLength( bytes.size() ) characters
+     */
+    inline void encodeBase64( std::span<const std::byte> bytes, char* out ) noexcept;
+
+    /**
+     * @brief Encode bytes as padded base64
+     * @param bytes Bytes to encode
+     * @return Base64 text
+     */
+    [[nodiscard]] inline std::string encodeBase64( std::span<const std::byte> bytes );
+
+    /**
+     * @brief Decode base64 text
+     * @param text Base64 text in the standard alphabet, padded or not
+     * @param out Output of exactly base64DecodedLength( text ) bytes
+     * @return False if the length does not match, the text contains characters outside the
+     *         alphabet or the final character carries bits beyond the data (contents of out are
+     *         then unspecified)
+     */
+    [[nodiscard]] inline bool decodeBase64( std::string_view text, std::span<std::byte> out ) noexcept;
+
+    //=====================================================================
+    // Hex
+    //=====================================================================
+
+    /**
+     * @brief Get the length of the hex encoding of a byte count
+     * @param byteCount Number of bytes to encode
+     * @return Number of characters written by encodeHex()
+     */
+    [[nodiscard]] constexpr std::size_t hexEncodedLength( std::size_t byteCount ) noexcept
+    {
+        return byteCount * 2;
+    }
+
+    /**
+     * @brief Get the number of bytes a hex text decodes to
+     * @param text Hex text
+     * @return Decoded byte count, or std::nullopt if the length is odd
+     */
+    [[nodiscard]] inline std::optional<std::size_t> hexDecodedLength( std::string_view text ) noexcept;
+
+    /**
+     * @brief Encode bytes as lowercase hex
+     * @param bytes Bytes to encode
+     * @param out Output buffer of at least hexEncodedLength( bytes.size() ) characters
+     */
+    inline void encodeHex( std::span<const std::byte> bytes, char* out ) noexcept;
+
+    /**
+     * @brief Encode bytes as lowercase hex
+     * @param bytes Bytes to encode
+     * @return Hex text
+     */
+    [[nodiscard]] inline std::string encodeHex( std::span<const std::byte> bytes );
+
+    /**
+     * @brief Decode hex text
+     * @param text Hex digits, either case
+     * @param out Output of exactly hexDecodedLength( text ) bytes
+     * @return False if the length does not match or the text contains a non-hex character
+     *         (contents of out are then unspecified)
+     */
+    [[nodiscard]] inline bool decodeHex( std::string_view text, std::span<std::byte> out ) noexcept;
+} // namespace nfx::serialization::json
+
+#include "nfx/detail/serialization/json/ByteCodec.inl"
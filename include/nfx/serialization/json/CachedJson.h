@@ -0,0 +1,245 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2026 nfx
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * @file CachedJson.h
+ * @brief Memoized JSON fragments for values that are serialized many times unchanged
+ * @details Responses often embed the same sub-object (a company profile, a configuration
+ *          block) thousands of times between two changes. Wrapping it in CachedJson<T> lets
+ *          the serializer render it once per compact output format and splice the stored bytes
+ *          into every later output with Builder::writeRawJson().
+ */
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <utility>
+
+namespace nfx::serialization::json
+{
+    //=====================================================================
+    // Forward declarations
+    //=====================================================================
+
+    template <typename T>
+    class Serializer;
+
+    //=====================================================================
+    // CachedJson class
+    //=====================================================================
+
+    /**
+     * @brief Value wrapper memoizing its serialized JSON
+     * @tparam T Wrapped value type (any type Serializer<T> supports)
+     * @details Serializes exactly like the wrapped value. Compact output is rendered once per
+     *          format (every option that changes compact output: escapeNonAscii,
+     *          includeNullFields and the variant tag, pair, enum, time and bytes formats) and
+     *          reused until the value changes through set(), modify() or invalidate(), each of
+     *          which bumps version(). Two outputs are never cached: pretty-printed output, whose
+     *          indentation depends on the nesting depth, and output with preserveSharedReferences,
+     *          whose reference ids depend on what the enclosing output has already written.
+     *
+     *          Concurrent serialization of an unchanged value is safe and lock-free; mutation
+     *          requires exclusive access, as for any other object.
+     */
+    template <typename T>
+    class CachedJson final
+    {
+        template <typename U>
+        friend class Serializer;
+
+    public:
+        //----------------------------------------------
+        // Type aliases
+        //----------------------------------------------
+
+        /** @brief The wrapped value type */
+        using value_type = T;
+
+        //----------------------------------------------
+        // Construction
+        //----------------------------------------------
+
+        /**
+         * @brief Default constructor (value-initialized value)
+         */
+        CachedJson() = default;
+
+        /**
+         * @brief Construct from a value
+         * @param value Value to wrap
+         */
+        inline explicit CachedJson( T value );
+
+        /**
+         * @brief Copy constructor
+         * @param other Wrapper to copy (the value only, fragments are rendered again)
+         */
+        inline CachedJson( const CachedJson& other );
+
+        /**
+         * @brief Move constructor
+         * @param other Wrapper to move from (value and fragments)
+         */
+        inline CachedJson( CachedJson&& other ) noexcept;
+
+        /** @brief Destructor */
+        inline ~CachedJson();
+
+        //----------------------------------------------
+        // Assignment
+        //----------------------------------------------
+
+        /**
+         * @brief Copy assignment
+         * @param other Wrapper to copy (the value only, fragments are rendered again)
+         * @return Reference to this wrapper
+         */
+        inline CachedJson& operator=( const CachedJson& other );
+
+        /**
+         * @brief Move assignment
+         * @param other Wrapper to move from (value and fragments)
+         * @return Reference to this wrapper
+         */
+        inline CachedJson& operator=( CachedJson&& other ) noexcept;
+
+        //----------------------------------------------
+        // Accessors
+        //----------------------------------------------
+
+        /**
+         * @brief Get the wrapped value
+         * @return Const reference to the value
+         */
+        [[nodiscard]] inline const T& value() const noexcept;
+
+        /**
+         * @brief Get the wrapped value
+         * @return Const reference to the value
+         */
+        [[nodiscard]] inline const T& operator*() const noexcept;
+
+        /**
+         * @brief Access members of the wrapped value
+         * @return Const pointer to the value
+         */
+        [[nodiscard]] inline const T* operator->() const noexcept;
+
+        /**
+         * @brief Get the modification counter
+         * @return Number of changes made through set(), modify() and invalidate()
+         */
+        [[nodiscard]] inline std::uint64_t version() const noexcept;
+
+        //----------------------------------------------
+        // Modification
+        //----------------------------------------------
+
+        /**
+         * @brief Replace the wrapped value
+         * @param value New value
+         */
+        inline void set( T value );
+
+        /**
+         * @brief Change the wrapped value in place
+         * @tparam F Callable taking T&
+         * @param mutator Function applied to the value
+         * @return Whatever mutator returns
+         */
+        template <typename F>
+        inline decltype( auto ) modify( F&& mutator );
+
+        /**
+         * @brief Drop the cached fragments
+         * @details For values whose serialization depends on state outside the wrapper.
+         */
+        inline void invalidate() noexcept;
+
+    private:
+        //----------------------------------------------
+        // Fragment cache
+        //----------------------------------------------
+
+        /**
+         * @brief Rendered JSON of one compact output format
+         */
+        struct Fragment
+        {
+            std::uint64_t format;  ///< Output format key
+            std::string json;      ///< Rendered JSON
+            const Fragment* next;  ///< Fragment rendered before this one (nullptr for the first)
+        };
+
+        /**
+         * @brief Get the cached fragment for a format, rendering it on first use
+         * @tparam Render Callable returning the JSON as std::string
+         * @param format Output format key (see Serializer<U>::fragmentFormat())
+         * @param render Renders the value when no fragment is cached
+         * @return Cached JSON, valid until the value is modified
+         * @details Threads racing on a missing format may each render; one result is kept.
+         */
+        template <typename Render>
+        inline std::string_view fragment( std::uint64_t format, Render&& render ) const;
+
+        /**
+         * @brief Get the cached fragment for a format without rendering
+         * @param format Output format key (see Serializer<U>::fragmentFormat())
+         * @return Cached fragment, or nullptr if not rendered yet
+         */
+        [[nodiscard]] inline const std::string* cachedFragment( std::uint64_t format ) const noexcept;
+
+        /**
+         * @brief Find a fragment in part of the fragment list
+         * @param first First fragment to look at
+         * @param last Fragment to stop at (not looked at, nullptr for the end of the list)
+         * @param format Output format key
+         * @return Matching fragment, or nullptr
+         */
+        [[nodiscard]] inline static const std::string* findFragment(
+            const Fragment* first, const Fragment* last, std::uint64_t format ) noexcept;
+
+        /**
+         * @brief Free all fragments
+         */
+        inline void release() noexcept;
+
+        //----------------------------------------------
+        // Member variables
+        //----------------------------------------------
+
+        T m_value{};                 ///< Wrapped value
+        std::uint64_t m_version = 0; ///< Modification counter
+
+        /** @brief Rendered JSON per compact output format, most recent first (nullptr until first use) */
+        mutable std::atomic<const Fragment*> m_fragments{ nullptr };
+    };
+} // namespace nfx::serialization::json
+
+#include "nfx/detail/serialization/json/CachedJson.inl"
@@ -0,0 +1,240 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2026 nfx
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * @file DeserializeError.h
+ * @brief Error codes and result type for non-throwing deserialization
+ * @details Serializer<T>::tryFromString() reports failures as a DeserializeError inside a
+ *          DeserializeResult instead of throwing. The error carries a compact code, the
+ *          JSON Pointer of the failing value and its byte offset in the input; path and
+ *          offset are only computed once a failure has occurred.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <variant>
+
+//=====================================================================
+// Exception support detection
+//=====================================================================
+
+#if !defined( NFX_SERIALIZATION_HAS_EXCEPTIONS )
+#    if defined( __cpp_exceptions ) || defined( _CPPUNWIND )
+#        define NFX_SERIALIZATION_HAS_EXCEPTIONS 1
+#    else
+#        define NFX_SERIALIZATION_HAS_EXCEPTIONS 0
+#    endif
+#endif
+
+namespace nfx::serialization::json
+{
+    //=====================================================================
+    // ErrorCode enumeration
+    //=====================================================================
+
+    /**
+     * @brief Reason a value could not be deserialized
+     */
+    enum class ErrorCode : std::uint8_t
+    {
+        None = 0,              ///< No error
+        InvalidJson,           ///< Input is not well-formed JSON
+        TypeMismatch,          ///< JSON value has the wrong type for the target
+        OutOfRange,            ///< Number does not fit the target integer type
+        SizeMismatch,          ///< Array length does not match a fixed-size target
+        MissingField,          ///< Required member is absent
+        InvalidFormat,         ///< String value does not parse as the target type
+        UnknownVariantTag,     ///< Variant tag names no alternative
+        NoMatchingAlternative, ///< No untagged variant alternative accepts the value
+        BorrowFailed,          ///< String cannot be borrowed as std::string_view
+        SchemaViolation,       ///< Value does not satisfy the JSON Schema declared for its type
+        UnresolvedReference,   ///< "$ref" names no preceding "$id" of the target type
+        Custom                 ///< Failure reported by a user SerializationTraits specialization
+    };
+
+    /**
+     * @brief Get a short description of an error code
+     * @param code Error code
+     * @return Static, null-terminated description
+     */
+    [[nodiscard]] inline constexpr std::string_view errorMessage( ErrorCode code ) noexcept;
+
+    //=====================================================================
+    // DeserializeError class
+    //=====================================================================
+
+    /**
+     * @brief Description of a failed deserialization
+     */
+    class DeserializeError final
+    {
+    public:
+        //----------------------------------------------
+        // Construction
+        //----------------------------------------------
+
+        /**
+         * @brief Construct an error
+         * @param code Error code
+         * @param path JSON Pointer of the failing value ("" for the root)
+         * @param offset Byte offset of the failing value in the input, or std::string_view::npos
+         */
+        inline explicit DeserializeError(
+            ErrorCode code, std::string path = {}, std::size_t offset = std::string_view::npos ) noexcept;
+
+        //----------------------------------------------
+        // Accessors
+        //----------------------------------------------
+
+        /**
+         * @brief Get the error code
+         * @return Error code
+         */
+        [[nodiscard]] inline ErrorCode code() const noexcept;
+
+        /**
+         * @brief Get the location of the failing value
+         * @return JSON Pointer (RFC 6901) of the failing value, "" for the root
+         */
+        [[nodiscard]] inline const std::string& path() const noexcept;
+
+        /**
+         * @brief Get the byte offset of the failing value
+         * @return Offset into the input, or std::string_view::npos if unknown
+         */
+        [[nodiscard]] inline std::size_t offset() const noexcept;
+
+        /**
+         * @brief Get a short description of the error
+         * @return Static description of code()
+         */
+        [[nodiscard]] inline std::string_view message() const noexcept;
+
+    private:
+        //----------------------------------------------
+        // Member variables
+        //----------------------------------------------
+
+        ErrorCode m_code;      ///< Error code
+        std::string m_path;    ///< JSON Pointer of the failing value
+        std::size_t m_offset;  ///< Byte offset of the failing value
+    };
+
+    //=====================================================================
+    // DeserializeResult class
+    //=====================================================================
+
+    /**
+     * @brief Deserialized value or the error that prevented it
+     * @tparam T Deserialized type
+     * @details Minimal stand-in for std::expected<T, DeserializeError> (C++23).
+     *          Accessing value() without a value, or error() without an error, is undefined.
+     */
+    template <typename T>
+    class DeserializeResult final
+    {
+    public:
+        //----------------------------------------------
+        // Construction
+        //----------------------------------------------
+
+        /**
+         * @brief Construct a successful result
+         * @param value Deserialized value
+         */
+        inline DeserializeResult( T value );
+
+        /**
+         * @brief Construct a failed result
+         * @param error Failure description
+         */
+        inline DeserializeResult( DeserializeError error ) noexcept;
+
+        //----------------------------------------------
+        // Accessors
+        //----------------------------------------------
+
+        /**
+         * @brief Check whether a value is held
+         * @return True on success
+         */
+        [[nodiscard]] inline bool hasValue() const noexcept;
+
+        /**
+         * @brief Check whether a value is held
+         * @return True on success
+         */
+        [[nodiscard]] inline explicit operator bool() const noexcept;
+
+        /**
+         * @brief Get the deserialized value
+         * @return Reference to the value (requires hasValue())
+         */
+        [[nodiscard]] inline T& value() & noexcept;
+
+        /** @copydoc value() */
+        [[nodiscard]] inline const T& value() const& noexcept;
+
+        /** @copydoc value() */
+        [[nodiscard]] inline T&& value() && noexcept;
+
+        /**
+         * @brief Get the deserialized value
+         * @return Reference to the value (requires hasValue())
+         */
+        [[nodiscard]] inline T& operator*() & noexcept;
+
+        /** @copydoc operator*() */
+        [[nodiscard]] inline const T& operator*() const& noexcept;
+
+        /**
+         * @brief Access members of the deserialized value
+         * @return Pointer to the value (requires hasValue())
+         */
+        [[nodiscard]] inline T* operator->() noexcept;
+
+        /** @copydoc operator->() */
+        [[nodiscard]] inline const T* operator->() const noexcept;
+
+        /**
+         * @brief Get the failure description
+         * @return Reference to the error (requires !hasValue())
+         */
+        [[nodiscard]] inline const DeserializeError& error() const noexcept;
+
+    private:
+        //----------------------------------------------
+        // Member variables
+        //----------------------------------------------
+
+        std::variant<T, DeserializeError> m_storage; ///< Value or error
+    };
+} // namespace nfx::serialization::json
+
+#include "nfx/detail/serialization/json/DeserializeError.inl"
@@ -0,0 +1,174 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2026 nfx
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * @file Scanner.h
+ * @brief Structural JSON scanner for skipping and locating values in raw JSON text
+ * @details Provides a lightweight, allocation-free scanner that works directly on the
+ *          input buffer without building a Document. Values that are not needed
+ *          (unknown members, unused payloads) are skipped with quote/escape-aware
+ *          bracket matching over 64-byte blocks, using SIMD classification when available.
+ *
+ *          Serializer<T>::fromStringAt() drives the scanner to parse only the addressed sub-value.
+ *          fromString(), deserializeInto() and tryFromString() still parse their whole input into
+ *          a Document: which members a SerializationTraits<T>::fromDocument() reads is not known
+ *          before it runs, so nothing can be skipped ahead of the parse.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <string_view>
+
+namespace nfx::serialization::json
+{
+    //=====================================================================
+    // Scanner class
+    //=====================================================================
+
+    /**
+     * @brief Structural scanner over raw JSON text
+     * @details Skips complete JSON values and resolves JSON Pointers without decoding
+     *          the skipped bytes. Input is classified in 64-byte blocks into quote,
+     *          backslash and bracket bitmasks (AVX2/SSE2 when available, scalar otherwise);
+     *          escaped quotes and string contents are masked out so that only structural
+     *          brackets drive the depth counter.
+     *
+     *          The scanner does not validate JSON: it assumes well-formed input and reports
+     *          failure only when a value is truncated or cannot start at the given position.
+     *          Validation is left to Document::fromString() on the located sub-range.
+     *
+     *          Counters track bytes skipped over and bytes handed out for decoding, so callers
+     *          can measure how much of the input was never parsed.
+     */
+    class Scanner final
+    {
+    public:
+        //----------------------------------------------
+        // Construction
+        //----------------------------------------------
+
+        /**
+         * @brief Construct a scanner over a JSON text
+         * @param json JSON text to scan (must outlive the scanner)
+         */
+        inline explicit Scanner( std::string_view json ) noexcept;
+
+        //----------------------------------------------
+        // Scanning
+        //----------------------------------------------
+
+        /**
+         * @brief Skip insignificant whitespace
+         * @param pos Offset to start from
+         * @return Offset of the first non-whitespace byte, or source().size()
+         */
+        [[nodiscard]] inline std::size_t skipWhitespace( std::size_t pos ) const noexcept;
+
+        /**
+         * @brief Skip one complete JSON value
+         * @param pos Offset of the first byte of the value (leading whitespace is allowed)
+         * @return Offset one past the end of the value, or std::string_view::npos if the
+         *         value is truncated or no value starts at pos
+         * @details Skipped bytes are added to bytesSkipped().
+         */
+        [[nodiscard]] inline std::size_t skipValue( std::size_t pos ) noexcept;
+
+        /**
+         * @brief Locate the value addressed by a JSON Pointer (RFC 6901)
+         * @param pointer JSON Pointer such as "/payload/items/3" ("" addresses the root value)
+         * @return Raw JSON text of the addressed value, or std::nullopt if it does not exist
+         * @details Sibling members and elements on the way are skipped structurally, and keys are
+         *          compared one decoded character at a time without allocating. The returned bytes
+         *          are added to bytesDecoded().
+         */
+        [[nodiscard]] inline std::optional<std::string_view> locate( std::string_view pointer ) noexcept;
+
+        //----------------------------------------------
+        // Accessors
+        //----------------------------------------------
+
+        /**
+         * @brief Get the scanned JSON text
+         * @return Source buffer
+         */
+        [[nodiscard]] inline std::string_view source() const noexcept;
+
+        /**
+         * @brief Get the number of bytes skipped without decoding
+         * @return Bytes skipped since construction or the last resetStatistics()
+         */
+        [[nodiscard]] inline std::size_t bytesSkipped() const noexcept;
+
+        /**
+         * @brief Get the number of bytes located for decoding
+         * @return Bytes returned by locate() since construction or the last resetStatistics()
+         */
+        [[nodiscard]] inline std::size_t bytesDecoded() const noexcept;
+
+        /**
+         * @brief Reset skip/decode counters to zero
+         */
+        inline void resetStatistics() noexcept;
+
+    private:
+        //----------------------------------------------
+        // Private methods
+        //----------------------------------------------
+
+        /**
+         * @brief Find the end of a JSON value without updating counters
+         * @param pos Offset of the first byte of the value (leading whitespace is allowed)
+         * @return Offset one past the end of the value, or std::string_view::npos
+         */
+        [[nodiscard]] inline std::size_t valueEnd( std::size_t pos ) const noexcept;
+
+        /**
+         * @brief Find the end of a string literal
+         * @param pos Offset of the opening quote
+         * @return Offset one past the closing quote, or std::string_view::npos
+         */
+        [[nodiscard]] inline std::size_t skipString( std::size_t pos ) const noexcept;
+
+        /**
+         * @brief Find the end of an object or array using structural bitmasks
+         * @param pos Offset of the opening bracket
+         * @return Offset one past the matching closing bracket, or std::string_view::npos
+         */
+        [[nodiscard]] inline std::size_t skipContainer( std::size_t pos ) const noexcept;
+
+        //----------------------------------------------
+        // Member variables
+        //----------------------------------------------
+
+        std::string_view m_json;       ///< Scanned JSON text
+        std::size_t m_bytesSkipped{};  ///< Bytes skipped without decoding
+        std::size_t m_bytesDecoded{};  ///< Bytes located for decoding
+    };
+} // namespace nfx::serialization::json
+
+#include "nfx/detail/serialization/json/Scanner.inl"
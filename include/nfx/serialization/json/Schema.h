@@ -0,0 +1,92 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2026 nfx
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * @file Schema.h
+ * @brief JSON Schema generation from C++ types
+ * @details SchemaOf<T>() describes the JSON that Serializer<T> writes, derived from the type
+ *          structure the serializer already knows (scalars, strings, optionals, smart pointers,
+ *          STL containers, tuples, pairs and variants in their configured layout). Types with
+ *          SerializationTraits contribute their declared schema() or writeSchema() fragment;
+ *          any other type is described by the empty schema `{}`.
+ *
+ *          Schemas follow JSON Schema Draft 2020-12 and are generated once per type.
+ */
+
+#pragma once
+
+#include "Serializer.h"
+
+#include <nfx/json/Builder.h>
+#include <nfx/json/Document.h>
+#include <nfx/json/SchemaValidator.h>
+
+namespace nfx::serialization::json
+{
+    //=====================================================================
+    // Schema generation
+    //=====================================================================
+
+    /**
+     * @brief Get the JSON Schema of a type
+     * @tparam T Type to describe
+     * @return Schema document (generated on first use, then shared)
+     * @details Types declaring SerializationTraits<T>::schema() return that schema unchanged.
+     */
+    template <typename T>
+    inline const Document& SchemaOf();
+
+    /**
+     * @brief Get a validator for the JSON Schema of a type
+     * @tparam T Type to validate against
+     * @return Validator built from SchemaOf<T>() on first use, then shared
+     */
+    template <typename T>
+    inline const SchemaValidator& SchemaValidatorOf();
+
+    namespace detail
+    {
+        /**
+         * @brief Write the schema of a type into a builder
+         * @tparam U Type to describe
+         * @param builder Builder positioned where a schema value is expected
+         * @details Building block for SchemaOf<T>() and for writeSchema() trait members of
+         *          generic types that embed the schema of their elements.
+         */
+        template <typename U>
+        inline void writeSchema( Builder& builder );
+
+        /**
+         * @brief Write the schema of an array of {"key": K, "value": V} objects or [K, V] arrays
+         * @tparam K Key type
+         * @tparam V Value type
+         * @param builder Builder positioned where a schema value is expected
+         * @details Layout used for multimaps and the nfx-containers hash maps.
+         */
+        template <typename K, typename V>
+        inline void writeKeyValueArraySchema( Builder& builder );
+    } // namespace detail
+} // namespace nfx::serialization::json
+
+#include "nfx/detail/serialization/json/Schema.inl"
@@ -32,14 +32,56 @@
 
 #pragma once
 
+#include "ByteCodec.h"
+#include "CachedJson.h"
 #include "Concepts.h"
+#include "DeserializeError.h"
+#include "Scanner.h"
+#include "StringArena.h"
+#include "StringPool.h"
+#include "traits/EnumTraits.h"
+#include "traits/MapKeyTraits.h"
 #include "traits/SerializationTraits.h"
+#include "traits/VariantTraits.h"
 
 #include <nfx/json/Document.h>
 #include <nfx/json/Builder.h>
+#include <nfx/json/SchemaValidator.h>
+
+#include <cstdint>
+#include <optional>
 
 namespace nfx::serialization::json
 {
+    //=====================================================================
+    // Key-value pair layout
+    //=====================================================================
+
+    /**
+     * @brief JSON shape of the entries of containers written as arrays of key-value pairs
+     * @details Applies to std::multimap, std::unordered_multimap and the nfx-containers hash maps.
+     *          The reader accepts both layouts regardless of the option.
+     */
+    enum class PairLayout : std::uint8_t
+    {
+        Object = 0, ///< {"key": K, "value": V} (default, self-describing)
+        Array       ///< [K, V] (compact: no member names to write or look up)
+    };
+
+    //=====================================================================
+    // Time format
+    //=====================================================================
+
+    /**
+     * @brief JSON form of std::chrono durations and time points
+     * @details Requires extensions/DateTimeTraits.h. The reader accepts both forms regardless of the option.
+     */
+    enum class TimeFormat : std::uint8_t
+    {
+        Ticks = 0, ///< Tick count of the duration or since the clock's epoch (default, allocation-free)
+        Iso8601    ///< ISO 8601 string: "PT1H30M" for durations, "2024-06-15T14:30:45.123Z" for system_clock
+    };
+
     //=====================================================================
     // Serializer class
     //=====================================================================
@@ -56,6 +98,9 @@ namespace nfx::serialization::json
         template <typename U>
         friend struct SerializationTraits;
 
+        friend class MergePatchReader;
+        friend class MergePatchWriter;
+
     public:
         //----------------------------------------------
         // Serialization options and context
@@ -68,9 +113,26 @@ namespace nfx::serialization::json
         {
             bool includeNullFields = false;    ///< Include fields with null values in output
             bool prettyPrint = false;          ///< Format output with indentation
-            bool validateOnDeserialize = true; ///< Validate data during deserialization
+            bool validateOnDeserialize = true; ///< Validate data during deserialization (integers must fit exactly)
             bool escapeNonAscii = false;       ///< Escape non-ASCII characters (> 127) as \\uXXXX
 
+            StringArena* stringArena = nullptr; ///< Storage for escaped strings deserialized as std::string_view
+            StringPool* stringPool = nullptr;   ///< Pool for interned strings (nullptr: a pool for this call only)
+
+            VariantTagFormat variantTagFormat = VariantTagFormat::Name; ///< Encoding of std::variant tags
+            PairLayout pairLayout = PairLayout::Object;    ///< Encoding of multimap and hash map entries
+            EnumFormat enumFormat = EnumFormat::Name;      ///< Encoding of enumeration values
+            TimeFormat timeFormat = TimeFormat::Ticks;     ///< Encoding of std::chrono values
+            BytesFormat bytesFormat = BytesFormat::Base64; ///< Encoding of byte containers
+
+            /**
+             * @brief Write a pointee shared by several std::shared_ptr once, and re-link it on read
+             * @details The first occurrence is written as {"$id":n,"$value":...}, later ones as {"$ref":n}.
+             */
+            bool preserveSharedReferences = false;
+
+            std::size_t* sizeHint = nullptr; ///< In/out output size of the previous toString() for this shape
+
             /**
              * @brief Default constructor
              */
@@ -145,15 +207,122 @@ namespace nfx::serialization::json
          */
         inline static std::string toString( const T& obj, const Options& options = {} );
 
+        /**
+         * @brief Estimate the serialized length of an object without serializing it
+         * @param obj Object to measure
+         * @param options Serialization options (optional, uses defaults if not provided)
+         * @return Approximate JSON length in bytes
+         * @details Sums container sizes, string lengths (unescaped) and upper bounds for numbers,
+         *          including pretty-print indentation. Containers of numbers are sized from their
+         *          count without visiting the elements. User types contribute through
+         *          SerializationTraits<T>::estimateSize(), or a fixed guess when it is not provided.
+         *          toString() uses this to reserve its output buffer once, except for numbers,
+         *          booleans, enums and optionals, pairs and tuples of them, whose output is short.
+         */
+        inline static std::size_t estimateSize( const T& obj, const Options& options = {} );
+
+        /**
+         * @brief Compute the exact serialized length of an object
+         * @param obj Object to measure
+         * @param options Serialization options (optional, uses defaults if not provided)
+         * @return Length in bytes of the JSON toString() would produce
+         * @details Numbers are formatted on the stack and strings are scanned for escapes; nothing
+         *          is written for built-in types. User types are measured by serializing them into
+         *          a scratch builder.
+         */
+        inline static std::size_t serializedSize( const T& obj, const Options& options = {} );
+
+        /**
+         * @brief Serialize the difference between two values as a JSON Merge Patch (RFC 7386)
+         * @param before Previous value (as last sent)
+         * @param after Current value
+         * @param options Serialization options (optional, uses defaults if not provided)
+         * @return Merge patch turning the JSON of before into the JSON of after ("{}" if unchanged)
+         * @details Streams the patch through the Builder without building Documents. Maps are
+         *          compared key by key (removed keys become null), user types member by member when
+         *          SerializationTraits<T>::writeMergePatch() is provided. Arrays and other values are
+         *          written whole when they differ, as RFC 7386 has no element-wise array updates.
+         *          Null values in after cannot be told apart from removals, as in any merge patch.
+         */
+        inline static std::string toMergePatch( const T& before, const T& after, const Options& options = {} );
+
         /**
          * @brief Deserialize object from JSON string
          * @tparam T Type of object to deserialize
          * @param jsonStr JSON string to deserialize from
          * @param options Serialization options (optional, uses defaults if not provided)
          * @return Deserialized object
+         * @throws std::runtime_error if the JSON is invalid or does not match T; the message ends with the
+         *         JSON Pointer and byte offset of the offending value (e.g. " at /users/3/age (offset 812)")
          */
         inline static T fromString( std::string_view jsonStr, const Options& options = {} );
 
+        /**
+         * @brief Deserialize JSON into an existing object, reusing its storage
+         * @param jsonStr JSON string to deserialize from
+         * @param obj Object to overwrite
+         * @param options Serialization options (optional, uses defaults if not provided)
+         * @throws std::runtime_error as fromString(); obj may then be partially overwritten
+         * @details Strings are assigned in place and sequence containers overwrite their existing
+         *          elements, growing or shrinking only the tail. Map entries whose key is still
+         *          present are overwritten in place and the others erased. Engaged optionals, the
+         *          active variant alternative and exclusively owned pointees are reused as well, so
+         *          decoding the same shape repeatedly allocates nothing in obj after the first call.
+         *          Sets and multimaps are rebuilt. Custom fromDocument() implementations receive the
+         *          previous value and must assign every member.
+         */
+        inline static void deserializeInto( std::string_view jsonStr, T& obj, const Options& options = {} );
+
+        /**
+         * @brief Deserialize object from JSON string without throwing
+         * @param jsonStr JSON string to deserialize from
+         * @param options Serialization options (optional, uses defaults if not provided)
+         * @return Deserialized object, or a DeserializeError with code, JSON Pointer and byte offset
+         * @details Failures are recorded instead of thrown and no error message is built, so
+         *          rejecting malformed input costs no more than accepting valid input. Path and
+         *          offset of the failing value are computed only after a failure. Exceptions thrown
+         *          by user SerializationTraits are reported as ErrorCode::Custom.
+         */
+        inline static DeserializeResult<T> tryFromString( std::string_view jsonStr, const Options& options = {} );
+
+        /**
+         * @brief Deserialize the value at a JSON Pointer without parsing the rest of the input
+         * @param jsonStr JSON string to deserialize from
+         * @param pointer JSON Pointer (RFC 6901) addressing the value, e.g. "/payload/items/0"
+         * @param options Serialization options (optional, uses defaults if not provided)
+         * @return Deserialized object
+         * @throws std::runtime_error if the pointer does not resolve or the value fails to parse
+         * @details Members and elements outside the addressed path are skipped structurally by
+         *          a Scanner; only the addressed sub-range is parsed into a Document.
+         */
+        inline static T fromStringAt( std::string_view jsonStr, std::string_view pointer, const Options& options = {} );
+
+        /**
+         * @brief Deserialize the value at a JSON Pointer using an existing scanner
+         * @param scanner Scanner over the JSON input (skip/decode statistics are accumulated)
+         * @param pointer JSON Pointer (RFC 6901) addressing the value
+         * @param options Serialization options (optional, uses defaults if not provided)
+         * @return Deserialized object
+         * @throws std::runtime_error if the pointer does not resolve or the value fails to parse
+         */
+        inline static T fromStringAt( Scanner& scanner, std::string_view pointer, const Options& options = {} );
+
+        /**
+         * @brief Apply a JSON Merge Patch (RFC 7386) to an existing object in place
+         * @param patchJson Merge patch, e.g. as produced by toMergePatch()
+         * @param obj Object to update
+         * @param options Serialization options (optional, uses defaults if not provided)
+         * @throws std::runtime_error if the patch is invalid JSON or a patched value does not match its type
+         * @details Only the members named in the patch are touched. Map entries are updated, inserted
+         *          or erased (null) in place, user types member by member when
+         *          SerializationTraits<T>::applyMergePatch() is provided, and engaged optionals and
+         *          pointers are patched through. Everything else is replaced by deserializing the patch
+         *          value into the existing object, so strings and containers keep their storage.
+         *          Schemas are not checked, as a patch is not a complete value. A failure may leave
+         *          obj partially patched.
+         */
+        inline static void applyMergePatch( std::string_view patchJson, T& obj, const Options& options = {} );
+
     private:
         //----------------------------------------------
         // Private methods
@@ -168,6 +337,63 @@ namespace nfx::serialization::json
         template <typename U>
         inline void serializeValue( const U& obj, nfx::json::Builder& builder ) const;
 
+        /**
+         * @brief Measure the serialized length of a value
+         * @tparam U The type to measure (deduced from parameter)
+         * @param obj Object to measure
+         * @param depth Nesting depth of the value (pretty-print indentation)
+         * @param exact Format numbers and scan strings for escapes instead of using upper bounds
+         * @return Estimated or exact JSON length in bytes
+         */
+        template <typename U>
+        inline std::size_t measureValue( const U& obj, std::size_t depth, bool exact ) const;
+
+        /**
+         * @brief Measure a value by serializing it into a scratch builder
+         * @tparam U The type to measure (deduced from parameter)
+         * @param obj Object to measure
+         * @param depth Nesting depth of the value (pretty-print indentation)
+         * @return Exact JSON length in bytes
+         */
+        template <typename U>
+        inline std::size_t measureWritten( const U& obj, std::size_t depth ) const;
+
+        /**
+         * @brief Write the merge patch turning one value into another
+         * @tparam U The type to diff (deduced from parameters)
+         * @param before Previous value
+         * @param after Current value
+         * @param builder Builder to write the patch into
+         */
+        template <typename U>
+        inline void writeMergePatch( const U& before, const U& after, nfx::json::Builder& builder ) const;
+
+        /**
+         * @brief Check whether two values serialize identically
+         * @tparam U The type to compare (deduced from parameters)
+         * @param before Previous value
+         * @param after Current value
+         * @return True if equal (operator==, or identical compact JSON for types without it)
+         */
+        template <typename U>
+        inline bool sameValue( const U& before, const U& after ) const;
+
+        /**
+         * @brief Apply a merge patch to a value in place
+         * @tparam U The type to patch (deduced from parameter)
+         * @param patch Patch document (a JSON object merges, anything else replaces)
+         * @param obj Object to update
+         */
+        template <typename U>
+        inline void applyPatchValue( const nfx::json::Document& patch, U& obj ) const;
+
+        /**
+         * @brief Key of the CachedJson fragment matching the current options
+         * @return Compact output format key, distinct for every combination of the options that
+         *         change compact output
+         */
+        inline std::uint64_t fragmentFormat() const noexcept;
+
         /**
          * @brief Unified templated deserialization method
          * @tparam U The type to deserialize (deduced from parameter)
@@ -177,12 +403,234 @@ namespace nfx::serialization::json
         template <typename U>
         inline void deserializeValue( const nfx::json::Document& doc, U& obj ) const;
 
+        /**
+         * @brief Deserialize a new value, to be constructed where it is stored
+         * @tparam U The type to construct
+         * @param doc Document to deserialize from (must outlive the returned value)
+         * @return Deferred value converting to U: passed to emplace(), it builds the element in place
+         * @details Factory types are returned by SerializationTraits<U>::fromDocument(doc), so they can
+         *          be nested at any level; other types are default-constructed and deserialized.
+         */
+        template <typename U>
+        inline auto constructValue( const nfx::json::Document& doc ) const;
+
+        /**
+         * @brief Resolve a "$ref" or "$id" envelope written with Options::preserveSharedReferences
+         * @tparam U The std::shared_ptr type to assign (deduced from parameter)
+         * @param members Members of the object being deserialized
+         * @param obj Pointer to re-link to an earlier object, or to a new one registered under its id
+         * @return False if the object is not an envelope and holds the pointee itself
+         */
+        template <typename U>
+        inline bool readSharedReference( const nfx::json::Object& members, U& obj ) const;
+
+        /**
+         * @brief Write the tag of the active variant alternative (name or index)
+         * @tparam U The variant type
+         * @param obj Variant whose active alternative is described
+         * @param builder Builder to write the tag value into
+         */
+        template <typename U>
+        inline void serializeVariantTag( const U& obj, nfx::json::Builder& builder ) const;
+
+        /**
+         * @brief Write the members of a value serialized as a JSON object, without its braces
+         * @tparam U Type of the value (an internally tagged variant alternative)
+         * @param obj Value whose members are written
+         * @param builder Builder positioned inside an open object
+         * @details Uses SerializationTraits<U>::serializeMembers() when declared; string-keyed maps
+         *          write their entries directly and legacy toDocument() types replay their document.
+         *          Other types are rendered compactly once; compact output splices each member's raw
+         *          JSON into the builder, pretty output reparses the rendering to re-indent it.
+         * @throws std::runtime_error if the value does not serialize as a JSON object
+         */
+        template <typename U>
+        inline void serializeMembers( const U& obj, nfx::json::Builder& builder ) const;
+
+        /**
+         * @brief Resolve a variant tag read from JSON to an alternative index
+         * @tparam U The variant type
+         * @param doc Document containing the tag
+         * @param path Path of the tag (string name or integer index) within doc
+         * @return Alternative index, or std::nullopt after reporting a missing, unknown or out-of-range tag
+         */
+        template <typename U>
+        inline static std::optional<std::size_t> resolveVariantTag(
+            const nfx::json::Document& doc, std::string_view path );
+
+        /**
+         * @brief Deserialize a given variant alternative (constant-time dispatch)
+         * @tparam U The variant type
+         * @param index Alternative index
+         * @param doc Document holding the alternative's value
+         * @param obj Variant to emplace the alternative into
+         */
+        template <typename U>
+        inline void deserializeVariantAlternative( std::size_t index, const nfx::json::Document& doc, U& obj ) const;
+
         //----------------------------------------------
         // Member variables
         //----------------------------------------------
 
         Options m_options{}; ///< Serialization options
     };
+
+    //=====================================================================
+    // MergePatchWriter class
+    //=====================================================================
+
+    /**
+     * @brief Writes the members of a JSON Merge Patch for a user type
+     * @details Passed to SerializationTraits<T>::writeMergePatch() inside the patch object. Each
+     *          member() call compares one field and writes it only if it changed: maps and user
+     *          types with writeMergePatch() are diffed recursively, other values written whole.
+     *
+     * **Example**
+     * ```cpp
+     * static void writeMergePatch( const Company& before, const Company& after, MergePatchWriter& patch )
+     * {
+     *     patch.member( "name", before.name, after.name );
+     *     patch.member( "staff", before.staff, after.staff );
+     * }
+     * ```
+     */
+    class MergePatchWriter final
+    {
+        template <typename U>
+        friend class Serializer;
+
+    public:
+        //----------------------------------------------
+        // Patch members
+        //----------------------------------------------
+
+        /**
+         * @brief Write a member if it changed
+         * @tparam V Member type
+         * @param key Member name
+         * @param before Previous member value
+         * @param after Current member value
+         */
+        template <typename V>
+        inline void member( std::string_view key, const V& before, const V& after );
+
+        /**
+         * @brief Write a removed member (null)
+         * @param key Member name
+         */
+        inline void removed( std::string_view key );
+
+        /**
+         * @brief Get the builder the patch object is written to
+         * @return Builder positioned inside the patch object
+         */
+        [[nodiscard]] inline nfx::json::Builder& builder() noexcept;
+
+    private:
+        //----------------------------------------------
+        // Construction
+        //----------------------------------------------
+
+        /**
+         * @brief Construct from the enclosing serializer's options
+         * @tparam Options Serializer<U>::Options of the enclosing serializer
+         * @param builder Builder positioned inside the patch object
+         * @param options Options forwarded to the serializers of each member
+         */
+        template <typename Options>
+        inline MergePatchWriter( nfx::json::Builder& builder, const Options& options );
+
+        //----------------------------------------------
+        // Member variables
+        //----------------------------------------------
+
+        nfx::json::Builder& m_builder;       ///< Builder positioned inside the patch object
+        bool m_includeNullFields;            ///< Forwarded Options::includeNullFields
+        bool m_prettyPrint;                  ///< Forwarded Options::prettyPrint
+        bool m_escapeNonAscii;               ///< Forwarded Options::escapeNonAscii
+        VariantTagFormat m_variantTagFormat; ///< Forwarded Options::variantTagFormat
+        PairLayout m_pairLayout;             ///< Forwarded Options::pairLayout
+        EnumFormat m_enumFormat;             ///< Forwarded Options::enumFormat
+        TimeFormat m_timeFormat;             ///< Forwarded Options::timeFormat
+        BytesFormat m_bytesFormat;           ///< Forwarded Options::bytesFormat
+        bool m_preserveSharedReferences;     ///< Forwarded Options::preserveSharedReferences
+    };
+
+    //=====================================================================
+    // MergePatchReader class
+    //=====================================================================
+
+    /**
+     * @brief Reads the members of a JSON Merge Patch into a user type
+     * @details Passed to SerializationTraits<T>::applyMergePatch() for patch objects. Each member()
+     *          call looks its key up in the patch and, if present, patches the field in place
+     *          (null resets it to a default-constructed value). Fields not named in the patch are
+     *          left untouched.
+     *
+     * **Example**
+     * ```cpp
+     * static void applyMergePatch( MergePatchReader& patch, Company& obj )
+     * {
+     *     patch.member( "name", obj.name );
+     *     patch.member( "staff", obj.staff );
+     * }
+     * ```
+     */
+    class MergePatchReader final
+    {
+        template <typename U>
+        friend class Serializer;
+
+    public:
+        //----------------------------------------------
+        // Patch members
+        //----------------------------------------------
+
+        /**
+         * @brief Patch a member if the patch names it
+         * @tparam V Member type
+         * @param key Member name
+         * @param value Member to update
+         * @return True if the patch contained the member
+         */
+        template <typename V>
+        inline bool member( std::string_view key, V& value );
+
+        /**
+         * @brief Get the patch object
+         * @return Members of the patch being applied
+         */
+        [[nodiscard]] inline const nfx::json::Object& patch() const noexcept;
+
+    private:
+        //----------------------------------------------
+        // Construction
+        //----------------------------------------------
+
+        /**
+         * @brief Construct from the enclosing serializer's options
+         * @tparam Options Serializer<U>::Options of the enclosing serializer
+         * @param patch Patch object being applied
+         * @param options Options forwarded to the serializers of each member
+         */
+        template <typename Options>
+        inline MergePatchReader( const nfx::json::Object& patch, const Options& options );
+
+        //----------------------------------------------
+        // Member variables
+        //----------------------------------------------
+
+        const nfx::json::Object& m_patch;    ///< Patch object being applied
+        bool m_validateOnDeserialize;        ///< Forwarded Options::validateOnDeserialize
+        StringArena* m_stringArena;          ///< Forwarded Options::stringArena
+        StringPool* m_stringPool;            ///< Forwarded Options::stringPool
+        VariantTagFormat m_variantTagFormat; ///< Forwarded Options::variantTagFormat
+        PairLayout m_pairLayout;             ///< Forwarded Options::pairLayout
+        EnumFormat m_enumFormat;             ///< Forwarded Options::enumFormat
+        TimeFormat m_timeFormat;             ///< Forwarded Options::timeFormat
+        BytesFormat m_bytesFormat;           ///< Forwarded Options::bytesFormat
+        bool m_preserveSharedReferences;     ///< Forwarded Options::preserveSharedReferences
+    };
 } // namespace nfx::serialization::json
 
 #include "nfx/detail/serialization/json/Serializer.inl"
@@ -0,0 +1,137 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2026 nfx
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * @file StringArena.h
+ * @brief Append-only storage for strings that cannot be borrowed from the input buffer
+ * @details Deserializing std::string_view members borrows bytes directly from the JSON
+ *          input. Strings that contained escape sequences have no contiguous decoded
+ *          representation in the input; their decoded text is stored in a StringArena
+ *          supplied by the caller, which must outlive the deserialized views.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <string_view>
+#include <vector>
+
+namespace nfx::serialization::json
+{
+    //=====================================================================
+    // StringArena class
+    //=====================================================================
+
+    /**
+     * @brief Block-allocated, append-only string storage
+     * @details Strings are copied into fixed-size blocks; views returned by store() stay
+     *          valid until clear() is called or the arena is destroyed. Strings larger than
+     *          the block size get a dedicated block. The arena is not thread-safe.
+     */
+    class StringArena final
+    {
+    public:
+        //----------------------------------------------
+        // Construction
+        //----------------------------------------------
+
+        /**
+         * @brief Construct an arena
+         * @param blockSize Size of each storage block in bytes
+         */
+        inline explicit StringArena( std::size_t blockSize = 4096 ) noexcept;
+
+        /** @brief Copy constructor (deleted: views point into owned blocks) */
+        StringArena( const StringArena& ) = delete;
+
+        /** @brief Move constructor (stored views remain valid) */
+        StringArena( StringArena&& ) noexcept = default;
+
+        /** @brief Destructor */
+        ~StringArena() = default;
+
+        //----------------------------------------------
+        // Assignment
+        //----------------------------------------------
+
+        /** @brief Copy assignment (deleted) */
+        StringArena& operator=( const StringArena& ) = delete;
+
+        /** @brief Move assignment */
+        StringArena& operator=( StringArena&& ) noexcept = default;
+
+        //----------------------------------------------
+        // Storage
+        //----------------------------------------------
+
+        /**
+         * @brief Copy a string into the arena
+         * @param text Text to store
+         * @return View of the stored copy
+         */
+        [[nodiscard]] inline std::string_view store( std::string_view text );
+
+        /**
+         * @brief Release all stored strings
+         * @details Invalidates every view returned by store(). The first block is kept for reuse.
+         */
+        inline void clear() noexcept;
+
+        //----------------------------------------------
+        // Accessors
+        //----------------------------------------------
+
+        /**
+         * @brief Get the number of bytes stored
+         * @return Total length of all stored strings
+         */
+        [[nodiscard]] inline std::size_t size() const noexcept;
+
+    private:
+        //----------------------------------------------
+        // Block
+        //----------------------------------------------
+
+        /**
+         * @brief One contiguous storage block
+         */
+        struct Block
+        {
+            std::unique_ptr<char[]> data; ///< Block storage
+            std::size_t capacity;         ///< Block size in bytes
+        };
+
+        //----------------------------------------------
+        // Member variables
+        //----------------------------------------------
+
+        std::vector<Block> m_blocks; ///< Storage blocks (last one is current)
+        std::size_t m_blockSize;     ///< Default block size in bytes
+        std::size_t m_blockUsed{};   ///< Bytes used in the current block
+        std::size_t m_size{};        ///< Total bytes stored
+    };
+} // namespace nfx::serialization::json
+
+#include "nfx/detail/serialization/json/StringArena.inl"
@@ -0,0 +1,226 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2026 nfx
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * @file StringPool.h
+ * @brief String interning for repeated values during bulk deserialization
+ * @details Datasets often repeat the same low-cardinality strings (country codes, status
+ *          values, categories) across many records. Members declared as InternedString or
+ *          std::shared_ptr<const std::string> deserialize into storage shared through a
+ *          StringPool, so each distinct value is allocated once.
+ */
+
+#pragma once
+
+#include <compare>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+namespace nfx::serialization::json
+{
+    //=====================================================================
+    // InternedString class
+    //=====================================================================
+
+    /**
+     * @brief Immutable string sharing its storage with every equal interned value
+     * @details Obtained from StringPool::intern(). Copies share one allocation; comparing two
+     *          values from the same pool reduces to a pointer comparison.
+     */
+    class InternedString final
+    {
+    public:
+        //----------------------------------------------
+        // Construction
+        //----------------------------------------------
+
+        /**
+         * @brief Default constructor (empty string)
+         */
+        InternedString() = default;
+
+        /**
+         * @brief Construct from shared storage
+         * @param storage Interned string storage
+         */
+        inline explicit InternedString( std::shared_ptr<const std::string> storage ) noexcept;
+
+        //----------------------------------------------
+        // Accessors
+        //----------------------------------------------
+
+        /**
+         * @brief Get the string contents
+         * @return View of the interned text (empty for a default-constructed value)
+         */
+        [[nodiscard]] inline std::string_view view() const noexcept;
+
+        /**
+         * @brief Get the shared storage
+         * @return Shared pointer to the interned text (nullptr for a default-constructed value)
+         */
+        [[nodiscard]] inline const std::shared_ptr<const std::string>& storage() const noexcept;
+
+        /**
+         * @brief Implicit conversion to std::string_view
+         * @return View of the interned text
+         */
+        inline operator std::string_view() const noexcept;
+
+        //----------------------------------------------
+        // Comparison
+        //----------------------------------------------
+
+        /**
+         * @brief Compare two interned strings
+         * @param other String to compare with
+         * @return True if both hold the same text
+         */
+        [[nodiscard]] inline bool operator==( const InternedString& other ) const noexcept;
+
+        /**
+         * @brief Compare with a string view
+         * @param other Text to compare with
+         * @return True if the interned text equals other
+         */
+        [[nodiscard]] inline bool operator==( std::string_view other ) const noexcept;
+
+        /**
+         * @brief Lexicographic ordering (for use as ordered container key)
+         * @param other String to compare with
+         * @return Ordering of the contained texts
+         */
+        [[nodiscard]] inline std::strong_ordering operator<=>( const InternedString& other ) const noexcept;
+
+    private:
+        //----------------------------------------------
+        // Member variables
+        //----------------------------------------------
+
+        std::shared_ptr<const std::string> m_storage; ///< Shared text storage
+    };
+
+    //=====================================================================
+    // StringPool class
+    //=====================================================================
+
+    /**
+     * @brief Pool of interned strings keyed by a fast hash of their bytes
+     * @details Not synchronized: use one pool per ingesting thread, passed through
+     *          Options::stringPool, which keeps parallel ingestion lock-free. The pool grows with
+     *          every distinct string it sees, so its owner decides when to clear() it. Interned
+     *          values keep their storage alive after clear().
+     */
+    class StringPool final
+    {
+    public:
+        //----------------------------------------------
+        // Construction
+        //----------------------------------------------
+
+        /**
+         * @brief Default constructor
+         */
+        StringPool() = default;
+
+        /** @brief Copy constructor (deleted) */
+        StringPool( const StringPool& ) = delete;
+
+        /** @brief Move constructor */
+        StringPool( StringPool&& ) = default;
+
+        /** @brief Destructor */
+        ~StringPool() = default;
+
+        //----------------------------------------------
+        // Assignment
+        //----------------------------------------------
+
+        /** @brief Copy assignment (deleted) */
+        StringPool& operator=( const StringPool& ) = delete;
+
+        /** @brief Move assignment */
+        StringPool& operator=( StringPool&& ) = default;
+
+        //----------------------------------------------
+        // Interning
+        //----------------------------------------------
+
+        /**
+         * @brief Get the shared instance of a string, inserting it on first use
+         * @param text Text to intern
+         * @return Interned string sharing storage with all previous equal values
+         */
+        [[nodiscard]] inline InternedString intern( std::string_view text );
+
+        /**
+         * @brief Drop all pooled strings
+         * @details Values interned earlier remain valid; later interning allocates fresh storage.
+         */
+        inline void clear() noexcept;
+
+        //----------------------------------------------
+        // Accessors
+        //----------------------------------------------
+
+        /**
+         * @brief Get the number of distinct pooled strings
+         * @return Pool size
+         */
+        [[nodiscard]] inline std::size_t size() const noexcept;
+
+    private:
+        //----------------------------------------------
+        // Hashing
+        //----------------------------------------------
+
+        /**
+         * @brief Transparent hash over raw string bytes (8 bytes per step)
+         */
+        struct Hash
+        {
+            using is_transparent = void; ///< Enables heterogeneous lookup
+
+            /**
+             * @brief Hash a string
+             * @param text Bytes to hash
+             * @return 64-bit hash value
+             */
+            [[nodiscard]] inline std::size_t operator()( std::string_view text ) const noexcept;
+        };
+
+        //----------------------------------------------
+        // Member variables
+        //----------------------------------------------
+
+        /** @brief Pooled strings, keyed by a view into their own storage */
+        std::unordered_map<std::string_view, std::shared_ptr<const std::string>, Hash, std::equal_to<>> m_strings;
+    };
+} // namespace nfx::serialization::json
+
+#include "nfx/detail/serialization/json/StringPool.inl"
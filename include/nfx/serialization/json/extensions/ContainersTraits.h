@@ -39,6 +39,7 @@
 
 #pragma once
 
+#include "nfx/serialization/json/Schema.h"
 #include "nfx/serialization/json/Serializer.h"
 
 //=====================================================================
@@ -61,120 +62,40 @@ namespace nfx::serialization::json
          * @brief Deserialize PerfectHashMap from JSON document
          * @param doc The document to deserialize from
          * @param obj The PerfectHashMap object to deserialize into
-         * @details Expects array format with key-value pair objects
+         * @details Expects array format with key-value pair objects or [key, value] arrays
          */
         static void fromDocument(
             const Document& doc, nfx::containers::PerfectHashMap<TKey, TValue, HashType, Seed, Hasher, KeyEqual>& obj )
         {
-            if( !doc.is<Array>( "" ) )
+            const auto elements = doc.rootRef<Array>();
+            if( !elements )
             {
-                throw std::runtime_error{ "Cannot deserialize non-array JSON value into PerfectHashMap" };
+                detail::reportError(
+                    ErrorCode::TypeMismatch, "Cannot deserialize non-array JSON value into PerfectHashMap" );
+                return;
             }
 
             // Collect key-value pairs for PerfectHashMap construction
             std::vector<std::pair<TKey, TValue>> items;
-
-            // Get array and iterate using STL iterator
-            auto arrayOpt = doc.get<Array>( "" );
-            if( arrayOpt.has_value() )
+            items.reserve( elements->get().size() );
+            for( const auto& pairDoc : elements->get() )
             {
-                for( const auto& pairDoc : arrayOpt.value() )
+                const detail::KeyValueEntry entry = detail::findKeyValue( pairDoc );
+                if( !entry.key )
                 {
-                    // Extract key - try different types
-                    TKey key{};
-                    bool keyFound = false;
-
-                    if( pairDoc.contains( "key" ) )
-                    {
-                        // Try to deserialize key based on its actual JSON type
-                        if constexpr( std::is_same_v<TKey, std::string> )
-                        {
-                            auto keyOpt = pairDoc.get<std::string>( "key" );
-                            if( keyOpt )
-                            {
-                                key = *keyOpt;
-                                keyFound = true;
-                            }
-                        }
-                        else if constexpr( std::is_integral_v<TKey> && !std::is_same_v<TKey, bool> )
-                        {
-                            auto keyOpt = pairDoc.get<int64_t>( "key" );
-                            if( keyOpt )
-                            {
-                                key = static_cast<TKey>( *keyOpt );
-                                keyFound = true;
-                            }
-                        }
-                        else if constexpr( std::is_floating_point_v<TKey> )
-                        {
-                            auto keyOpt = pairDoc.get<double>( "key" );
-                            if( keyOpt )
-                            {
-                                key = static_cast<TKey>( *keyOpt );
-                                keyFound = true;
-                            }
-                        }
-                        else if constexpr( std::is_same_v<TKey, bool> )
-                        {
-                            auto keyOpt = pairDoc.get<bool>( "key" );
-                            if( keyOpt )
-                            {
-                                key = *keyOpt;
-                                keyFound = true;
-                            }
-                        }
-                    }
-
-                    // Extract value - try different types
-                    TValue value{};
-                    bool valueFound = false;
-
-                    if( pairDoc.contains( "value" ) )
-                    {
-                        // Try to deserialize value based on its actual JSON type
-                        if constexpr( std::is_same_v<TValue, std::string> )
-                        {
-                            auto valOpt = pairDoc.get<std::string>( "value" );
-                            if( valOpt )
-                            {
-                                value = *valOpt;
-                                valueFound = true;
-                            }
-                        }
-                        else if constexpr( std::is_integral_v<TValue> && !std::is_same_v<TValue, bool> )
-                        {
-                            auto valOpt = pairDoc.get<int64_t>( "value" );
-                            if( valOpt )
-                            {
-                                value = static_cast<TValue>( *valOpt );
-                                valueFound = true;
-                            }
-                        }
-                        else if constexpr( std::is_floating_point_v<TValue> )
-                        {
-                            auto valOpt = pairDoc.get<double>( "value" );
-                            if( valOpt )
-                            {
-                                value = static_cast<TValue>( *valOpt );
-                                valueFound = true;
-                            }
-                        }
-                        else if constexpr( std::is_same_v<TValue, bool> )
-                        {
-                            auto valOpt = pairDoc.get<bool>( "value" );
-                            if( valOpt )
-                            {
-                                value = *valOpt;
-                                valueFound = true;
-                            }
-                        }
-                    }
+                    continue;
+                }
 
-                    if( keyFound && valueFound )
-                    {
-                        items.emplace_back( std::move( key ), std::move( value ) );
-                    }
+                TKey key{};
+                Serializer<TKey>{}.deserializeValue( *entry.key, key );
+                TValue value{};
+                Serializer<TValue>{}.deserializeValue( *entry.value, value );
+                if( detail::deserializationFailed() )
+                {
+                    return;
                 }
+
+                items.emplace_back( std::move( key ), std::move( value ) );
             }
 
             obj = nfx::containers::PerfectHashMap<TKey, TValue, HashType, Seed, Hasher, KeyEqual>( std::move( items ) );
@@ -184,18 +105,29 @@ namespace nfx::serialization::json
          * @brief High-performance streaming serialization
          * @param obj The PerfectHashMap object to serialize
          * @param builder The builder to write to
-         * @details Serializes as array of {key, value} objects: [{key:..., value:...}, ...]
+         * @details Serializes as array of {key, value} objects: [{key:..., value:...}, ...],
+         *          or of [key, value] arrays with PairLayout::Array
          */
         static void serialize(
             const nfx::containers::PerfectHashMap<TKey, TValue, HashType, Seed, Hasher, KeyEqual>& obj,
             nfx::json::Builder& builder )
         {
+            const bool compact = detail::currentPairLayout() == PairLayout::Array;
             builder.writeStartArray();
 
             for( auto it = obj.begin(); it != obj.end(); ++it )
             {
                 const auto& pair = *it;
 
+                if( compact )
+                {
+                    builder.writeStartArray();
+                    Serializer<TKey>{}.serializeValue( pair.first, builder );
+                    Serializer<TValue>{}.serializeValue( pair.second, builder );
+                    builder.writeEndArray();
+                    continue;
+                }
+
                 builder.writeStartObject();
 
                 // Write key
@@ -211,6 +143,16 @@ namespace nfx::serialization::json
 
             builder.writeEndArray();
         }
+
+        /**
+         * @brief Describe the JSON layout for SchemaOf()
+         * @param builder The builder to write the schema to
+         * @details Array of {"key": ..., "value": ...} objects or [key, value] arrays
+         */
+        static void writeSchema( nfx::json::Builder& builder )
+        {
+            detail::writeKeyValueArraySchema<TKey, TValue>( builder );
+        }
     };
 } // namespace nfx::serialization::json
 
@@ -275,115 +217,34 @@ namespace nfx::serialization::json
                     }
                 }
             }
-            // Check if it's an array format (for backward compatibility)
-            else if( doc.is<Array>( "" ) )
+            // Array of {"key": K, "value": V} objects or [K, V] arrays, as written by serialize()
+            else if( const auto elements = doc.rootRef<Array>() )
             {
-                // Get array and iterate using STL iterator
-                auto arrayOpt = doc.get<Array>( "" );
-                if( arrayOpt.has_value() )
+                for( const auto& pairDoc : elements->get() )
                 {
-                    for( const auto& pairDoc : arrayOpt.value() )
+                    const detail::KeyValueEntry entry = detail::findKeyValue( pairDoc );
+                    if( !entry.key )
                     {
-                        // Extract key - try different types
-                        TKey key{};
-                        bool keyFound = false;
-
-                        if( pairDoc.contains( "key" ) )
-                        {
-                            // Try to deserialize key based on its actual JSON type
-                            if constexpr( std::is_same_v<TKey, std::string> )
-                            {
-                                auto keyOpt = pairDoc.get<std::string>( "key" );
-                                if( keyOpt )
-                                {
-                                    key = *keyOpt;
-                                    keyFound = true;
-                                }
-                            }
-                            else if constexpr( std::is_integral_v<TKey> && !std::is_same_v<TKey, bool> )
-                            {
-                                auto keyOpt = pairDoc.get<int64_t>( "key" );
-                                if( keyOpt )
-                                {
-                                    key = static_cast<TKey>( *keyOpt );
-                                    keyFound = true;
-                                }
-                            }
-                            else if constexpr( std::is_floating_point_v<TKey> )
-                            {
-                                auto keyOpt = pairDoc.get<double>( "key" );
-                                if( keyOpt )
-                                {
-                                    key = static_cast<TKey>( *keyOpt );
-                                    keyFound = true;
-                                }
-                            }
-                            else if constexpr( std::is_same_v<TKey, bool> )
-                            {
-                                auto keyOpt = pairDoc.get<bool>( "key" );
-                                if( keyOpt )
-                                {
-                                    key = *keyOpt;
-                                    keyFound = true;
-                                }
-                            }
-                        }
-
-                        // Extract value - try different types
-                        TValue value{};
-                        bool valueFound = false;
-
-                        if( pairDoc.contains( "value" ) )
-                        {
-                            // Try to deserialize value based on its actual JSON type
-                            if constexpr( std::is_same_v<TValue, std::string> )
-                            {
-                                auto valOpt = pairDoc.get<std::string>( "value" );
-                                if( valOpt )
-                                {
-                                    value = *valOpt;
-                                    valueFound = true;
-                                }
-                            }
-                            else if constexpr( std::is_integral_v<TValue> && !std::is_same_v<TValue, bool> )
-                            {
-                                auto valOpt = pairDoc.get<int64_t>( "value" );
-                                if( valOpt )
-                                {
-                                    value = static_cast<TValue>( *valOpt );
-                                    valueFound = true;
-                                }
-                            }
-                            else if constexpr( std::is_floating_point_v<TValue> )
-                            {
-                                auto valOpt = pairDoc.get<double>( "value" );
-                                if( valOpt )
-                                {
-                                    value = static_cast<TValue>( *valOpt );
-                                    valueFound = true;
-                                }
-                            }
-                            else if constexpr( std::is_same_v<TValue, bool> )
-                            {
-                                auto valOpt = pairDoc.get<bool>( "value" );
-                                if( valOpt )
-                                {
-                                    value = *valOpt;
-                                    valueFound = true;
-                                }
-                            }
-                        }
+                        continue;
+                    }
 
-                        if( keyFound && valueFound )
-                        {
-                            obj.insertOrAssign( std::move( key ), std::move( value ) );
-                        }
+                    TKey key{};
+                    Serializer<TKey>{}.deserializeValue( *entry.key, key );
+                    TValue value{};
+                    Serializer<TValue>{}.deserializeValue( *entry.value, value );
+                    if( detail::deserializationFailed() )
+                    {
+                        return;
                     }
+
+                    obj.insertOrAssign( std::move( key ), std::move( value ) );
                 }
             }
             else
             {
-                throw std::runtime_error{ "Cannot deserialize JSON value into FastHashMap: must be object or array" };
+                detail::reportError(
+                    ErrorCode::TypeMismatch, "Cannot deserialize JSON value into FastHashMap: must be object or array" );
+                return;
             }
         }
 
@@ -391,18 +252,29 @@ namespace nfx::serialization::json
          * @brief High-performance streaming serialization
          * @param obj The FastHashMap object to serialize
          * @param builder The builder to write to
-         * @details Serializes as array of {key, value} objects: [{key:..., value:...}, ...]
+         * @details Serializes as array of {key, value} objects: [{key:..., value:...}, ...],
+         *          or of [key, value] arrays with PairLayout::Array
          */
         static void serialize(
             const nfx::containers::FastHashMap<TKey, TValue, HashType, Seed, Hasher, KeyEqual>& obj,
             nfx::json::Builder& builder )
         {
+            const bool compact = detail::currentPairLayout() == PairLayout::Array;
             builder.writeStartArray();
 
             for( auto it = obj.begin(); it != obj.end(); ++it )
             {
                 const auto& pair = *it;
 
+                if( compact )
+                {
+                    builder.writeStartArray();
+                    Serializer<TKey>{}.serializeValue( pair.first, builder );
+                    Serializer<TValue>{}.serializeValue( pair.second, builder );
+                    builder.writeEndArray();
+                    continue;
+                }
+
                 builder.writeStartObject();
 
                 // Write key
@@ -418,6 +290,16 @@ namespace nfx::serialization::json
 
             builder.writeEndArray();
         }
+
+        /**
+         * @brief Describe the JSON layout for SchemaOf()
+         * @param builder The builder to write the schema to
+         * @details Array of {"key": ..., "value": ...} objects or [key, value] arrays
+         */
+        static void writeSchema( nfx::json::Builder& builder )
+        {
+            detail::writeKeyValueArraySchema<TKey, TValue>( builder );
+        }
     };
 } // namespace nfx::serialization::json
 
@@ -449,7 +331,9 @@ namespace nfx::serialization::json
         {
             if( !doc.is<Array>( "" ) )
             {
-                throw std::runtime_error{ "Cannot deserialize non-array JSON value into FastHashSet" };
+                detail::reportError(
+                    ErrorCode::TypeMismatch, "Cannot deserialize non-array JSON value into FastHashSet" );
+                return;
             }
 
             // Clear existing content
@@ -487,6 +371,16 @@ namespace nfx::serialization::json
 
             builder.writeEndArray();
         }
+
+        /**
+         * @brief Describe the JSON layout for SchemaOf()
+         * @param builder The builder to write the schema to
+         * @details Array of distinct elements
+         */
+        static void writeSchema( nfx::json::Builder& builder )
+        {
+            detail::writeArraySchema<TKey>( builder, true );
+        }
     };
 } // namespace nfx::serialization::json
 
@@ -517,7 +411,9 @@ namespace nfx::serialization::json
         {
             if( !doc.is<Array>( "" ) )
             {
-                throw std::runtime_error{ "Cannot deserialize non-array JSON value into StackVector" };
+                detail::reportError(
+                    ErrorCode::TypeMismatch, "Cannot deserialize non-array JSON value into StackVector" );
+                return;
             }
 
             // Clear existing content
@@ -556,6 +452,16 @@ namespace nfx::serialization::json
 
             builder.writeEndArray();
         }
+
+        /**
+         * @brief Describe the JSON layout for SchemaOf()
+         * @param builder The builder to write the schema to
+         * @details Array of elements
+         */
+        static void writeSchema( nfx::json::Builder& builder )
+        {
+            detail::writeArraySchema<T>( builder );
+        }
     };
 } // namespace nfx::serialization::json
 
@@ -581,119 +487,40 @@ namespace nfx::serialization::json
          * @brief Deserialize OrderedHashMap from JSON document
          * @param doc The document to deserialize from
          * @param obj The OrderedHashMap object to deserialize into
-         * @details Expects array format with key-value pair objects. Preserves insertion order.
+         * @details Expects array format with key-value pair objects or [key, value] arrays.
+         *          Preserves insertion order.
          */
         static void fromDocument(
             const Document& doc, nfx::containers::OrderedHashMap<TKey, TValue, HashType, Seed, Hasher, KeyEqual>& obj )
         {
-            if( !doc.is<Array>( "" ) )
+            const auto elements = doc.rootRef<Array>();
+            if( !elements )
             {
-                throw std::runtime_error{ "Cannot deserialize non-array JSON value into OrderedHashMap" };
+                detail::reportError(
+                    ErrorCode::TypeMismatch, "Cannot deserialize non-array JSON value into OrderedHashMap" );
+                return;
             }
 
             obj.clear();
 
-            // Get array and iterate using STL iterator
-            auto arrayOpt = doc.get<Array>( "" );
-            if( arrayOpt.has_value() )
+            for( const auto& pairDoc : elements->get() )
             {
-                for( const auto& pairDoc : arrayOpt.value() )
+                const detail::KeyValueEntry entry = detail::findKeyValue( pairDoc );
+                if( !entry.key )
                 {
-                    // Extract key - try different types
-                    TKey key{};
-                    bool keyFound = false;
-
-                    if( pairDoc.contains( "key" ) )
-                    {
-                        // Try to deserialize key based on its actual JSON type
-                        if constexpr( std::is_same_v<TKey, std::string> )
-                        {
-                            auto keyOpt = pairDoc.get<std::string>( "key" );
-                            if( keyOpt )
-                            {
-                                key = *keyOpt;
-                                keyFound = true;
-                            }
-                        }
-                        else if constexpr( std::is_integral_v<TKey> && !std::is_same_v<TKey, bool> )
-                        {
-                            auto keyOpt = pairDoc.get<int64_t>( "key" );
-                            if( keyOpt )
-                            {
-                                key = static_cast<TKey>( *keyOpt );
-                                keyFound = true;
-                            }
-                        }
-                        else if constexpr( std::is_floating_point_v<TKey> )
-                        {
-                            auto keyOpt = pairDoc.get<double>( "key" );
-                            if( keyOpt )
-                            {
-                                key = static_cast<TKey>( *keyOpt );
-                                keyFound = true;
-                            }
-                        }
-                        else if constexpr( std::is_same_v<TKey, bool> )
-                        {
-                            auto keyOpt = pairDoc.get<bool>( "key" );
-                            if( keyOpt )
-                            {
-                                key = *keyOpt;
-                                keyFound = true;
-                            }
-                        }
-                    }
-
-                    // Extract value - try different types
-                    TValue value{};
-                    bool valueFound = false;
-
-                    if( pairDoc.contains( "value" ) )
-                    {
-                        // Try to deserialize value based on its actual JSON type
-                        if constexpr( std::is_same_v<TValue, std::string> )
-                        {
-                            auto valOpt = pairDoc.get<std::string>( "value" );
-                            if( valOpt )
-                            {
-                                value = *valOpt;
-                                valueFound = true;
-                            }
-                        }
-                        else if constexpr( std::is_integral_v<TValue> && !std::is_same_v<TValue, bool> )
-                        {
-                            auto valOpt = pairDoc.get<int64_t>( "value" );
-                            if( valOpt )
-                            {
-                                value = static_cast<TValue>( *valOpt );
-                                valueFound = true;
-                            }
-                        }
-                        else if constexpr( std::is_floating_point_v<TValue> )
-                        {
-                            auto valOpt = pairDoc.get<double>( "value" );
-                            if( valOpt )
-                            {
-                                value = static_cast<TValue>( *valOpt );
-                                valueFound = true;
-                            }
-                        }
-                        else if constexpr( std::is_same_v<TValue, bool> )
-                        {
-                            auto valOpt = pairDoc.get<bool>( "value" );
-                            if( valOpt )
-                            {
-                                value = *valOpt;
-                                valueFound = true;
-                            }
-                        }
-                    }
+                    continue;
+                }
 
-                    if( keyFound && valueFound )
-                    {
-                        obj.insertOrAssign( std::move( key ), std::move( value ) );
-                    }
+                TKey key{};
+                Serializer<TKey>{}.deserializeValue( *entry.key, key );
+                TValue value{};
+                Serializer<TValue>{}.deserializeValue( *entry.value, value );
+                if( detail::deserializationFailed() )
+                {
+                    return;
                 }
+
+                obj.insertOrAssign( std::move( key ), std::move( value ) );
             }
         }
 
@@ -701,24 +528,47 @@ namespace nfx::serialization::json
          * @brief Serialize OrderedHashMap to Builder
          * @param obj The OrderedHashMap object to serialize
          * @param builder The builder to write to
-         * @details Serializes as array of {"key": K, "value": V} objects. Preserves insertion order.
+         * @details Serializes as array of {"key": K, "value": V} objects, or of [K, V] arrays with
+         *          PairLayout::Array. Preserves insertion order.
          */
         static void serialize(
             const nfx::containers::OrderedHashMap<TKey, TValue, HashType, Seed, Hasher, KeyEqual>& obj,
             Builder& builder )
         {
+            const bool compact = detail::currentPairLayout() == PairLayout::Array;
             builder.writeStartArray();
 
             for( const auto& [key, value] : obj )
             {
+                if( compact )
+                {
+                    builder.writeStartArray();
+                    Serializer<TKey>{}.serializeValue( key, builder );
+                    Serializer<TValue>{}.serializeValue( value, builder );
+                    builder.writeEndArray();
+                    continue;
+                }
+
                 builder.writeStartObject();
-                builder.write( "key", key );
-                builder.write( "value", value );
+                builder.writeKey( "key" );
+                Serializer<TKey>{}.serializeValue( key, builder );
+                builder.writeKey( "value" );
+                Serializer<TValue>{}.serializeValue( value, builder );
                 builder.writeEndObject();
             }
 
             builder.writeEndArray();
         }
+
+        /**
+         * @brief Describe the JSON layout for SchemaOf()
+         * @param builder The builder to write the schema to
+         * @details Array of {"key": ..., "value": ...} objects or [key, value] arrays
+         */
+        static void writeSchema( nfx::json::Builder& builder )
+        {
+            detail::writeKeyValueArraySchema<TKey, TValue>( builder );
+        }
     };
 } // namespace nfx::serialization::json
 
@@ -751,7 +601,9 @@ namespace nfx::serialization::json
         {
             if( !doc.is<Array>( "" ) )
             {
-                throw std::runtime_error{ "Cannot deserialize non-array JSON value into OrderedHashSet" };
+                detail::reportError(
+                    ErrorCode::TypeMismatch, "Cannot deserialize non-array JSON value into OrderedHashSet" );
+                return;
             }
 
             obj.clear();
@@ -830,6 +682,16 @@ namespace nfx::serialization::json
 
             builder.writeEndArray();
         }
+
+        /**
+         * @brief Describe the JSON layout for SchemaOf()
+         * @param builder The builder to write the schema to
+         * @details Array of distinct elements
+         */
+        static void writeSchema( nfx::json::Builder& builder )
+        {
+            detail::writeArraySchema<TKey>( builder, true );
+        }
     };
 } // namespace nfx::serialization::json
 
@@ -855,44 +717,42 @@ namespace nfx::serialization::json
          * @brief Deserialize StackHashMap from JSON document
          * @param doc The document to deserialize from
          * @param obj The StackHashMap object to deserialize into
-         * @details Expects array format with key-value pair objects
+         * @details Expects array format with key-value pair objects or [key, value] arrays
          */
         static void fromDocument( const Document& doc, nfx::containers::StackHashMap<TKey, TValue, N, KeyEqual>& obj )
         {
-            if( !doc.is<Array>( "" ) )
+            const auto elements = doc.rootRef<Array>();
+            if( !elements )
             {
-                throw std::runtime_error{ "Cannot deserialize non-array JSON value into StackHashMap" };
+                detail::reportError(
+                    ErrorCode::TypeMismatch, "Cannot deserialize non-array JSON value into StackHashMap" );
+                return;
             }
 
             // Clear existing content
             obj.clear();
 
-            // Get array and iterate using STL iterator
-            auto arrayOpt = doc.get<Array>( "" );
-            if( arrayOpt.has_value() )
+            for( const auto& pairDoc : elements->get() )
             {
-                for( const auto& pairDoc : arrayOpt.value() )
+                const detail::KeyValueEntry entry = detail::findKeyValue( pairDoc );
+                if( !entry.key )
                 {
-                    // Extract key
-                    auto keyDoc = pairDoc.get<Document>( "key" );
-                    if( !keyDoc )
-                    {
-                        throw std::runtime_error{ "Missing 'key' field in StackHashMap array element" };
-                    }
-                    TKey key{};
-                    Serializer<TKey>{}.deserializeValue( *keyDoc, key );
-
-                    // Extract value
-                    auto valueDoc = pairDoc.get<Document>( "value" );
-                    if( !valueDoc )
-                    {
-                        throw std::runtime_error{ "Missing 'value' field in StackHashMap array element" };
-                    }
-                    TValue value{};
-                    Serializer<TValue>{}.deserializeValue( *valueDoc, value );
+                    detail::reportError( ErrorCode::MissingField,
+                                         "StackHashMap array element must be a {\"key\", \"value\"} object "
+                                         "or a [key, value] array" );
+                    return;
+                }
 
-                    obj.insertOrAssign( std::move( key ), std::move( value ) );
+                TKey key{};
+                Serializer<TKey>{}.deserializeValue( *entry.key, key );
+                TValue value{};
+                Serializer<TValue>{}.deserializeValue( *entry.value, value );
+                if( detail::deserializationFailed() )
+                {
+                    return;
                 }
+
+                obj.insertOrAssign( std::move( key ), std::move( value ) );
             }
         }
 
@@ -900,14 +760,25 @@ namespace nfx::serialization::json
          * @brief High-performance streaming serialization
          * @param obj The StackHashMap object to serialize
          * @param builder The builder to write to
-         * @details Serializes as array of {key, value} objects: [{key:..., value:...}, ...]
+         * @details Serializes as array of {key, value} objects: [{key:..., value:...}, ...],
+         *          or of [key, value] arrays with PairLayout::Array
          */
         static void serialize(
             const nfx::containers::StackHashMap<TKey, TValue, N, KeyEqual>& obj, nfx::json::Builder& builder )
         {
+            const bool compact = detail::currentPairLayout() == PairLayout::Array;
             builder.writeStartArray();
 
-            obj.forEach( [&builder]( const TKey& key, const TValue& value ) {
+            obj.forEach( [&builder, compact]( const TKey& key, const TValue& value ) {
+                if( compact )
+                {
+                    builder.writeStartArray();
+                    Serializer<TKey>{}.serializeValue( key, builder );
+                    Serializer<TValue>{}.serializeValue( value, builder );
+                    builder.writeEndArray();
+                    return;
+                }
+
                 builder.writeStartObject();
 
                 // Write key
@@ -923,6 +794,16 @@ namespace nfx::serialization::json
 
             builder.writeEndArray();
         }
+
+        /**
+         * @brief Describe the JSON layout for SchemaOf()
+         * @param builder The builder to write the schema to
+         * @details Array of {"key": ..., "value": ...} objects or [key, value] arrays
+         */
+        static void writeSchema( nfx::json::Builder& builder )
+        {
+            detail::writeKeyValueArraySchema<TKey, TValue>( builder );
+        }
     };
 } // namespace nfx::serialization::json
 
@@ -953,7 +834,9 @@ namespace nfx::serialization::json
         {
             if( !doc.is<Array>( "" ) )
             {
-                throw std::runtime_error{ "Cannot deserialize non-array JSON value into StackHashSet" };
+                detail::reportError(
+                    ErrorCode::TypeMismatch, "Cannot deserialize non-array JSON value into StackHashSet" );
+                return;
             }
 
             // Clear existing content
@@ -987,6 +870,16 @@ namespace nfx::serialization::json
 
             builder.writeEndArray();
         }
+
+        /**
+         * @brief Describe the JSON layout for SchemaOf()
+         * @param builder The builder to write the schema to
+         * @details Array of distinct elements
+         */
+        static void writeSchema( nfx::json::Builder& builder )
+        {
+            detail::writeArraySchema<TKey>( builder, true );
+        }
     };
 } // namespace nfx::serialization::json
 
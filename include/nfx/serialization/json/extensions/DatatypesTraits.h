@@ -39,6 +39,7 @@
 
 #pragma once
 
+#include "nfx/serialization/json/Schema.h"
 #include "nfx/serialization/json/Serializer.h"
 
 //=====================================================================
@@ -94,11 +95,60 @@ namespace nfx::serialization::json
                 {
                     if( !nfx::datatypes::Int128::fromString( val.value(), obj ) )
                     {
-                        throw std::runtime_error{ "Invalid Int128 format: unable to parse string representation" };
+                        detail::reportError(
+                            ErrorCode::InvalidFormat, "Invalid Int128 format: unable to parse string representation" );
+                        return;
                     }
                 }
             }
         }
+
+        /**
+         * @brief Describe the JSON layout for SchemaOf()
+         * @param builder The builder to write the schema to
+         * @details Decimal integer string
+         */
+        static void writeSchema( nfx::json::Builder& builder )
+        {
+            builder.writeStartObject();
+            builder.write( "type", "string" );
+            builder.write( "pattern", "^-?[0-9]+$" );
+            builder.writeEndObject();
+        }
+    };
+
+    /**
+     * @brief Map key conversion for nfx::datatypes::Int128
+     * @details Keys are written as decimal integers, like Int128 values.
+     */
+    template <>
+    struct MapKeyTraits<nfx::datatypes::Int128>
+    {
+        /** @brief Sign and 39 digits */
+        static constexpr std::size_t maxLength = 40;
+
+        /**
+         * @brief Format a key
+         * @param key Key to format
+         * @param buffer Output buffer
+         * @return Decimal text of the key, in the buffer
+         */
+        static std::string_view format( const nfx::datatypes::Int128& key, std::array<char, maxLength>& buffer )
+        {
+            const std::string text = key.toString();
+            return { buffer.data(), text.copy( buffer.data(), buffer.size() ) };
+        }
+
+        /**
+         * @brief Parse a key
+         * @param text Member name
+         * @param key Parsed key
+         * @return True if the text is a decimal integer in range
+         */
+        static bool parse( std::string_view text, nfx::datatypes::Int128& key )
+        {
+            return !text.empty() && nfx::datatypes::Int128::fromString( text, key );
+        }
     };
 } // namespace nfx::serialization::json
 
@@ -157,11 +207,25 @@ namespace nfx::serialization::json
                 {
                     if( !nfx::datatypes::Decimal::fromString( val.value(), obj ) )
                     {
-                        throw std::runtime_error{ "Invalid Decimal format: unable to parse string representation" };
+                        detail::reportError(
+                            ErrorCode::InvalidFormat, "Invalid Decimal format: unable to parse string representation" );
+                        return;
                     }
                 }
             }
         }
+
+        /**
+         * @brief Describe the JSON layout for SchemaOf()
+         * @param builder The builder to write the schema to
+         * @details Decimal number string
+         */
+        static void writeSchema( nfx::json::Builder& builder )
+        {
+            builder.writeStartObject();
+            builder.write( "type", "string" );
+            builder.writeEndObject();
+        }
     };
 } // namespace nfx::serialization::json
 
@@ -24,9 +24,15 @@
 
 /**
  * @file DateTimeTraits.h
- * @brief SerializationTraits specializations for nfx-datetime types
+ * @brief SerializationTraits specializations for std::chrono and nfx-datetime types
  * @details This is an optional extension header that provides JSON serialization support
- *          for nfx::time types (DateTime, DateTimeOffset, TimeSpan).
+ *          for std::chrono::duration and std::chrono::time_point, and for nfx::time types
+ *          (DateTime, DateTimeOffset, TimeSpan).
+ *
+ *          std::chrono values are written as tick counts by default, or as ISO 8601 strings
+ *          with Options::timeFormat = TimeFormat::Iso8601 ("PT1H30M45S" for durations,
+ *          "2024-06-15T14:30:45.1230000Z" for system_clock time points, in the layout of
+ *          TimeSpan and DateTime). Both forms are read back regardless of the option.
  *
  *          This header is safe to include even if nfx-datetime is not available.
  *          Each datetime type is independently supported - you can use any subset.
@@ -39,8 +45,689 @@
 
 #pragma once
 
+#include "nfx/serialization/json/Schema.h"
 #include "nfx/serialization/json/Serializer.h"
 
+#include <array>
+#include <charconv>
+#include <chrono>
+#include <cstdint>
+#include <limits>
+#include <ratio>
+#include <string_view>
+#include <type_traits>
+
+//=====================================================================
+// std::chrono support - always available
+//=====================================================================
+
+namespace nfx::serialization::json
+{
+    namespace detail
+    {
+        //----------------------------------------------
+        // ISO 8601 formatting
+        //----------------------------------------------
+
+        /** @brief Stack buffer holding the ISO 8601 text of a std::chrono value */
+        using IsoTimeBuffer = std::array<char, 64>;
+
+        /**
+         * @brief Power of ten
+         * @param digits Exponent (at most 18)
+         * @return 10^digits
+         */
+        consteval std::int64_t isoScale( int digits )
+        {
+            std::int64_t scale = 1;
+            for( int i = 0; i < digits; ++i )
+            {
+                scale *= 10;
+            }
+            return scale;
+        }
+
+        /**
+         * @brief Number of fractional second digits written for a duration type
+         * @tparam Rep Tick representation
+         * @tparam Period Tick period
+         * @return Fewest digits writing one tick exactly (0 for seconds, 3 for milliseconds, 9 for
+         *         nanoseconds), 9 for floating-point ticks and periods that are no power of ten
+         */
+        template <typename Rep, typename Period>
+        consteval int isoFractionDigits()
+        {
+            if constexpr( std::is_floating_point_v<Rep> )
+            {
+                return 9;
+            }
+            else
+            {
+                for( int digits = 0; digits <= 18; ++digits )
+                {
+                    if( isoScale( digits ) % Period::den == 0 )
+                    {
+                        return digits;
+                    }
+                }
+                return 9;
+            }
+        }
+
+        /**
+         * @brief Convert a duration to ticks of 10^-Digits seconds
+         * @tparam Digits Fractional second digits
+         * @param value Duration to convert (floating-point ticks are rounded)
+         * @return Tick count
+         */
+        template <int Digits, typename Rep, typename Period>
+        inline std::int64_t isoTicks( std::chrono::duration<Rep, Period> value ) noexcept
+        {
+            using Fine = std::chrono::duration<std::int64_t, std::ratio<1, isoScale( Digits )>>;
+
+            if constexpr( std::is_floating_point_v<Rep> )
+            {
+                return std::chrono::round<Fine>( value ).count();
+            }
+            else
+            {
+                return std::chrono::duration_cast<Fine>( value ).count();
+            }
+        }
+
+        /**
+         * @brief Write a zero-padded number
+         * @param out Output position
+         * @param value Number to write
+         * @param width Number of digits
+         * @return Position after the digits
+         */
+        inline char* writeIsoDigits( char* out, std::uint64_t value, int width ) noexcept
+        {
+            for( int i = width - 1; i >= 0; --i )
+            {
+                out[i] = static_cast<char>( '0' + value % 10 );
+                value /= 10;
+            }
+            return out + width;
+        }
+
+        /**
+         * @brief Format a duration as an ISO 8601 duration ("PT1H30M45.5S", "-PT0.25S", "PT0S")
+         * @param value Duration to format
+         * @param buffer Output buffer
+         * @return Text of the duration, in the buffer
+         * @details Hours are not folded into days, so the text reads back into any duration type.
+         */
+        template <typename Rep, typename Period>
+        inline std::string_view formatIsoDuration( std::chrono::duration<Rep, Period> value,
+            IsoTimeBuffer& buffer ) noexcept
+        {
+            constexpr int digits = isoFractionDigits<Rep, Period>();
+            constexpr auto scale = static_cast<std::uint64_t>( isoScale( digits ) );
+
+            const std::int64_t ticks = isoTicks<digits>( value );
+            const std::uint64_t magnitude =
+                ticks < 0 ? 0 - static_cast<std::uint64_t>( ticks ) : static_cast<std::uint64_t>( ticks );
+            const std::uint64_t seconds = magnitude / scale;
+            std::uint64_t fraction = magnitude % scale;
+
+            char* out = buffer.data();
+            char* const end = buffer.data() + buffer.size();
+            if( ticks < 0 )
+            {
+                *out++ = '-';
+            }
+            *out++ = 'P';
+            *out++ = 'T';
+
+            const std::uint64_t hours = seconds / 3600;
+            const std::uint64_t minutes = seconds / 60 % 60;
+            if( hours != 0 )
+            {
+                out = std::to_chars( out, end, hours ).ptr;
+                *out++ = 'H';
+            }
+            if( minutes != 0 )
+            {
+                out = std::to_chars( out, end, minutes ).ptr;
+                *out++ = 'M';
+            }
+            if( seconds % 60 != 0 || fraction != 0 || ( hours == 0 && minutes == 0 ) )
+            {
+                out = std::to_chars( out, end, seconds % 60 ).ptr;
+                if( fraction != 0 )
+                {
+                    int width = digits;
+                    while( fraction % 10 == 0 )
+                    {
+                        fraction /= 10;
+                        --width;
+                    }
+                    *out++ = '.';
+                    out = writeIsoDigits( out, fraction, width );
+                }
+                *out++ = 'S';
+            }
+
+            return { buffer.data(), static_cast<std::size_t>( out - buffer.data() ) };
+        }
+
+        /**
+         * @brief Format a system_clock time point as an ISO 8601 UTC date-time
+         * @param value Time point to format
+         * @param buffer Output buffer
+         * @return Text such as "2024-06-15T14:30:45.123Z", in the buffer
+         * @details Fractional seconds have the fixed width of the duration type (none for seconds,
+         *          nine digits for nanoseconds), so every value of a type has the same length.
+         *          Years outside 0000-9999 use the signed expanded form ("-1029-12-29T00:00:00Z",
+         *          "+10000-01-01T00:00:00Z"), which parseIsoDateTime() reads back.
+         */
+        template <typename Duration>
+        inline std::string_view formatIsoDateTime(
+            std::chrono::time_point<std::chrono::system_clock, Duration> value, IsoTimeBuffer& buffer ) noexcept
+        {
+            constexpr int digits = isoFractionDigits<typename Duration::rep, typename Duration::period>();
+            constexpr std::int64_t scale = isoScale( digits );
+
+            // Floor to whole seconds and days, so instants before 1970 keep a positive time of day
+            const std::int64_t ticks = isoTicks<digits>( value.time_since_epoch() );
+            std::int64_t seconds = ticks / scale;
+            std::int64_t fraction = ticks % scale;
+            if( fraction < 0 )
+            {
+                fraction += scale;
+                --seconds;
+            }
+            std::int64_t days = seconds / 86400;
+            std::int64_t secondOfDay = seconds % 86400;
+            if( secondOfDay < 0 )
+            {
+                secondOfDay += 86400;
+                --days;
+            }
+
+            const std::chrono::year_month_day date{ std::chrono::sys_days{ std::chrono::days{ days } } };
+            const int year = static_cast<int>( date.year() );
+
+            char* out = buffer.data();
+            if( year < 0 || year > 9999 )
+            {
+                *out++ = year < 0 ? '-' : '+';
+            }
+            const auto absoluteYear = static_cast<std::uint64_t>( year < 0 ? -year : year );
+            out = writeIsoDigits( out, absoluteYear, absoluteYear > 9999 ? 5 : 4 );
+            *out++ = '-';
+            out = writeIsoDigits( out, static_cast<unsigned>( date.month() ), 2 );
+            *out++ = '-';
+            out = writeIsoDigits( out, static_cast<unsigned>( date.day() ), 2 );
+            *out++ = 'T';
+            out = writeIsoDigits( out, static_cast<std::uint64_t>( secondOfDay / 3600 ), 2 );
+            *out++ = ':';
+            out = writeIsoDigits( out, static_cast<std::uint64_t>( secondOfDay / 60 % 60 ), 2 );
+            *out++ = ':';
+            out = writeIsoDigits( out, static_cast<std::uint64_t>( secondOfDay % 60 ), 2 );
+            if constexpr( digits > 0 )
+            {
+                *out++ = '.';
+                out = writeIsoDigits( out, static_cast<std::uint64_t>( fraction ), digits );
+            }
+            *out++ = 'Z';
+
+            return { buffer.data(), static_cast<std::size_t>( out - buffer.data() ) };
+        }
+
+        //----------------------------------------------
+        // ISO 8601 parsing
+        //----------------------------------------------
+
+        /**
+         * @brief Consume an expected character
+         * @param text Remaining text, advanced on success
+         * @param expected Character to consume
+         * @return True if the text started with the character
+         */
+        inline bool skipIsoChar( std::string_view& text, char expected ) noexcept
+        {
+            if( text.empty() || text.front() != expected )
+            {
+                return false;
+            }
+            text.remove_prefix( 1 );
+            return true;
+        }
+
+        /**
+         * @brief Read a number of one or more digits
+         * @param text Remaining text, advanced past the digits
+         * @param value Parsed number
+         * @return False if the text does not start with a digit or the number overflows
+         */
+        inline bool readIsoNumber( std::string_view& text, std::uint64_t& value ) noexcept
+        {
+            const auto [end, ec] = std::from_chars( text.data(), text.data() + text.size(), value );
+            if( ec != std::errc{} )
+            {
+                return false;
+            }
+            text.remove_prefix( static_cast<std::size_t>( end - text.data() ) );
+            return true;
+        }
+
+        /**
+         * @brief Read a fixed-width field of digits
+         * @param text Remaining text, advanced past the field
+         * @param width Number of digits
+         * @param value Parsed field
+         * @return False if the text does not start with width digits
+         */
+        inline bool readIsoField( std::string_view& text, std::size_t width, int& value ) noexcept
+        {
+            if( text.size() < width )
+            {
+                return false;
+            }
+            value = 0;
+            for( std::size_t i = 0; i < width; ++i )
+            {
+                if( text[i] < '0' || text[i] > '9' )
+                {
+                    return false;
+                }
+                value = value * 10 + ( text[i] - '0' );
+            }
+            text.remove_prefix( width );
+            return true;
+        }
+
+        /**
+         * @brief Read the year of a date, in the basic or the signed expanded form
+         * @param text Remaining text, advanced past the year
+         * @param year Parsed year
+         * @return False if the text does not start with four digits, or with a sign and four to six
+         *         digits, or if the year is outside the range of std::chrono::year
+         */
+        inline bool readIsoYear( std::string_view& text, int& year ) noexcept
+        {
+            const bool negative = skipIsoChar( text, '-' );
+            const bool expanded = negative || skipIsoChar( text, '+' );
+
+            std::size_t width = 0;
+            while( width < text.size() && text[width] >= '0' && text[width] <= '9' )
+            {
+                ++width;
+            }
+            if( expanded ? ( width < 4 || width > 6 ) : width != 4 )
+            {
+                return false;
+            }
+
+            int magnitude = 0;
+            readIsoField( text, width, magnitude );
+            year = negative ? -magnitude : magnitude;
+            return magnitude <= static_cast<int>( std::chrono::year::max() );
+        }
+
+        /**
+         * @brief Read fractional second digits, following a '.' or ',' separator
+         * @param text Remaining text, advanced past the digits
+         * @param attoseconds Fraction in units of 10^-18 seconds (further digits are ignored)
+         * @return False if no digit follows
+         */
+        inline bool readIsoFraction( std::string_view& text, std::int64_t& attoseconds ) noexcept
+        {
+            std::int64_t scale = isoScale( 17 );
+            std::size_t count = 0;
+            attoseconds = 0;
+            while( count < text.size() && text[count] >= '0' && text[count] <= '9' )
+            {
+                attoseconds += ( text[count] - '0' ) * scale;
+                scale /= 10;
+                ++count;
+            }
+            text.remove_prefix( count );
+            return count != 0;
+        }
+
+        /**
+         * @brief Build a duration from seconds and attoseconds
+         * @tparam Duration Target duration type (truncating when coarser)
+         * @param seconds Whole seconds
+         * @param attoseconds Fractional part
+         * @return Duration value
+         */
+        template <typename Duration>
+        inline Duration isoDuration( std::int64_t seconds, std::int64_t attoseconds ) noexcept
+        {
+            // The fraction goes through the type's own decimal precision, as attoseconds cannot be
+            // related to long periods (hours) without overflowing std::ratio
+            constexpr int digits = isoFractionDigits<typename Duration::rep, typename Duration::period>();
+            using Fine = std::chrono::duration<std::int64_t, std::ratio<1, isoScale( digits )>>;
+
+            return std::chrono::duration_cast<Duration>( std::chrono::seconds{ seconds } ) +
+                   std::chrono::duration_cast<Duration>( Fine{ attoseconds / isoScale( 18 - digits ) } );
+        }
+
+        /**
+         * @brief Parse an ISO 8601 duration ("PT1H30M", "P2DT4H", "-PT0.5S")
+         * @param text Duration text; days are 24 hours, years, months and weeks are rejected, as is
+         *             a 'T' not followed by an hour, minute or second component
+         * @param value Parsed duration
+         * @return False if the text is not a valid duration
+         */
+        template <typename Rep, typename Period>
+        inline bool parseIsoDuration( std::string_view text, std::chrono::duration<Rep, Period>& value ) noexcept
+        {
+            const bool negative = skipIsoChar( text, '-' );
+            if( !skipIsoChar( text, 'P' ) || text.empty() )
+            {
+                return false;
+            }
+
+            constexpr auto limit = static_cast<std::uint64_t>( std::numeric_limits<std::int64_t>::max() );
+            std::uint64_t seconds = 0;
+            std::int64_t attoseconds = 0;
+            bool inTime = false;
+            int lastUnit = 0;
+            while( !text.empty() )
+            {
+                if( !inTime && skipIsoChar( text, 'T' ) )
+                {
+                    inTime = true;
+                    continue;
+                }
+
+                std::uint64_t number = 0;
+                if( !readIsoNumber( text, number ) )
+                {
+                    return false;
+                }
+                const bool fractional = skipIsoChar( text, '.' ) || skipIsoChar( text, ',' );
+                if( fractional && !readIsoFraction( text, attoseconds ) )
+                {
+                    return false;
+                }
+                if( text.empty() )
+                {
+                    return false;
+                }
+
+                // Units in decreasing order, the fraction only on seconds
+                std::uint64_t unitSeconds = 0;
+                int unit = 0;
+                switch( text.front() )
+                {
+                    case 'D':
+                        unitSeconds = inTime ? 0 : 86400;
+                        unit = 1;
+                        break;
+                    case 'H':
+                        unitSeconds = inTime ? 3600 : 0;
+                        unit = 2;
+                        break;
+                    case 'M':
+                        unitSeconds = inTime ? 60 : 0;
+                        unit = 3;
+                        break;
+                    case 'S':
+                        unitSeconds = inTime ? 1 : 0;
+                        unit = 4;
+                        break;
+                    default:
+                        break;
+                }
+                if( unitSeconds == 0 || unit <= lastUnit || ( fractional && unit != 4 ) ||
+                    number > ( limit - seconds ) / unitSeconds )
+                {
+                    return false;
+                }
+                seconds += number * unitSeconds;
+                lastUnit = unit;
+                text.remove_prefix( 1 );
+            }
+            // Time components (hours and below) are the only units after 'T'
+            if( lastUnit == 0 || ( inTime && lastUnit < 2 ) )
+            {
+                return false;
+            }
+
+            const auto parsed =
+                isoDuration<std::chrono::duration<Rep, Period>>( static_cast<std::int64_t>( seconds ), attoseconds );
+            value = negative ? -parsed : parsed;
+            return true;
+        }
+
+        /**
+         * @brief Parse an ISO 8601 date-time with a UTC designator or offset
+         * @param text Text such as "2024-06-15T14:30:45.123Z", "2024-06-15T16:30:45+02:00" or, for
+         *             years outside 0000-9999, "-1029-12-29T00:00:00Z"
+         * @param value Parsed time point
+         * @return False if the text is not a valid date-time
+         */
+        template <typename Duration>
+        inline bool parseIsoDateTime(
+            std::string_view text, std::chrono::time_point<std::chrono::system_clock, Duration>& value ) noexcept
+        {
+            int year = 0;
+            int month = 0;
+            int day = 0;
+            int hour = 0;
+            int minute = 0;
+            int second = 0;
+            if( !readIsoYear( text, year ) || !skipIsoChar( text, '-' ) || !readIsoField( text, 2, month ) ||
+                !skipIsoChar( text, '-' ) || !readIsoField( text, 2, day ) ||
+                !( skipIsoChar( text, 'T' ) || skipIsoChar( text, 't' ) || skipIsoChar( text, ' ' ) ) ||
+                !readIsoField( text, 2, hour ) || !skipIsoChar( text, ':' ) || !readIsoField( text, 2, minute ) ||
+                !skipIsoChar( text, ':' ) || !readIsoField( text, 2, second ) )
+            {
+                return false;
+            }
+
+            std::int64_t attoseconds = 0;
+            if( ( skipIsoChar( text, '.' ) || skipIsoChar( text, ',' ) ) && !readIsoFraction( text, attoseconds ) )
+            {
+                return false;
+            }
+
+            std::int64_t offset = 0;
+            if( !skipIsoChar( text, 'Z' ) && !skipIsoChar( text, 'z' ) )
+            {
+                const bool ahead = skipIsoChar( text, '+' );
+                if( !ahead && !skipIsoChar( text, '-' ) )
+                {
+                    return false;
+                }
+                int offsetHours = 0;
+                int offsetMinutes = 0;
+                if( !readIsoField( text, 2, offsetHours ) || !skipIsoChar( text, ':' ) ||
+                    !readIsoField( text, 2, offsetMinutes ) || offsetHours > 23 || offsetMinutes > 59 )
+                {
+                    return false;
+                }
+                offset = ( ahead ? 1 : -1 ) * ( offsetHours * 3600 + offsetMinutes * 60 );
+            }
+
+            const std::chrono::year_month_day date{ std::chrono::year{ year },
+                std::chrono::month{ static_cast<unsigned>( month ) },
+                std::chrono::day{ static_cast<unsigned>( day ) } };
+            if( !text.empty() || !date.ok() || hour > 23 || minute > 59 || second > 59 )
+            {
+                return false;
+            }
+
+            const std::int64_t seconds =
+                static_cast<std::int64_t>( std::chrono::sys_days{ date }.time_since_epoch().count() ) * 86400 +
+                hour * 3600 + minute * 60 + second - offset;
+            value = std::chrono::time_point<std::chrono::system_clock, Duration>{
+                isoDuration<Duration>( seconds, attoseconds ) };
+            return true;
+        }
+    } // namespace detail
+
+    /**
+     * @brief Specialization for std::chrono::duration
+     */
+    template <typename Rep, typename Period>
+    struct SerializationTraits<std::chrono::duration<Rep, Period>>
+    {
+        /** @brief Serialized duration type */
+        using Duration = std::chrono::duration<Rep, Period>;
+
+        /**
+         * @brief High-performance streaming serialization
+         * @param obj The duration to serialize
+         * @param builder The builder to write to
+         * @details Tick count (e.g. 1500 for 1500ms), or ISO 8601 duration ("PT1.5S") with TimeFormat::Iso8601
+         */
+        static void serialize( const Duration& obj, Builder& builder )
+        {
+            if( detail::currentTimeFormat() == TimeFormat::Iso8601 )
+            {
+                detail::IsoTimeBuffer buffer;
+                builder.write( detail::formatIsoDuration( obj, buffer ) );
+                return;
+            }
+            Serializer<Rep>{}.serializeValue( obj.count(), builder );
+        }
+
+        /**
+         * @brief Deserialize a duration from JSON document
+         * @param doc The document to deserialize from
+         * @param obj The duration to deserialize into
+         * @details Accepts tick counts and ISO 8601 duration strings
+         */
+        static void fromDocument( const Document& doc, Duration& obj )
+        {
+            if( const auto text = doc.rootRef<std::string>() )
+            {
+                if( !detail::parseIsoDuration( std::string_view{ text->get() }, obj ) )
+                {
+                    detail::reportError(
+                        ErrorCode::InvalidFormat, "Invalid duration: expected tick count or ISO 8601 duration string" );
+                }
+                return;
+            }
+
+            Rep ticks{};
+            Serializer<Rep>{}.deserializeValue( doc, ticks );
+            obj = Duration{ ticks };
+        }
+
+        /**
+         * @brief Describe the JSON layout for SchemaOf()
+         * @param builder The builder to write the schema to
+         * @details Tick count or ISO 8601 duration string
+         */
+        static void writeSchema( nfx::json::Builder& builder )
+        {
+            builder.writeStartObject();
+            builder.writeKey( "anyOf" );
+            builder.writeStartArray();
+            detail::writeSchema<Rep>( builder );
+            builder.writeStartObject();
+            builder.write( "type", "string" );
+            builder.write( "format", "duration" );
+            builder.writeEndObject();
+            builder.writeEndArray();
+            builder.writeEndObject();
+        }
+    };
+
+    /**
+     * @brief Specialization for std::chrono::time_point
+     */
+    template <typename Clock, typename Duration>
+    struct SerializationTraits<std::chrono::time_point<Clock, Duration>>
+    {
+        /** @brief Serialized time point type */
+        using TimePoint = std::chrono::time_point<Clock, Duration>;
+
+        /** @brief Whether values have a calendar date (system_clock), otherwise an offset from the clock's epoch */
+        static constexpr bool isCalendar = std::is_same_v<Clock, std::chrono::system_clock>;
+
+        /**
+         * @brief High-performance streaming serialization
+         * @param obj The time point to serialize
+         * @param builder The builder to write to
+         * @details Ticks since the clock's epoch, or with TimeFormat::Iso8601 an ISO 8601 UTC date-time
+         *          for system_clock and an ISO 8601 duration since the epoch for other clocks (steady_clock)
+         */
+        static void serialize( const TimePoint& obj, Builder& builder )
+        {
+            if( detail::currentTimeFormat() == TimeFormat::Iso8601 )
+            {
+                detail::IsoTimeBuffer buffer;
+                if constexpr( isCalendar )
+                {
+                    builder.write( detail::formatIsoDateTime( obj, buffer ) );
+                }
+                else
+                {
+                    builder.write( detail::formatIsoDuration( obj.time_since_epoch(), buffer ) );
+                }
+                return;
+            }
+            Serializer<typename Duration::rep>{}.serializeValue( obj.time_since_epoch().count(), builder );
+        }
+
+        /**
+         * @brief Deserialize a time point from JSON document
+         * @param doc The document to deserialize from
+         * @param obj The time point to deserialize into
+         * @details Accepts tick counts and ISO 8601 strings
+         */
+        static void fromDocument( const Document& doc, TimePoint& obj )
+        {
+            if( const auto text = doc.rootRef<std::string>() )
+            {
+                if constexpr( isCalendar )
+                {
+                    if( !detail::parseIsoDateTime( std::string_view{ text->get() }, obj ) )
+                    {
+                        detail::reportError( ErrorCode::InvalidFormat,
+                            "Invalid time point: expected tick count or ISO 8601 date-time string" );
+                    }
+                }
+                else
+                {
+                    Duration sinceEpoch{};
+                    if( !detail::parseIsoDuration( std::string_view{ text->get() }, sinceEpoch ) )
+                    {
+                        detail::reportError( ErrorCode::InvalidFormat,
+                            "Invalid time point: expected tick count or ISO 8601 duration string" );
+                        return;
+                    }
+                    obj = TimePoint{ sinceEpoch };
+                }
+                return;
+            }
+
+            typename Duration::rep ticks{};
+            Serializer<typename Duration::rep>{}.deserializeValue( doc, ticks );
+            obj = TimePoint{ Duration{ ticks } };
+        }
+
+        /**
+         * @brief Describe the JSON layout for SchemaOf()
+         * @param builder The builder to write the schema to
+         * @details Tick count or ISO 8601 string
+         */
+        static void writeSchema( nfx::json::Builder& builder )
+        {
+            builder.writeStartObject();
+            builder.writeKey( "anyOf" );
+            builder.writeStartArray();
+            detail::writeSchema<typename Duration::rep>( builder );
+            builder.writeStartObject();
+            builder.write( "type", "string" );
+            builder.write( "format", std::string_view{ isCalendar ? "date-time" : "duration" } );
+            builder.writeEndObject();
+            builder.writeEndArray();
+            builder.writeEndObject();
+        }
+    };
+} // namespace nfx::serialization::json
+
 //=====================================================================
 // TimeSpan support - enabled only if header is available
 //=====================================================================
@@ -82,11 +769,26 @@ namespace nfx::serialization::json
                 {
                     if( !nfx::time::TimeSpan::fromString( val.value(), obj ) )
                     {
-                        throw std::runtime_error{ "Invalid TimeSpan format: expected ISO 8601 duration string" };
+                        detail::reportError(
+                            ErrorCode::InvalidFormat, "Invalid TimeSpan format: expected ISO 8601 duration string" );
+                        return;
                     }
                 }
             }
         }
+
+        /**
+         * @brief Describe the JSON layout for SchemaOf()
+         * @param builder The builder to write the schema to
+         * @details ISO 8601 duration string
+         */
+        static void writeSchema( nfx::json::Builder& builder )
+        {
+            builder.writeStartObject();
+            builder.write( "type", "string" );
+            builder.write( "format", "duration" );
+            builder.writeEndObject();
+        }
     };
 } // namespace nfx::serialization::json
 
@@ -133,11 +835,26 @@ namespace nfx::serialization::json
                 {
                     if( !nfx::time::DateTime::fromString( val.value(), obj ) )
                     {
-                        throw std::runtime_error{ "Invalid DateTime format: expected ISO 8601 string" };
+                        detail::reportError(
+                            ErrorCode::InvalidFormat, "Invalid DateTime format: expected ISO 8601 string" );
+                        return;
                     }
                 }
             }
         }
+
+        /**
+         * @brief Describe the JSON layout for SchemaOf()
+         * @param builder The builder to write the schema to
+         * @details ISO 8601 date-time string
+         */
+        static void writeSchema( nfx::json::Builder& builder )
+        {
+            builder.writeStartObject();
+            builder.write( "type", "string" );
+            builder.write( "format", "date-time" );
+            builder.writeEndObject();
+        }
     };
 } // namespace nfx::serialization::json
 
@@ -184,11 +901,26 @@ namespace nfx::serialization::json
                 {
                     if( !nfx::time::DateTimeOffset::fromString( val.value(), obj ) )
                     {
-                        throw std::runtime_error{ "Invalid DateTimeOffset format: expected ISO 8601 string" };
+                        detail::reportError(
+                            ErrorCode::InvalidFormat, "Invalid DateTimeOffset format: expected ISO 8601 string" );
+                        return;
                     }
                 }
             }
         }
+
+        /**
+         * @brief Describe the JSON layout for SchemaOf()
+         * @param builder The builder to write the schema to
+         * @details ISO 8601 date-time string with offset
+         */
+        static void writeSchema( nfx::json::Builder& builder )
+        {
+            builder.writeStartObject();
+            builder.write( "type", "string" );
+            builder.write( "format", "date-time" );
+            builder.writeEndObject();
+        }
     };
 } // namespace nfx::serialization::json
 
@@ -0,0 +1,258 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2026 nfx
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * @file EnumTraits.h
+ * @brief Customization of enumeration names
+ * @details Enumerations serialize by default as the name of their enumerator ("Red"). Names are
+ *          collected at compile time, either from EnumTraits or by reflecting every value of a
+ *          range through the compiler's function signature (the technique type_name() uses), and
+ *          written as pre-escaped literals. Decoding resolves names through a compile-time
+ *          perfect hash table. EnumFormat::Integer writes the underlying value instead.
+ *
+ *          Flag enumerations (EnumTraits<E>::flags) serialize as arrays of names, e.g.
+ *          Permission::Read | Permission::Write -> ["Read","Write"].
+ */
+
+#pragma once
+
+#include <array>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <string_view>
+#include <type_traits>
+
+namespace nfx::serialization::json
+{
+    //=====================================================================
+    // Enum format
+    //=====================================================================
+
+    /**
+     * @brief How enumeration values are written to JSON
+     * @details The reader accepts both formats regardless of the option.
+     */
+    enum class EnumFormat : std::uint8_t
+    {
+        Name = 0, ///< Enumerator name ("Red"); flags as arrays of names, unnamed values as numbers
+        Integer   ///< Underlying value (compact, immune to renames)
+    };
+
+    //=====================================================================
+    // EnumTraits - enumeration naming customization point
+    //=====================================================================
+
+    /**
+     * @brief Enumeration naming traits
+     * @tparam Enum The enumeration type
+     * @details Without a specialization, names are reflected from the enumerators whose values lie
+     *          in [-128, 127] (clamped to the underlying type), or from single-bit values for flags.
+     *          Reflection needs GCC, Clang or MSVC; NFX_SERIALIZATION_ENUM() lists the enumerators
+     *          explicitly instead.
+     *
+     *          All members are optional:
+     *          - `values`: the enumerators to name (std::array<Enum, N>)
+     *          - `names`: one name per entry of `values` (default: the enumerator identifiers)
+     *          - `min`, `max`: reflected value range (default -128 and 127)
+     *          - `flags`: true for bitmask enumerations written as arrays of names
+     *
+     * **Example: Wire names differing from the identifiers**
+     * ```cpp
+     * template <>
+     * struct EnumTraits<LogLevel>
+     * {
+     *     static constexpr std::array values{ LogLevel::Warning, LogLevel::Error };
+     *     static constexpr std::array<std::string_view, 2> names{ "warn", "error" };
+     * };
+     * // LogLevel::Warning -> "warn"
+     * ```
+     */
+    template <typename Enum>
+    struct EnumTraits
+    {
+    };
+
+    //=====================================================================
+    // SFINAE detectors
+    //=====================================================================
+
+    namespace detail
+    {
+        /**
+         * @brief Detects an explicit enumerator list
+         * @tparam E Enumeration type
+         */
+        template <typename E>
+        inline constexpr bool has_enum_values_v = requires {
+            { EnumTraits<E>::values[0] } -> std::convertible_to<E>;
+            std::tuple_size<std::remove_cvref_t<decltype( EnumTraits<E>::values )>>::value;
+        };
+
+        /**
+         * @brief Detects explicit enumerator names
+         * @tparam E Enumeration type
+         */
+        template <typename E>
+        inline constexpr bool has_enum_names_v = requires {
+            { EnumTraits<E>::names[0] } -> std::convertible_to<std::string_view>;
+        };
+
+        /**
+         * @brief Whether an enumeration is a set of flags
+         * @tparam E Enumeration type
+         * @return EnumTraits<E>::flags if declared, otherwise false
+         */
+        template <typename E>
+        constexpr bool isFlagEnum() noexcept
+        {
+            if constexpr( requires { EnumTraits<E>::flags; } )
+            {
+                return EnumTraits<E>::flags;
+            }
+            else
+            {
+                return false;
+            }
+        }
+
+        /**
+         * @brief Lowest value reflected for an enumeration
+         * @tparam E Enumeration type
+         * @return EnumTraits<E>::min if declared, otherwise -128, clamped to the underlying type
+         */
+        template <typename E>
+        constexpr std::int64_t enumRangeMin() noexcept
+        {
+            using Underlying = std::underlying_type_t<E>;
+
+            std::int64_t min = -128;
+            if constexpr( requires { EnumTraits<E>::min; } )
+            {
+                min = static_cast<std::int64_t>( EnumTraits<E>::min );
+            }
+            if constexpr( std::is_unsigned_v<Underlying> )
+            {
+                return min < 0 ? 0 : min;
+            }
+            else
+            {
+                constexpr auto lowest = static_cast<std::int64_t>( std::numeric_limits<Underlying>::min() );
+                return min < lowest ? lowest : min;
+            }
+        }
+
+        /**
+         * @brief Highest value reflected for an enumeration
+         * @tparam E Enumeration type
+         * @return EnumTraits<E>::max if declared, otherwise 127, clamped to the underlying type
+         */
+        template <typename E>
+        constexpr std::int64_t enumRangeMax() noexcept
+        {
+            using Underlying = std::underlying_type_t<E>;
+
+            std::int64_t max = 127;
+            if constexpr( requires { EnumTraits<E>::max; } )
+            {
+                max = static_cast<std::int64_t>( EnumTraits<E>::max );
+            }
+            constexpr auto highest = std::numeric_limits<Underlying>::max();
+            if constexpr( static_cast<std::uint64_t>( highest ) <
+                          static_cast<std::uint64_t>( std::numeric_limits<std::int64_t>::max() ) )
+            {
+                return max > static_cast<std::int64_t>( highest ) ? static_cast<std::int64_t>( highest ) : max;
+            }
+            else
+            {
+                return max;
+            }
+        }
+
+        /**
+         * @brief Split a stringized enumerator list into names
+         * @tparam N Number of enumerators
+         * @param list Comma-separated identifiers, as produced by #__VA_ARGS__
+         * @return One trimmed name per enumerator
+         */
+        template <std::size_t N>
+        consteval std::array<std::string_view, N> splitEnumNames( std::string_view list )
+        {
+            const auto isSpace = []( char c ) { return c == ' ' || c == '\t' || c == '\n' || c == '\r'; };
+
+            std::array<std::string_view, N> names{};
+            for( std::size_t i = 0; i < N; ++i )
+            {
+                const std::size_t comma = list.find( ',' );
+                std::string_view name = list.substr( 0, comma );
+                while( !name.empty() && isSpace( name.front() ) )
+                {
+                    name.remove_prefix( 1 );
+                }
+                while( !name.empty() && isSpace( name.back() ) )
+                {
+                    name.remove_suffix( 1 );
+                }
+                names[i] = name;
+                list = comma == std::string_view::npos ? std::string_view{} : list.substr( comma + 1 );
+            }
+            return names;
+        }
+    } // namespace detail
+} // namespace nfx::serialization::json
+
+//=====================================================================
+// Registration macros
+//=====================================================================
+
+/**
+ * @brief Specialize EnumTraits for an enumeration from its enumerator list
+ * @param Type Enumeration type (fully qualified); use at global scope
+ * @param ... Enumerator identifiers, unqualified
+ * @details For enumerators outside the reflected range or compilers without reflection:
+ *          NFX_SERIALIZATION_ENUM( app::Status, Pending, Active, Closed );
+ */
+#define NFX_SERIALIZATION_ENUM( Type, ... ) NFX_SERIALIZATION_DETAIL_ENUM_TRAITS( Type, false, __VA_ARGS__ )
+
+/**
+ * @brief Specialize EnumTraits for a flag enumeration from its enumerator list
+ * @param Type Enumeration type (fully qualified); use at global scope
+ * @param ... Enumerator identifiers, unqualified
+ */
+#define NFX_SERIALIZATION_FLAGS( Type, ... ) NFX_SERIALIZATION_DETAIL_ENUM_TRAITS( Type, true, __VA_ARGS__ )
+
+/** @brief Common expansion of NFX_SERIALIZATION_ENUM() and NFX_SERIALIZATION_FLAGS() */
+#define NFX_SERIALIZATION_DETAIL_ENUM_TRAITS( Type, isFlags, ... )                                               \
+    template <>                                                                                                  \
+    struct nfx::serialization::json::EnumTraits<Type>                                                            \
+    {                                                                                                            \
+        static constexpr auto values = [] {                                                                      \
+            using enum Type;                                                                                     \
+            return std::array{ __VA_ARGS__ };                                                                    \
+        }();                                                                                                     \
+        static constexpr auto names =                                                                            \
+            ::nfx::serialization::json::detail::splitEnumNames<values.size()>( #__VA_ARGS__ );                   \
+        static constexpr bool flags = isFlags;                                                                   \
+    }
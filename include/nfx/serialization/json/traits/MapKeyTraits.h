@@ -0,0 +1,231 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2026 nfx
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * @file MapKeyTraits.h
+ * @brief Conversion of non-string map keys to and from JSON member names
+ * @details Maps serialize as JSON objects, whose member names are strings. Keys that are not
+ *          strings are formatted into a stack buffer on write and parsed back on read through
+ *          MapKeyTraits, so e.g. std::map<int, V> and std::unordered_map<std::uint64_t, V>
+ *          round-trip without allocating a string per key.
+ *
+ *          Built-in specializations cover integral types ("42"), enumerations (their underlying
+ *          value) and floating-point types (shortest representation that reads back exactly,
+ *          "0.1" rather than "0.100000").
+ */
+
+#pragma once
+
+#include <array>
+#include <charconv>
+#include <concepts>
+#include <cstddef>
+#include <limits>
+#include <string_view>
+#include <system_error>
+#include <type_traits>
+
+namespace nfx::serialization::json
+{
+    //=====================================================================
+    // MapKeyTraits - map key conversion customization point
+    //=====================================================================
+
+    /**
+     * @brief Map key conversion traits
+     * @tparam Key The map key type
+     * @details Specialize for custom key types. A specialization declares:
+     *          - `maxLength`: upper bound of the formatted length
+     *          - `format(const Key&, std::array<char, maxLength>&) -> std::string_view`: text of the
+     *            key, written into the buffer (or viewing storage that outlives the call)
+     *          - `parse(std::string_view, Key&) -> bool`: read a key back, false if the text is invalid
+     *
+     * **Example: Key type with a textual code**
+     * ```cpp
+     * template <>
+     * struct MapKeyTraits<CountryCode>
+     * {
+     *     static constexpr std::size_t maxLength = 2;
+     *
+     *     static std::string_view format( const CountryCode& key, std::array<char, maxLength>& buffer )
+     *     {
+     *         buffer = { key.first, key.second };
+     *         return { buffer.data(), buffer.size() };
+     *     }
+     *
+     *     static bool parse( std::string_view text, CountryCode& key )
+     *     {
+     *         if( text.size() != 2 )
+     *         {
+     *             return false;
+     *         }
+     *         key = CountryCode{ text[0], text[1] };
+     *         return true;
+     *     }
+     * };
+     * // std::map<CountryCode, int>{ { { 'F', 'R' }, 33 } } -> {"FR":33}
+     * ```
+     */
+    template <typename Key>
+    struct MapKeyTraits
+    {
+    };
+
+    /**
+     * @brief Integral keys, written as decimal numbers
+     */
+    template <typename Key>
+        requires( std::is_integral_v<Key> && !std::is_same_v<Key, bool> )
+    struct MapKeyTraits<Key>
+    {
+        /** @brief Digits, sign and one digit digits10 does not count */
+        static constexpr std::size_t maxLength = std::numeric_limits<Key>::digits10 + 2;
+
+        /**
+         * @brief Format a key
+         * @param key Key to format
+         * @param buffer Output buffer
+         * @return Decimal text of the key, in the buffer
+         */
+        static std::string_view format( Key key, std::array<char, maxLength>& buffer ) noexcept
+        {
+            const auto result = std::to_chars( buffer.data(), buffer.data() + buffer.size(), key );
+            return { buffer.data(), static_cast<std::size_t>( result.ptr - buffer.data() ) };
+        }
+
+        /**
+         * @brief Parse a key
+         * @param text Member name
+         * @param key Parsed key
+         * @return True if the whole text is a decimal number in the range of Key
+         */
+        static bool parse( std::string_view text, Key& key ) noexcept
+        {
+            const auto [end, ec] = std::from_chars( text.data(), text.data() + text.size(), key );
+            return ec == std::errc{} && end == text.data() + text.size();
+        }
+    };
+
+    /**
+     * @brief Enumeration keys, written as their underlying value
+     */
+    template <typename Key>
+        requires( std::is_enum_v<Key> )
+    struct MapKeyTraits<Key>
+    {
+        /** @brief Conversion of the underlying value */
+        using Underlying = MapKeyTraits<std::underlying_type_t<Key>>;
+
+        /** @brief Length of the underlying value */
+        static constexpr std::size_t maxLength = Underlying::maxLength;
+
+        /**
+         * @brief Format a key
+         * @param key Key to format
+         * @param buffer Output buffer
+         * @return Decimal text of the underlying value, in the buffer
+         */
+        static std::string_view format( Key key, std::array<char, maxLength>& buffer ) noexcept
+        {
+            return Underlying::format( static_cast<std::underlying_type_t<Key>>( key ), buffer );
+        }
+
+        /**
+         * @brief Parse a key
+         * @param text Member name
+         * @param key Parsed key
+         * @return True if the text is a valid underlying value
+         */
+        static bool parse( std::string_view text, Key& key ) noexcept
+        {
+            std::underlying_type_t<Key> value{};
+            if( !Underlying::parse( text, value ) )
+            {
+                return false;
+            }
+            key = static_cast<Key>( value );
+            return true;
+        }
+    };
+
+    /**
+     * @brief Floating-point keys, written in their shortest exact form
+     */
+    template <typename Key>
+        requires( std::is_floating_point_v<Key> )
+    struct MapKeyTraits<Key>
+    {
+        /** @brief Sign, max_digits10 digits, point and a four-digit exponent, with margin */
+        static constexpr std::size_t maxLength = std::numeric_limits<Key>::max_digits10 + 12;
+
+        /**
+         * @brief Format a key
+         * @param key Key to format
+         * @param buffer Output buffer
+         * @return Shortest text reading back as the same value, in the buffer
+         */
+        static std::string_view format( Key key, std::array<char, maxLength>& buffer ) noexcept
+        {
+            const auto result = std::to_chars( buffer.data(), buffer.data() + buffer.size(), key );
+            return { buffer.data(), static_cast<std::size_t>( result.ptr - buffer.data() ) };
+        }
+
+        /**
+         * @brief Parse a key
+         * @param text Member name
+         * @param key Parsed key
+         * @return True if the whole text is a number
+         */
+        static bool parse( std::string_view text, Key& key ) noexcept
+        {
+            const auto [end, ec] = std::from_chars( text.data(), text.data() + text.size(), key );
+            return ec == std::errc{} && end == text.data() + text.size();
+        }
+    };
+
+    //=====================================================================
+    // SFINAE detectors
+    //=====================================================================
+
+    namespace detail
+    {
+        /**
+         * @brief Detects a MapKeyTraits specialization for a key type
+         * @tparam Key Map key type
+         */
+        template <typename Key>
+        inline constexpr bool has_map_key_traits_v =
+            requires( const Key& key, Key& parsed, std::array<char, MapKeyTraits<Key>::maxLength>& buffer ) {
+                { MapKeyTraits<Key>::format( key, buffer ) } -> std::convertible_to<std::string_view>;
+                { MapKeyTraits<Key>::parse( std::string_view{}, parsed ) } -> std::convertible_to<bool>;
+            };
+
+        /**
+         * @brief Detects map keys used as member names directly
+         * @tparam Key Map key type
+         */
+        template <typename Key>
+        inline constexpr bool is_string_map_key_v = std::is_convertible_v<const Key&, std::string_view>;
+    } // namespace detail
+} // namespace nfx::serialization::json
@@ -44,6 +44,8 @@
 
 #pragma once
 
+#include "../DeserializeError.h"
+
 #include <nfx/json/Builder.h>
 #include <nfx/json/Document.h>
 
@@ -67,6 +69,16 @@ namespace nfx::serialization::json
     template <typename T>
     struct SerializationTraits;
 
+    class MergePatchReader;
+
+    class MergePatchWriter;
+
+    namespace detail
+    {
+        template <typename Message>
+        inline void reportError( ErrorCode code, Message&& message );
+    } // namespace detail
+
     //=====================================================================
     // SFINAE detectors
     //=====================================================================
@@ -101,6 +113,34 @@ namespace nfx::serialization::json
         template <typename T>
         inline constexpr bool has_streaming_serialization_v = has_streaming_serialization<T>::value;
 
+        /**
+         * @brief SFINAE detector for member-only serialization
+         * @tparam T Type to check
+         */
+        template <typename T, typename = void>
+        struct has_member_serialization : std::false_type
+        {
+        };
+
+        /**
+         * @brief SFINAE detector for member-only serialization (specialized version)
+         * @tparam T Type to check
+         * @details Checks if SerializationTraits<T>::serializeMembers(const T&, Builder&) is valid
+         */
+        template <typename T>
+        struct has_member_serialization<
+            T,
+            std::void_t<decltype( SerializationTraits<T>::serializeMembers(
+                std::declval<const T&>(), std::declval<nfx::json::Builder&>() ) )>> : std::true_type
+        {
+        };
+
+        /**
+         * @brief Helper variable template for has_member_serialization
+         */
+        template <typename T>
+        inline constexpr bool has_member_serialization_v = has_member_serialization<T>::value;
+
         /**
          * @brief SFINAE detector for factory deserialization
          * @tparam T Type to check
@@ -128,6 +168,145 @@ namespace nfx::serialization::json
          */
         template <typename T>
         inline constexpr bool has_factory_deserialization_v = has_factory_deserialization<T>::value;
+
+        /**
+         * @brief SFINAE detector for a JSON Schema declared by SerializationTraits<T>::schema()
+         * @tparam T Type to check
+         */
+        template <typename T, typename = void>
+        struct has_schema : std::false_type
+        {
+        };
+
+        /**
+         * @brief SFINAE detector for a JSON Schema (specialized version)
+         * @tparam T Type to check
+         * @details Checks if SerializationTraits<T>::schema() -> Document is valid
+         */
+        template <typename T>
+        struct has_schema<T, std::void_t<decltype( Document{ SerializationTraits<T>::schema() } )>> : std::true_type
+        {
+        };
+
+        /**
+         * @brief Helper variable template for has_schema
+         */
+        template <typename T>
+        inline constexpr bool has_schema_v = has_schema<T>::value;
+
+        /**
+         * @brief SFINAE detector for a schema fragment written by SerializationTraits<T>::writeSchema()
+         * @tparam T Type to check
+         */
+        template <typename T, typename = void>
+        struct has_schema_writer : std::false_type
+        {
+        };
+
+        /**
+         * @brief SFINAE detector for a schema fragment writer (specialized version)
+         * @tparam T Type to check
+         * @details Checks if SerializationTraits<T>::writeSchema(Builder&) is valid
+         */
+        template <typename T>
+        struct has_schema_writer<
+            T,
+            std::void_t<decltype( SerializationTraits<T>::writeSchema( std::declval<nfx::json::Builder&>() ) )>>
+            : std::true_type
+        {
+        };
+
+        /**
+         * @brief Helper variable template for has_schema_writer
+         */
+        template <typename T>
+        inline constexpr bool has_schema_writer_v = has_schema_writer<T>::value;
+
+        /**
+         * @brief SFINAE detector for an output size estimate from SerializationTraits<T>::estimateSize()
+         * @tparam T Type to check
+         */
+        template <typename T, typename = void>
+        struct has_size_estimate : std::false_type
+        {
+        };
+
+        /**
+         * @brief SFINAE detector for an output size estimate (specialized version)
+         * @tparam T Type to check
+         * @details Checks if SerializationTraits<T>::estimateSize(const T&) -> std::size_t is valid
+         */
+        template <typename T>
+        struct has_size_estimate<
+            T,
+            std::enable_if_t<std::is_convertible_v<
+                decltype( SerializationTraits<T>::estimateSize( std::declval<const T&>() ) ), std::size_t>>>
+            : std::true_type
+        {
+        };
+
+        /**
+         * @brief Helper variable template for has_size_estimate
+         */
+        template <typename T>
+        inline constexpr bool has_size_estimate_v = has_size_estimate<T>::value;
+
+        /**
+         * @brief SFINAE detector for member-wise merge patches from SerializationTraits<T>::writeMergePatch()
+         * @tparam T Type to check
+         */
+        template <typename T, typename = void>
+        struct has_merge_patch_writer : std::false_type
+        {
+        };
+
+        /**
+         * @brief SFINAE detector for member-wise merge patches (specialized version)
+         * @tparam T Type to check
+         * @details Checks if SerializationTraits<T>::writeMergePatch(const T&, const T&, MergePatchWriter&) is valid
+         */
+        template <typename T>
+        struct has_merge_patch_writer<
+            T,
+            std::void_t<decltype( SerializationTraits<T>::writeMergePatch(
+                std::declval<const T&>(), std::declval<const T&>(), std::declval<MergePatchWriter&>() ) )>>
+            : std::true_type
+        {
+        };
+
+        /**
+         * @brief Helper variable template for has_merge_patch_writer
+         */
+        template <typename T>
+        inline constexpr bool has_merge_patch_writer_v = has_merge_patch_writer<T>::value;
+
+        /**
+         * @brief SFINAE detector for in-place merge patches from SerializationTraits<T>::applyMergePatch()
+         * @tparam T Type to check
+         */
+        template <typename T, typename = void>
+        struct has_merge_patch_reader : std::false_type
+        {
+        };
+
+        /**
+         * @brief SFINAE detector for in-place merge patches (specialized version)
+         * @tparam T Type to check
+         * @details Checks if SerializationTraits<T>::applyMergePatch(MergePatchReader&, T&) is valid
+         */
+        template <typename T>
+        struct has_merge_patch_reader<
+            T,
+            std::void_t<decltype( SerializationTraits<T>::applyMergePatch(
+                std::declval<MergePatchReader&>(), std::declval<T&>() ) )>> : std::true_type
+        {
+        };
+
+        /**
+         * @brief Helper variable template for has_merge_patch_reader
+         */
+        template <typename T>
+        inline constexpr bool has_merge_patch_reader_v = has_merge_patch_reader<T>::value;
     } // namespace detail
 
     //=====================================================================
@@ -151,10 +330,27 @@ namespace nfx::serialization::json
      *          For deserialization, the serializer automatically detects which pattern to use:
      *          - If factory method exists, it calls `SerializationTraits<T>::fromDocument(doc)`
      *          - Otherwise, it creates a default object and calls `SerializationTraits<T>::fromDocument(doc, obj)`
+     *          Both apply at every nesting level: container elements, map values, optionals, pointees
+     *          and variant alternatives are constructed directly in their storage.
      *
      *          User types can provide member method with this signature:
      *          - void fromDocument(const Document&, const Serializer<T>&)
      *
+     *          Optionally, `static Document schema()` declares a JSON Schema for the type. With
+     *          `Options::validateOnDeserialize`, the value is checked against it (validator built
+     *          once per type) before fromDocument() runs; this is a separate walk of the value, so a
+     *          validated read visits it twice. `static void writeSchema(Builder&)` only
+     *          describes the type for SchemaOf<T>() (see Schema.h) without enabling validation.
+     *          `static std::size_t estimateSize(const T&)` approximates the serialized length of a
+     *          value so that Serializer<T>::toString() can reserve its output buffer once.
+     *          `static void writeMergePatch(const T&, const T&, MergePatchWriter&)` lists the
+     *          members compared by Serializer<T>::toMergePatch(); without it a changed value is
+     *          written whole. `static void applyMergePatch(MergePatchReader&, T&)` is its inverse,
+     *          updating the patched members in place for Serializer<T>::applyMergePatch().
+     *          `static void serializeMembers(const T&, Builder&)` writes the members of an object
+     *          without its braces; internally tagged variants (VariantLayout::Internal) use it to
+     *          write an alternative's members next to the tag.
+     *
      * **Example: High-performance streaming serialization**
      * ```cpp
      * template <>
@@ -238,7 +434,7 @@ namespace nfx::serialization::json
         /**
          * @brief Deserialize std::monostate from JSON null
          * @param doc JSON document to read from
-         * @throws std::runtime_error if JSON is not null
+         * @throws std::runtime_error if JSON is not null (recorded as ErrorCode::TypeMismatch by tryFromString)
          */
         static void fromDocument( const Document& doc, std::monostate& )
         {
@@ -246,8 +442,19 @@ namespace nfx::serialization::json
             // Just verify the JSON is null
             if( !doc.isNull( "" ) )
             {
-                throw std::runtime_error{ "Expected null for std::monostate" };
+                detail::reportError( ErrorCode::TypeMismatch, "Expected null for std::monostate" );
             }
         }
+
+        /**
+         * @brief Describe std::monostate for SchemaOf(): {"type": "null"}
+         * @param builder JSON builder to write to
+         */
+        static void writeSchema( Builder& builder )
+        {
+            builder.writeStartObject();
+            builder.write( "type", "null" );
+            builder.writeEndObject();
+        }
     };
 } // namespace nfx::serialization::json
@@ -0,0 +1,229 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2026 nfx
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * @file VariantTraits.h
+ * @brief Customization of std::variant tag encoding and layout
+ * @details std::variant values serialize by default as {"tag": ..., "data": ...}. The tag
+ *          identifies the active alternative either by name (default: simplified type name, or
+ *          user-defined names via VariantTraits) or by numeric index (VariantTagFormat::Index).
+ *          VariantTraits can also select a layout without the wrapper object (VariantLayout).
+ *
+ *          Decoding resolves names through a compile-time hash table and dispatches through a
+ *          per-alternative function table, so lookup cost does not grow with the number of
+ *          alternatives.
+ */
+
+#pragma once
+
+#include <nfx/json/Document.h>
+
+#include <array>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+#include <type_traits>
+#include <variant>
+
+namespace nfx::serialization::json
+{
+    //=====================================================================
+    // Variant tag format
+    //=====================================================================
+
+    /**
+     * @brief How the active alternative of a std::variant is identified in JSON
+     * @details The reader accepts both formats regardless of the option.
+     */
+    enum class VariantTagFormat : std::uint8_t
+    {
+        Name = 0, ///< Alternative name: VariantTraits<V>::names if specialized, otherwise type_name<T>()
+        Index     ///< Zero-based alternative index (compact, immune to name collisions)
+    };
+
+    //=====================================================================
+    // Variant layout
+    //=====================================================================
+
+    /**
+     * @brief JSON shape of a std::variant value
+     */
+    enum class VariantLayout : std::uint8_t
+    {
+        Adjacent = 0, ///< {"tag": "Circle", "data": {...}} (default)
+        External,     ///< {"Circle": {...}}
+        Internal,     ///< {"type": "Circle", ...fields} (alternatives must serialize as JSON objects)
+        Untagged      ///< Bare value; alternative chosen by discriminate() or by trial in declaration order
+    };
+
+    //=====================================================================
+    // VariantTraits - variant encoding customization point
+    //=====================================================================
+
+    /**
+     * @brief Variant encoding traits
+     * @tparam Variant The std::variant type
+     * @details Specialize to give alternatives explicit tag names. The default simplified type
+     *          names drop namespaces and template arguments, so e.g. std::vector<int> and
+     *          std::vector<double> both map to "vector"; explicit names (or the index format)
+     *          keep such alternatives distinct. Variants whose tag names collide are rejected at
+     *          compile time unless they declare distinct names or index tags (`tagFormat`).
+     *
+     *          All members are optional:
+     *          - `names`: one tag name per alternative
+     *          - `layout`: a VariantLayout (default VariantLayout::Adjacent)
+     *          - `tagKey`: member holding the tag for VariantLayout::Internal (default "type")
+     *          - `tagFormat`: a VariantTagFormat used regardless of Options::variantTagFormat
+     *          - `discriminate(const Document&) -> std::size_t`: alternative index for
+     *            VariantLayout::Untagged (default: first alternative that deserializes without error)
+     *
+     * **Example: Internally tagged with custom tag names**
+     * ```cpp
+     * using Shape = std::variant<Circle, Rectangle>;
+     *
+     * template <>
+     * struct VariantTraits<Shape>
+     * {
+     *     static constexpr std::array<std::string_view, 2> names{ "circle", "rect" };
+     *     static constexpr VariantLayout layout = VariantLayout::Internal;
+     *     static constexpr std::string_view tagKey = "kind";
+     * };
+     * // Circle{ 2.0 } -> {"kind":"circle","radius":2.0}
+     * ```
+     */
+    template <typename Variant>
+    struct VariantTraits
+    {
+    };
+
+    //=====================================================================
+    // SFINAE detectors
+    //=====================================================================
+
+    namespace detail
+    {
+        /**
+         * @brief SFINAE detector for user-defined variant tag names
+         * @tparam V Variant type to check
+         */
+        template <typename V, typename = void>
+        struct has_variant_tag_names : std::false_type
+        {
+        };
+
+        /**
+         * @brief SFINAE detector for user-defined variant tag names (specialized version)
+         * @tparam V Variant type to check
+         * @details A declared names array must hold one name per alternative: any other size is
+         *          rejected at compile time rather than silently falling back to type names
+         */
+        template <typename V>
+        struct has_variant_tag_names<V, std::void_t<decltype( VariantTraits<V>::names )>> : std::true_type
+        {
+            static_assert( std::tuple_size_v<std::remove_cvref_t<decltype( VariantTraits<V>::names )>> ==
+                               std::variant_size_v<V>,
+                           "VariantTraits<V>::names must hold one name per alternative" );
+        };
+
+        /**
+         * @brief Helper variable template for has_variant_tag_names
+         */
+        template <typename V>
+        inline constexpr bool has_variant_tag_names_v = has_variant_tag_names<V>::value;
+
+        /**
+         * @brief Get the configured layout of a variant type
+         * @tparam V Variant type
+         * @return VariantTraits<V>::layout if declared, otherwise VariantLayout::Adjacent
+         */
+        template <typename V>
+        constexpr VariantLayout variantLayout() noexcept
+        {
+            if constexpr( requires { VariantTraits<V>::layout; } )
+            {
+                return VariantTraits<V>::layout;
+            }
+            else
+            {
+                return VariantLayout::Adjacent;
+            }
+        }
+
+        /**
+         * @brief Get the tag member name for internally tagged variants
+         * @tparam V Variant type
+         * @return VariantTraits<V>::tagKey if declared, otherwise "type"
+         */
+        template <typename V>
+        constexpr std::string_view variantTagKey() noexcept
+        {
+            if constexpr( requires { VariantTraits<V>::tagKey; } )
+            {
+                return VariantTraits<V>::tagKey;
+            }
+            else
+            {
+                return "type";
+            }
+        }
+
+        /**
+         * @brief Get the tag format of a variant type
+         * @tparam V Variant type
+         * @param option Options::variantTagFormat of the call
+         * @return VariantTraits<V>::tagFormat if declared, otherwise option
+         */
+        template <typename V>
+        constexpr VariantTagFormat variantTagFormat( VariantTagFormat option ) noexcept
+        {
+            if constexpr( requires { VariantTraits<V>::tagFormat; } )
+            {
+                return VariantTraits<V>::tagFormat;
+            }
+            else
+            {
+                return option;
+            }
+        }
+
+        /**
+         * @brief Check whether a variant type is always tagged by index
+         * @tparam V Variant type
+         * @details Such variants never build their name table, so their names may collide.
+         */
+        template <typename V>
+        inline constexpr bool has_index_tags_only_v =
+            variantTagFormat<V>( VariantTagFormat::Name ) == VariantTagFormat::Index;
+
+        /**
+         * @brief Detects a discriminator predicate for untagged variants
+         * @tparam V Variant type
+         */
+        template <typename V>
+        inline constexpr bool has_variant_discriminator_v = requires( const nfx::json::Document& doc ) {
+            { VariantTraits<V>::discriminate( doc ) } -> std::convertible_to<std::size_t>;
+        };
+    } // namespace detail
+} // namespace nfx::serialization::json
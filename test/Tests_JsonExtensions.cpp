@@ -30,6 +30,7 @@
  * StackHashMap, StackHashSet
  *          - nfx-datatypes: Int128, Decimal
  *          - nfx-datetime: DateTime, DateTimeOffset, TimeSpan
+ *          - std::chrono: duration, time_point
  */
 
 #include <gtest/gtest.h>
@@ -395,6 +396,29 @@ namespace nfx::serialization::json::test
         EXPECT_EQ( *one, "one" );
     }
 
+    TEST_F( OrderedHashMapExtensionTest, CompactPairLayout )
+    {
+        nfx::containers::OrderedHashMap<std::string, int> map;
+        map.insertOrAssign( "gamma", 3 );
+        map.insertOrAssign( "alpha", 1 );
+
+        Serializer<decltype( map )>::Options options;
+        options.pairLayout = PairLayout::Array;
+        std::string json = Serializer<decltype( map )>::toString( map, options );
+        EXPECT_EQ( json, R"([["gamma",3],["alpha",1]])" );
+
+        // Both layouts read back
+        auto restored = Serializer<decltype( map )>::fromString( json );
+        ASSERT_EQ( restored.size(), 2 );
+        EXPECT_EQ( restored.begin()->first, "gamma" );
+
+        restored = Serializer<decltype( map )>::fromString( R"([{"key":"beta","value":2},["delta",4]])" );
+        ASSERT_EQ( restored.size(), 2 );
+        const int* delta = restored.find( "delta" );
+        ASSERT_NE( delta, nullptr );
+        EXPECT_EQ( *delta, 4 );
+    }
+
     //=====================================================================
     // nfx-containers: OrderedHashSet tests
     //=====================================================================
@@ -1303,6 +1327,110 @@ namespace nfx::serialization::json::test
         EXPECT_FALSE( json.empty() );
     }
 
+    //=====================================================================
+    // std::chrono: duration and time_point tests
+    //=====================================================================
+
+    class ChronoExtensionTest : public ::testing::Test
+    {
+    protected:
+        void SetUp() override
+        {
+        }
+
+        void TearDown() override
+        {
+        }
+    };
+
+    TEST_F( ChronoExtensionTest, DurationTicks )
+    {
+        using namespace std::chrono_literals;
+
+        EXPECT_EQ( Serializer<std::chrono::nanoseconds>::toString( 1500ms ), "1500000000" );
+        EXPECT_EQ( Serializer<std::chrono::milliseconds>::toString( -250ms ), "-250" );
+        EXPECT_EQ( Serializer<std::chrono::milliseconds>::fromString( "42" ), 42ms );
+
+        using Latencies = std::vector<std::chrono::microseconds>;
+        const Latencies latencies{ 120us, 95us, 3s };
+        EXPECT_EQ( Serializer<Latencies>::toString( latencies ), "[120,95,3000000]" );
+        EXPECT_EQ( Serializer<Latencies>::fromString( "[120,95,3000000]" ), latencies );
+    }
+
+    TEST_F( ChronoExtensionTest, DurationIso8601 )
+    {
+        using namespace std::chrono_literals;
+
+        using Nanoseconds = Serializer<std::chrono::nanoseconds>;
+
+        Nanoseconds::Options options;
+        options.timeFormat = TimeFormat::Iso8601;
+
+        EXPECT_EQ( Nanoseconds::toString( 1h + 30min + 45500ms, options ), R"("PT1H30M45.5S")" );
+        EXPECT_EQ( Nanoseconds::toString( -250ms, options ), R"("-PT0.25S")" );
+        EXPECT_EQ( Nanoseconds::toString( 0ns, options ), R"("PT0S")" );
+        EXPECT_EQ( Nanoseconds::serializedSize( 90min, options ), 9u );
+
+        // Readers accept both forms regardless of the option
+        EXPECT_EQ( Serializer<std::chrono::seconds>::fromString( R"("P1DT2H")" ), 26h );
+        EXPECT_EQ( Serializer<std::chrono::milliseconds>::fromString( R"("PT0.001S")" ), 1ms );
+        EXPECT_EQ( Nanoseconds::fromString( "5", options ), 5ns );
+
+        for( const char* invalid :
+            { R"("PT1S1H")", R"("P")", R"("PT")", R"("P1DT")", R"("PT1.5M")", R"("P1Y")", R"("1h")" } )
+        {
+            const auto result = Serializer<std::chrono::seconds>::tryFromString( invalid );
+            ASSERT_FALSE( result ) << invalid;
+            EXPECT_EQ( result.error().code(), ErrorCode::InvalidFormat );
+        }
+    }
+
+    TEST_F( ChronoExtensionTest, TimePoints )
+    {
+        using namespace std::chrono_literals;
+        using Timestamp = std::chrono::sys_time<std::chrono::milliseconds>;
+
+        const Timestamp timestamp{ 1718461845123ms };
+        EXPECT_EQ( Serializer<Timestamp>::toString( timestamp ), "1718461845123" );
+
+        Serializer<Timestamp>::Options options;
+        options.timeFormat = TimeFormat::Iso8601;
+        EXPECT_EQ( Serializer<Timestamp>::toString( timestamp, options ), R"("2024-06-15T14:30:45.123Z")" );
+        EXPECT_EQ( Serializer<Timestamp>::toString( Timestamp{ -1500ms }, options ), R"("1969-12-31T23:59:58.500Z")" );
+
+        EXPECT_EQ( Serializer<Timestamp>::fromString( R"("2024-06-15T14:30:45.123Z")" ), timestamp );
+        EXPECT_EQ( Serializer<Timestamp>::fromString( R"("2024-06-15T16:30:45.123+02:00")" ), timestamp );
+        EXPECT_EQ( Serializer<Timestamp>::fromString( "1718461845123" ), timestamp );
+        EXPECT_FALSE( Serializer<Timestamp>::tryFromString( R"("2024-02-30T00:00:00Z")" ) );
+        EXPECT_FALSE( Serializer<Timestamp>::tryFromString( R"("2024-06-15T14:30:45")" ) );
+
+        // Years outside 0000-9999 are written signed and read back
+        using Seconds = std::chrono::sys_seconds;
+        Serializer<Seconds>::Options secondsOptions;
+        secondsOptions.timeFormat = TimeFormat::Iso8601;
+        const Seconds ancient = std::chrono::sys_days{ std::chrono::year{ -1029 } / 12 / 29 };
+        const Seconds distant = std::chrono::sys_days{ std::chrono::year{ 10000 } / 1 / 1 };
+        EXPECT_EQ( Serializer<Seconds>::toString( ancient, secondsOptions ), R"("-1029-12-29T00:00:00Z")" );
+        EXPECT_EQ( Serializer<Seconds>::toString( distant, secondsOptions ), R"("+10000-01-01T00:00:00Z")" );
+        EXPECT_EQ( Serializer<Seconds>::fromString( R"("-1029-12-29T00:00:00Z")" ), ancient );
+        EXPECT_EQ( Serializer<Seconds>::fromString( R"("+10000-01-01T00:00:00Z")" ), distant );
+        EXPECT_EQ( Serializer<Seconds>::fromString( R"("+2024-06-15T14:30:45Z")" ),
+            Seconds{ std::chrono::seconds{ 1718461845 } } );
+        for( const char* invalid : { R"("10000-01-01T00:00:00Z")", R"("-999-01-01T00:00:00Z")",
+                 R"("+999999-01-01T00:00:00Z")" } )
+        {
+            EXPECT_FALSE( Serializer<Seconds>::tryFromString( invalid ) ) << invalid;
+        }
+
+        // Clocks without a calendar are written as the duration since their epoch
+        const std::chrono::steady_clock::time_point uptime{ 2min + 3s };
+        Serializer<std::chrono::steady_clock::time_point>::Options steadyOptions;
+        steadyOptions.timeFormat = TimeFormat::Iso8601;
+        const std::string json = Serializer<std::chrono::steady_clock::time_point>::toString( uptime, steadyOptions );
+        EXPECT_EQ( json, R"("PT2M3S")" );
+        EXPECT_EQ( Serializer<std::chrono::steady_clock::time_point>::fromString( json ), uptime );
+    }
+
     //=====================================================================
     // Integration tests - README sample validation
     //=====================================================================
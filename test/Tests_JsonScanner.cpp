@@ -0,0 +1,186 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2026 nfx
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * @file Tests_JsonScanner.cpp
+ * @brief Unit tests for the structural JSON scanner
+ * @details Tests value skipping across block boundaries, escape handling inside strings,
+ *          JSON Pointer resolution and targeted deserialization via Serializer::fromStringAt().
+ */
+
+#include <gtest/gtest.h>
+
+#include <nfx/Serialization.h>
+
+#include <map>
+#include <string>
+#include <vector>
+
+using namespace nfx::json;
+using namespace nfx::serialization::json;
+
+namespace nfx::serialization::json::test
+{
+    //=====================================================================
+    // Value skipping
+    //=====================================================================
+
+    TEST( JSONScannerTest, SkipScalars )
+    {
+        Scanner numberScanner{ "  -12.5e3 ," };
+        EXPECT_EQ( numberScanner.skipValue( 0 ), 9u );
+
+        Scanner literalScanner{ "true" };
+        EXPECT_EQ( literalScanner.skipValue( 0 ), 4u );
+
+        Scanner stringScanner{ R"("a\"b\\",1)" };
+        EXPECT_EQ( stringScanner.skipValue( 0 ), 8u );
+    }
+
+    TEST( JSONScannerTest, SkipNestedContainers )
+    {
+        const std::string json = R"({"a":[1,{"b":"]}"},[[]]],"c":"\\"} tail)";
+        Scanner scanner{ json };
+
+        EXPECT_EQ( scanner.skipValue( 0 ), json.find( " tail" ) );
+        EXPECT_EQ( scanner.bytesSkipped(), json.find( " tail" ) );
+    }
+
+    TEST( JSONScannerTest, SkipAcrossBlockBoundaries )
+    {
+        // Brackets and escaped quotes inside strings straddling 64-byte blocks must be ignored
+        for( std::size_t padding = 0; padding < 130; ++padding )
+        {
+            const std::string json = "[\"" + std::string( padding, 'x' ) + R"(\\\"]}{[\\",{"k":[)" +
+                                     std::string( padding, ' ' ) + "]}]";
+            Scanner scanner{ json };
+
+            EXPECT_EQ( scanner.skipValue( 0 ), json.size() ) << "padding=" << padding;
+        }
+    }
+
+    TEST( JSONScannerTest, SkipLongBackslashRuns )
+    {
+        // Even run: the quote closes the string. Odd run: the quote is escaped.
+        for( std::size_t run = 1; run < 140; ++run )
+        {
+            const std::string backslashes( run * 2, '\\' );
+            const std::string json = "[\"" + backslashes + "\"]";
+            Scanner scanner{ json };
+            EXPECT_EQ( scanner.skipValue( 0 ), json.size() ) << "run=" << run;
+
+            const std::string escaped = "[\"" + backslashes + "\\\"]\"]";
+            Scanner escapedScanner{ escaped };
+            EXPECT_EQ( escapedScanner.skipValue( 0 ), escaped.size() ) << "run=" << run;
+        }
+    }
+
+    TEST( JSONScannerTest, SkipTruncatedInput )
+    {
+        Scanner openObject{ R"({"a":[1,2})" };
+        EXPECT_EQ( openObject.skipValue( 0 ), std::string_view::npos );
+
+        Scanner openString{ R"("abc\")" };
+        EXPECT_EQ( openString.skipValue( 0 ), std::string_view::npos );
+
+        Scanner empty{ "   " };
+        EXPECT_EQ( empty.skipValue( 0 ), std::string_view::npos );
+    }
+
+    //=====================================================================
+    // JSON Pointer resolution
+    //=====================================================================
+
+    TEST( JSONScannerTest, LocateMembersAndElements )
+    {
+        const std::string json = R"({"meta":{"ignored":[1,2,3]},"payload":{"items":[10,{"x":"y"},30]}})";
+        Scanner scanner{ json };
+
+        EXPECT_EQ( scanner.locate( "" ), std::string_view{ json } );
+        EXPECT_EQ( scanner.locate( "/payload/items/0" ), "10" );
+        EXPECT_EQ( scanner.locate( "/payload/items/1" ), R"({"x":"y"})" );
+        EXPECT_EQ( scanner.locate( "/payload/items/1/x" ), R"("y")" );
+        EXPECT_EQ( scanner.locate( "/payload/items/2" ), "30" );
+
+        EXPECT_FALSE( scanner.locate( "/payload/items/3" ).has_value() );
+        EXPECT_FALSE( scanner.locate( "/payload/items/01" ).has_value() );
+        EXPECT_FALSE( scanner.locate( "/missing" ).has_value() );
+        EXPECT_FALSE( scanner.locate( "payload" ).has_value() );
+    }
+
+    TEST( JSONScannerTest, LocateEscapedKeys )
+    {
+        const std::string json = R"({"a/b":1,"m~n":2,"q\"t":3,"é":4})";
+        Scanner scanner{ json };
+
+        EXPECT_EQ( scanner.locate( "/a~1b" ), "1" );
+        EXPECT_EQ( scanner.locate( "/m~0n" ), "2" );
+        EXPECT_EQ( scanner.locate( "/q\"t" ), "3" );
+        EXPECT_EQ( scanner.locate( "/\xC3\xA9" ), "4" );
+
+        // Escaped keys matched against escaped tokens, without decoding either side up front
+        const std::string escaped = R"({"\u0041\/~b":5,"\ud83d\ude00":6,"x\u0041":7})";
+        Scanner escapedScanner{ escaped };
+        EXPECT_EQ( escapedScanner.locate( "/A~1~0b" ), "5" );
+        EXPECT_EQ( escapedScanner.locate( "/\xF0\x9F\x98\x80" ), "6" );
+        EXPECT_FALSE( escapedScanner.locate( "/A~1~0" ).has_value() );
+        EXPECT_FALSE( escapedScanner.locate( "/xA~0" ).has_value() );
+    }
+
+    TEST( JSONScannerTest, LocateStatistics )
+    {
+        const std::string json = R"({"skip":[1,2,3,4,5],"take":42})";
+        Scanner scanner{ json };
+
+        EXPECT_EQ( scanner.locate( "/take" ), "42" );
+        EXPECT_EQ( scanner.bytesSkipped(), std::string_view{ "[1,2,3,4,5]" }.size() );
+        EXPECT_EQ( scanner.bytesDecoded(), 2u );
+
+        scanner.resetStatistics();
+        EXPECT_EQ( scanner.bytesSkipped(), 0u );
+        EXPECT_EQ( scanner.bytesDecoded(), 0u );
+    }
+
+    //=====================================================================
+    // Targeted deserialization
+    //=====================================================================
+
+    TEST( JSONScannerTest, FromStringAt )
+    {
+        const std::string json =
+            R"({"envelope":{"trace":[{"id":1},{"id":2}],"note":"}]"},"data":{"values":[1,2,3],"names":{"a":1}}})";
+
+        EXPECT_EQ(
+            Serializer<std::vector<int>>::fromStringAt( json, "/data/values" ), ( std::vector<int>{ 1, 2, 3 } ) );
+        EXPECT_EQ( ( Serializer<std::map<std::string, int>>::fromStringAt( json, "/data/names" ) ),
+            ( std::map<std::string, int>{ { "a", 1 } } ) );
+        EXPECT_EQ( Serializer<std::string>::fromStringAt( json, "/envelope/note" ), "}]" );
+
+        Scanner scanner{ json };
+        EXPECT_EQ( Serializer<int>::fromStringAt( scanner, "/data/values/2" ), 3 );
+        EXPECT_GT( scanner.bytesSkipped(), 0u );
+
+        EXPECT_THROW( Serializer<int>::fromStringAt( json, "/data/missing" ), std::runtime_error );
+    }
+} // namespace nfx::serialization::json::test
@@ -0,0 +1,254 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2026 nfx
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * @file Tests_JsonSchema.cpp
+ * @brief Unit tests for JSON Schema generation
+ * @details Tests SchemaOf<T>() for scalars, optionals, STL containers, tuples and variants,
+ *          trait-declared schemas, caching, and validation of serialized values with
+ *          SchemaValidatorOf<T>().
+ */
+
+#include <gtest/gtest.h>
+
+#include <nfx/Serialization.h>
+
+#include <array>
+#include <cstdint>
+#include <map>
+#include <optional>
+#include <set>
+#include <string>
+#include <tuple>
+#include <variant>
+#include <vector>
+
+using namespace nfx::json;
+using namespace nfx::serialization::json;
+
+namespace nfx::serialization::json::test
+{
+    /**
+     * @brief Type declaring its schema through SerializationTraits
+     */
+    struct Sensor
+    {
+        std::string id;
+        double value = 0.0;
+    };
+
+    /** @brief Enumeration named by reflection */
+    enum class Mode
+    {
+        Off,
+        On
+    };
+
+    /** @brief Flag enumeration */
+    enum class Feature : std::uint8_t
+    {
+        Fast = 1,
+        Safe = 2
+    };
+} // namespace nfx::serialization::json::test
+
+namespace nfx::serialization::json
+{
+    template <>
+    struct SerializationTraits<test::Sensor>
+    {
+        static void serialize( const test::Sensor& obj, Builder& builder )
+        {
+            builder.writeStartObject();
+            builder.write( "id", obj.id );
+            builder.write( "value", obj.value );
+            builder.writeEndObject();
+        }
+
+        static void fromDocument( const Document& doc, test::Sensor& obj )
+        {
+            obj.id = doc.get<std::string>( "id" ).value_or( "" );
+            obj.value = doc.get<double>( "value" ).value_or( 0.0 );
+        }
+
+        static Document schema()
+        {
+            return Document::fromString( R"({"type":"object","required":["id","value"]})" ).value();
+        }
+    };
+
+    template <>
+    struct EnumTraits<test::Feature>
+    {
+        static constexpr bool flags = true;
+    };
+} // namespace nfx::serialization::json
+
+namespace nfx::serialization::json::test
+{
+    //=====================================================================
+    // Scalars
+    //=====================================================================
+
+    TEST( JSONSchemaTest, Scalars )
+    {
+        EXPECT_EQ( SchemaOf<bool>().get<std::string>( "/type" ), "boolean" );
+        EXPECT_EQ( SchemaOf<double>().get<std::string>( "/type" ), "number" );
+        EXPECT_EQ( SchemaOf<std::string>().get<std::string>( "/type" ), "string" );
+        EXPECT_EQ( SchemaOf<std::string>().get<std::string>( "/$schema" ),
+            "https://json-schema.org/draft/2020-12/schema" );
+
+        const Document& byte = SchemaOf<std::uint8_t>();
+        EXPECT_EQ( byte.get<std::string>( "/type" ), "integer" );
+        EXPECT_EQ( byte.get<std::int64_t>( "/minimum" ), 0 );
+        EXPECT_EQ( byte.get<std::int64_t>( "/maximum" ), 255 );
+        EXPECT_EQ( SchemaOf<std::int16_t>().get<std::int64_t>( "/minimum" ), -32768 );
+    }
+
+    TEST( JSONSchemaTest, NullableTypes )
+    {
+        const Document& schema = SchemaOf<std::optional<int>>();
+        EXPECT_EQ( schema.get<std::string>( "/anyOf/0/type" ), "integer" );
+        EXPECT_EQ( schema.get<std::string>( "/anyOf/1/type" ), "null" );
+    }
+
+    //=====================================================================
+    // Containers
+    //=====================================================================
+
+    TEST( JSONSchemaTest, Containers )
+    {
+        const Document& vector = SchemaOf<std::vector<std::string>>();
+        EXPECT_EQ( vector.get<std::string>( "/type" ), "array" );
+        EXPECT_EQ( vector.get<std::string>( "/items/type" ), "string" );
+        EXPECT_FALSE( vector.contains( "/uniqueItems" ) );
+
+        EXPECT_EQ( SchemaOf<std::set<int>>().get<bool>( "/uniqueItems" ), true );
+
+        const Document& array = SchemaOf<std::array<int, 3>>();
+        EXPECT_EQ( array.get<std::int64_t>( "/minItems" ), 3 );
+        EXPECT_EQ( array.get<std::int64_t>( "/maxItems" ), 3 );
+
+        const Document& map = SchemaOf<std::map<std::string, std::vector<double>>>();
+        EXPECT_EQ( map.get<std::string>( "/type" ), "object" );
+        EXPECT_EQ( map.get<std::string>( "/additionalProperties/items/type" ), "number" );
+
+        const Document& multimap = SchemaOf<std::multimap<std::string, int>>();
+        EXPECT_EQ( multimap.get<std::string>( "/items/properties/key/type" ), "string" );
+        EXPECT_EQ( multimap.get<std::string>( "/items/properties/value/type" ), "integer" );
+        EXPECT_EQ( multimap.get<std::string>( "/items/required/1" ), "value" );
+        EXPECT_EQ( multimap.get<std::string>( "/items/prefixItems/0/type" ), "string" );
+        EXPECT_EQ( multimap.get<std::string>( "/items/prefixItems/1/type" ), "integer" );
+    }
+
+    TEST( JSONSchemaTest, Tuples )
+    {
+        const Document& schema = SchemaOf<std::tuple<int, std::string, bool>>();
+        EXPECT_EQ( schema.get<std::string>( "/prefixItems/1/type" ), "string" );
+        EXPECT_EQ( schema.get<bool>( "/items" ), false );
+        EXPECT_EQ( schema.get<std::int64_t>( "/maxItems" ), 3 );
+
+        using Pair = std::pair<std::string, double>;
+        EXPECT_EQ( SchemaOf<Pair>().get<std::string>( "/prefixItems/1/type" ), "number" );
+    }
+
+    TEST( JSONSchemaTest, Variants )
+    {
+        // Default adjacent layout: {"tag": <name or index>, "data": value}
+        const Document& schema = SchemaOf<std::variant<std::monostate, int, std::string>>();
+        EXPECT_EQ( schema.get<std::string>( "/oneOf/0/properties/data/type" ), "null" );
+        EXPECT_EQ( schema.get<std::string>( "/oneOf/2/properties/data/type" ), "string" );
+        EXPECT_EQ( schema.get<std::int64_t>( "/oneOf/2/properties/tag/enum/1" ), 2 );
+        EXPECT_EQ( schema.get<std::string>( "/oneOf/1/required/0" ), "tag" );
+    }
+
+    TEST( JSONSchemaTest, Enumerations )
+    {
+        // Names or the underlying value (EnumFormat::Integer)
+        const Document& mode = SchemaOf<Mode>();
+        EXPECT_EQ( mode.get<std::string>( "/anyOf/0/enum/0" ), "Off" );
+        EXPECT_EQ( mode.get<std::string>( "/anyOf/0/enum/1" ), "On" );
+        EXPECT_EQ( mode.get<std::string>( "/anyOf/1/type" ), "integer" );
+
+        // Flags: arrays of names
+        const Document& features = SchemaOf<Feature>();
+        EXPECT_EQ( features.get<std::string>( "/anyOf/0/type" ), "array" );
+        EXPECT_EQ( features.get<std::string>( "/anyOf/0/items/anyOf/0/enum/1" ), "Safe" );
+        EXPECT_EQ( features.get<std::string>( "/anyOf/1/type" ), "integer" );
+    }
+
+    TEST( JSONSchemaTest, ByteContainers )
+    {
+        // Base64 or hex strings (BytesFormat), or arrays of bytes
+        const Document& bytes = SchemaOf<std::vector<std::uint8_t>>();
+        EXPECT_EQ( bytes.get<std::string>( "/anyOf/0/type" ), "string" );
+        EXPECT_EQ( bytes.get<std::string>( "/anyOf/0/contentEncoding" ), "base64" );
+        EXPECT_EQ( bytes.get<std::string>( "/anyOf/1/type" ), "string" );
+        EXPECT_EQ( bytes.get<std::string>( "/anyOf/2/type" ), "array" );
+        EXPECT_EQ( bytes.get<std::int64_t>( "/anyOf/2/items/maximum" ), 255 );
+        EXPECT_FALSE( bytes.get<std::int64_t>( "/anyOf/0/minLength" ).has_value() );
+
+        // Fixed sizes bound the string lengths: 32 bytes are 43 base64 characters unpadded, 44 padded
+        const Document& digest = SchemaOf<std::array<std::uint8_t, 32>>();
+        EXPECT_EQ( digest.get<std::int64_t>( "/anyOf/0/minLength" ), 43 );
+        EXPECT_EQ( digest.get<std::int64_t>( "/anyOf/0/maxLength" ), 44 );
+        EXPECT_EQ( digest.get<std::int64_t>( "/anyOf/1/minLength" ), 64 );
+        EXPECT_EQ( digest.get<std::int64_t>( "/anyOf/2/maxItems" ), 32 );
+    }
+
+    //=====================================================================
+    // Declared schemas, caching and validation
+    //=====================================================================
+
+    TEST( JSONSchemaTest, DeclaredSchemaIsEmbedded )
+    {
+        EXPECT_EQ( SchemaOf<Sensor>().get<std::string>( "/required/0" ), "id" );
+
+        const Document& sensors = SchemaOf<std::map<std::string, Sensor>>();
+        EXPECT_EQ( sensors.get<std::string>( "/additionalProperties/type" ), "object" );
+        EXPECT_EQ( sensors.get<std::string>( "/additionalProperties/required/1" ), "value" );
+    }
+
+    TEST( JSONSchemaTest, GeneratedOnce )
+    {
+        using Type = std::vector<std::map<std::string, std::optional<int>>>;
+
+        EXPECT_EQ( &SchemaOf<Type>(), &SchemaOf<Type>() );
+        EXPECT_EQ( &SchemaValidatorOf<Type>(), &SchemaValidatorOf<Type>() );
+    }
+
+    TEST( JSONSchemaTest, ValidatesSerializedValues )
+    {
+        using Readings = std::map<std::string, std::vector<std::uint8_t>>;
+
+        const Readings readings{ { "a", { 1, 2, 3 } }, { "b", {} } };
+        const auto valid = Document::fromString( Serializer<Readings>::toString( readings ) );
+        ASSERT_TRUE( valid.has_value() );
+        EXPECT_TRUE( SchemaValidatorOf<Readings>().validate( *valid ).isValid() );
+
+        const auto invalid = Document::fromString( R"({"a":[1,300],"b":"x"})" );
+        ASSERT_TRUE( invalid.has_value() );
+        EXPECT_FALSE( SchemaValidatorOf<Readings>().validate( *invalid ).isValid() );
+    }
+} // namespace nfx::serialization::json::test
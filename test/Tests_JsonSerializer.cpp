@@ -38,6 +38,7 @@
 #include <array>
 #include <deque>
 #include <forward_list>
+#include <limits>
 #include <list>
 #include <map>
 #include <memory>
@@ -45,6 +46,7 @@
 #include <set>
 #include <span>
 #include <string>
+#include <string_view>
 #include <unordered_map>
 #include <unordered_set>
 #include <vector>
@@ -370,6 +372,56 @@ namespace nfx::serialization::json::test
         testRoundTrip( int{ 0 } );
         testRoundTrip( std::int64_t{ 1234567890123LL } );
         testRoundTrip( std::int32_t{ -2147483648 } );
+
+        // Maximum of every unsigned width: written unsigned, read back exactly, measured exactly
+        const auto roundTripsMax = [this]<typename U>( U max, std::string_view json ) {
+            EXPECT_EQ( Serializer<U>::toString( max ), json );
+            EXPECT_EQ( Serializer<U>::serializedSize( max ), json.size() );
+            testRoundTrip( max );
+        };
+        roundTripsMax( std::numeric_limits<std::uint8_t>::max(), "255" );
+        roundTripsMax( std::numeric_limits<std::uint16_t>::max(), "65535" );
+        roundTripsMax( std::numeric_limits<std::uint32_t>::max(), "4294967295" );
+        roundTripsMax( std::numeric_limits<std::uint64_t>::max(), "18446744073709551615" );
+
+        const std::vector<std::uint64_t> high{ std::uint64_t{ 1 } << 63, 10000000000000000000ULL };
+        const auto restored = Serializer<std::vector<std::uint64_t>>::tryFromString(
+            Serializer<std::vector<std::uint64_t>>::toString( high ) );
+        ASSERT_TRUE( restored );
+        EXPECT_EQ( *restored, high );
+        EXPECT_EQ( Serializer<std::vector<std::uint64_t>>::serializedSize( high ), 42u );
+    }
+
+    TEST_F( JSONSerializerTest, IntegerRangeChecking )
+    {
+        // validateOnDeserialize (the default) rejects values that do not convert exactly
+        EXPECT_EQ( Serializer<std::uint8_t>::fromString( "255" ), 255 );
+        EXPECT_EQ( Serializer<std::int8_t>::fromString( "-128" ), -128 );
+        EXPECT_EQ( Serializer<std::int64_t>::fromString( "-9223372036854775808" ), INT64_MIN );
+        EXPECT_EQ( Serializer<std::uint64_t>::fromString( "18446744073709551615" ), UINT64_MAX );
+        EXPECT_EQ( Serializer<int>::fromString( "3.0" ), 3 );
+        EXPECT_EQ( Serializer<int>::fromString( "1e3" ), 1000 );
+
+        EXPECT_THROW( Serializer<std::uint8_t>::fromString( "300" ), std::runtime_error );
+        EXPECT_THROW( Serializer<std::uint8_t>::fromString( "-1" ), std::runtime_error );
+        EXPECT_THROW( Serializer<std::int8_t>::fromString( "128" ), std::runtime_error );
+        EXPECT_THROW( Serializer<std::int16_t>::fromString( "40000" ), std::runtime_error );
+        EXPECT_THROW( Serializer<std::uint32_t>::fromString( "4294967296" ), std::runtime_error );
+        EXPECT_THROW( Serializer<std::int64_t>::fromString( "9223372036854775808" ), std::runtime_error );
+        EXPECT_THROW( Serializer<std::int64_t>::fromString( "9223372036854775808.0" ), std::runtime_error );
+        EXPECT_THROW( Serializer<std::uint64_t>::fromString( "1.8446744073709552e19" ), std::runtime_error );
+        EXPECT_THROW( Serializer<int>::fromString( "1.5" ), std::runtime_error );
+
+        const auto result = Serializer<std::vector<std::uint16_t>>::tryFromString( "[1,70000]" );
+        ASSERT_FALSE( result );
+        EXPECT_EQ( result.error().code(), ErrorCode::OutOfRange );
+        EXPECT_EQ( result.error().path(), "/1" );
+        EXPECT_EQ( Serializer<int>::tryFromString( "2.5" ).error().code(), ErrorCode::TypeMismatch );
+
+        // Without validation values are narrowed as before
+        Serializer<std::uint8_t>::Options options;
+        options.validateOnDeserialize = false;
+        EXPECT_EQ( Serializer<std::uint8_t>::fromString( "300", options ), 44 );
     }
 
     TEST_F( JSONSerializerTest, FloatingPointTypes )
@@ -404,6 +456,116 @@ namespace nfx::serialization::json::test
         EXPECT_EQ( deserialized, input );
     }
 
+    TEST_F( JSONSerializerTest, StringViewBorrowsInputBuffer )
+    {
+        const std::string json = R"({"method":"GET","path":"/api/users","empty":""})";
+        const auto inBuffer = [&json]( std::string_view view ) {
+            return view.data() >= json.data() && view.data() + view.size() <= json.data() + json.size();
+        };
+
+        auto fields = Serializer<std::map<std::string, std::string_view>>::fromString( json );
+
+        ASSERT_EQ( fields.size(), 3u );
+        EXPECT_EQ( fields["method"], "GET" );
+        EXPECT_EQ( fields["path"], "/api/users" );
+        EXPECT_TRUE( fields["empty"].empty() );
+        EXPECT_TRUE( inBuffer( fields["method"] ) );
+        EXPECT_TRUE( inBuffer( fields["path"] ) );
+
+        // Views are located by position: repeated values, and values equal to keys read out of order
+        const std::string repeated = R"(["x","y","x","x"])";
+        auto list = Serializer<std::vector<std::string_view>>::fromString( repeated );
+        ASSERT_EQ( list.size(), 4u );
+        EXPECT_EQ( list[3], "x" );
+        EXPECT_EQ( list[3].data(), repeated.data() + 14 );
+
+        const std::string swapped = R"({"b":"a","a":"b"})";
+        auto pairs = Serializer<std::map<std::string, std::string_view>>::fromString( swapped );
+        EXPECT_EQ( pairs["a"], "b" );
+        EXPECT_EQ( pairs["b"], "a" );
+        EXPECT_EQ( pairs["a"].data(), swapped.data() + 14 );
+        EXPECT_EQ( pairs["b"].data(), swapped.data() + 6 );
+
+        const std::vector<std::string_view> views{ "a", "b", "c" };
+        testRoundTrip( views );
+        EXPECT_EQ( Serializer<std::string_view>::toString( "text" ), R"("text")" );
+    }
+
+    TEST_F( JSONSerializerTest, StringViewEscapedUsesArena )
+    {
+        const std::string json = R"(["plain","line\nbreak","caf\u00e9"])";
+
+        EXPECT_THROW( Serializer<std::vector<std::string_view>>::fromString( json ), std::runtime_error );
+
+        StringArena arena;
+        Serializer<std::vector<std::string_view>>::Options options;
+        options.stringArena = &arena;
+
+        auto views = Serializer<std::vector<std::string_view>>::fromString( json, options );
+
+        ASSERT_EQ( views.size(), 3u );
+        EXPECT_EQ( views[0], "plain" );
+        EXPECT_EQ( views[1], "line\nbreak" );
+        EXPECT_EQ( views[2], "caf\xC3\xA9" );
+        EXPECT_EQ( views[0].data(), json.data() + 2 );
+        EXPECT_EQ( arena.size(), views[1].size() + views[2].size() );
+
+        // Escapes that decode to plain text are told apart by position, not by content
+        const std::string plainEscapes = R"(["\u0041bc","a\/b","Abc"])";
+        arena.clear();
+        views = Serializer<std::vector<std::string_view>>::fromString( plainEscapes, options );
+        ASSERT_EQ( views.size(), 3u );
+        EXPECT_EQ( views[0], "Abc" );
+        EXPECT_EQ( views[1], "a/b" );
+        EXPECT_EQ( views[2].data(), plainEscapes.data() + plainEscapes.rfind( "Abc" ) );
+        EXPECT_EQ( arena.size(), 6u );
+    }
+
+    TEST_F( JSONSerializerTest, InternedStringsShareStorage )
+    {
+        const std::string json = R"(["DE","FR","DE","DE","FR"])";
+
+        StringPool pool;
+        Serializer<std::vector<InternedString>>::Options options;
+        options.stringPool = &pool;
+
+        auto codes = Serializer<std::vector<InternedString>>::fromString( json, options );
+
+        ASSERT_EQ( codes.size(), 5u );
+        EXPECT_EQ( pool.size(), 2u );
+        EXPECT_EQ( codes[0], "DE" );
+        EXPECT_EQ( codes[1], "FR" );
+        EXPECT_EQ( codes[0].storage(), codes[2].storage() );
+        EXPECT_EQ( codes[1].storage(), codes[4].storage() );
+        EXPECT_EQ( Serializer<std::vector<InternedString>>::toString( codes ), json );
+
+        // Without a configured pool, values share storage within one call only
+        auto unpooled = Serializer<std::vector<InternedString>>::fromString( json );
+        EXPECT_EQ( unpooled[0].storage(), unpooled[2].storage() );
+        auto first = Serializer<InternedString>::fromString( R"("status")" );
+        auto second = Serializer<InternedString>::fromString( R"("status")" );
+        EXPECT_EQ( first, second );
+        EXPECT_NE( first.storage(), second.storage() );
+    }
+
+    TEST_F( JSONSerializerTest, SharedConstStringsAreInterned )
+    {
+        using Column = std::vector<std::shared_ptr<const std::string>>;
+
+        StringPool pool;
+        Serializer<Column>::Options options;
+        options.stringPool = &pool;
+
+        auto column = Serializer<Column>::fromString( R"(["tech",null,"tech"])", options );
+
+        ASSERT_EQ( column.size(), 3u );
+        ASSERT_NE( column[0], nullptr );
+        EXPECT_EQ( *column[0], "tech" );
+        EXPECT_EQ( column[1], nullptr );
+        EXPECT_EQ( column[0], column[2] );
+        EXPECT_EQ( Serializer<Column>::toString( column ), R"(["tech",null,"tech"])" );
+    }
+
     //----------------------------------------------
     // STL containers
     //----------------------------------------------
@@ -435,6 +597,43 @@ namespace nfx::serialization::json::test
         testRoundTrip( std::unordered_map<std::string, double>{ { "pi", 3.14 }, { "e", 2.71 } } );
     }
 
+    TEST_F( JSONSerializerTest, MapNonStringKeys )
+    {
+        // Keys are written as numbers in member names and parsed back
+        const std::map<int, std::string> byId{ { -1, "minus" }, { 10, "ten" } };
+        EXPECT_EQ( ( Serializer<std::map<int, std::string>>::toString( byId ) ), R"({"-1":"minus","10":"ten"})" );
+        testRoundTrip( byId );
+        testRoundTrip( std::unordered_map<std::uint64_t, int>{ { 18446744073709551615ull, 1 }, { 0, 2 } } );
+
+        // Floating-point keys use their shortest exact form
+        const std::map<double, int> byWeight{ { 0.1, 1 }, { 2.5, 2 } };
+        EXPECT_EQ( ( Serializer<std::map<double, int>>::toString( byWeight ) ), R"({"0.1":1,"2.5":2})" );
+        testRoundTrip( byWeight );
+
+        // Enumerations use their underlying value
+        enum class Slot : std::uint8_t
+        {
+            Head = 1,
+            Hand = 4
+        };
+        const std::map<Slot, std::string> equipment{ { Slot::Head, "helm" }, { Slot::Hand, "sword" } };
+        EXPECT_EQ( ( Serializer<std::map<Slot, std::string>>::toString( equipment ) ), R"({"1":"helm","4":"sword"})" );
+        testRoundTrip( equipment );
+
+        // Member names that are not keys of the type are rejected
+        const auto invalid = Serializer<std::map<std::uint8_t, int>>::tryFromString( R"({"1":1,"300":2})" );
+        ASSERT_FALSE( invalid );
+        EXPECT_EQ( invalid.error().code(), ErrorCode::InvalidFormat );
+        EXPECT_EQ( invalid.error().path(), "/300" );
+
+        // Existing entries are refreshed and patched by key
+        std::map<int, int> live{ { 1, 0 }, { 2, 0 }, { 3, 0 } };
+        Serializer<std::map<int, int>>::deserializeInto( R"({"2":20,"3":30})", live );
+        EXPECT_EQ( live, ( std::map<int, int>{ { 2, 20 }, { 3, 30 } } ) );
+        Serializer<std::map<int, int>>::applyMergePatch( R"({"2":null,"4":40})", live );
+        EXPECT_EQ( live, ( std::map<int, int>{ { 3, 30 }, { 4, 40 } } ) );
+    }
+
     TEST_F( JSONSerializerTest, SetTypes )
     {
         testRoundTrip( std::set<int>{ 1, 2, 3, 4, 5 } );
@@ -528,6 +727,38 @@ namespace nfx::serialization::json::test
         testRoundTrip( emptyMultimap );
     }
 
+    TEST_F( JSONSerializerTest, MultimapCompactLayout )
+    {
+        std::multimap<int, std::string> multimap{ { 1, "one" }, { 1, "uno" }, { 2, "two" } };
+
+        Serializer<std::multimap<int, std::string>>::Options options;
+        options.pairLayout = PairLayout::Array;
+
+        const std::string compact = Serializer<std::multimap<int, std::string>>::toString( multimap, options );
+        EXPECT_EQ( compact, R"([[1,"one"],[1,"uno"],[2,"two"]])" );
+        EXPECT_LT( compact.size(), ( Serializer<std::multimap<int, std::string>>::toString( multimap ).size() ) );
+        EXPECT_EQ( ( Serializer<std::multimap<int, std::string>>::serializedSize( multimap, options ) ),
+                   compact.size() );
+        EXPECT_EQ( ( Serializer<std::multimap<int, std::string>>::fromString( compact ) ), multimap );
+
+        // The reader accepts both layouts, also mixed within one array
+        const auto mixed = Serializer<std::unordered_multimap<std::string, int>>::fromString(
+            R"([["a",1],{"value":2,"key":"a"},["b",3]])" );
+        EXPECT_EQ( mixed.count( "a" ), 2 );
+        EXPECT_EQ( mixed.count( "b" ), 1 );
+
+        // Nested serializers inherit the layout
+        using Index = std::map<std::string, std::multimap<int, std::string>>;
+        const auto nested = Serializer<Index>::Options::createFrom<std::multimap<int, std::string>>( options );
+        EXPECT_EQ( Serializer<Index>::toString( Index{ { "entries", multimap } }, nested ),
+                   R"({"entries":[[1,"one"],[1,"uno"],[2,"two"]]})" );
+
+        // Errors inside a compact entry point at the element index
+        const auto result = Serializer<std::multimap<int, int>>::tryFromString( R"([[1,2],[3,"x"]])" );
+        ASSERT_FALSE( result );
+        EXPECT_EQ( result.error().path(), "/1/1" );
+    }
+
     TEST_F( JSONSerializerTest, MultisetTypes )
     {
         // std::multiset with duplicates
@@ -547,6 +778,30 @@ namespace nfx::serialization::json::test
         testRoundTrip( emptyMultiset );
     }
 
+    TEST_F( JSONSerializerTest, OrderedContainersUnsortedInput )
+    {
+        // Sorted input is linked at the end; anything else still lands in key order
+        EXPECT_EQ( ( Serializer<std::set<int>>::fromString( "[5,1,4,1,3]" ) ), ( std::set<int>{ 1, 3, 4, 5 } ) );
+        EXPECT_EQ( ( Serializer<std::multiset<int>>::fromString( "[3,1,3,2]" ) ),
+                   ( std::multiset<int>{ 1, 2, 3, 3 } ) );
+
+        const auto byName = Serializer<std::map<std::string, int>>::fromString( R"({"c":3,"a":1,"b":2})" );
+        EXPECT_EQ( byName, ( std::map<std::string, int>{ { "a", 1 }, { "b", 2 }, { "c", 3 } } ) );
+
+        // Equal keys keep the order they were written in
+        const auto grouped = Serializer<std::multimap<int, std::string>>::fromString(
+            R"([{"key":2,"value":"x"},{"key":1,"value":"y"},{"key":2,"value":"z"}])" );
+        ASSERT_EQ( grouped.size(), 3 );
+        EXPECT_EQ( grouped.begin()->second, "y" );
+        EXPECT_EQ( std::next( grouped.begin() )->second, "x" );
+        EXPECT_EQ( grouped.rbegin()->second, "z" );
+
+        // Existing entries are matched in any order
+        std::map<std::string, int> live{ { "a", 0 }, { "b", 0 }, { "c", 0 } };
+        Serializer<std::map<std::string, int>>::deserializeInto( R"({"c":3,"b":2,"d":4})", live );
+        EXPECT_EQ( live, ( std::map<std::string, int>{ { "b", 2 }, { "c", 3 }, { "d", 4 } } ) );
+    }
+
     TEST_F( JSONSerializerTest, VariantTypes )
     {
         // Basic variant with primitives
@@ -608,6 +863,447 @@ namespace nfx::serialization::json::test
         }
     }
 
+    //----------------------------------------------
+    // Variant tag encodings
+    //----------------------------------------------
+
+    /**
+     * @brief Distinct variant alternative type (all instantiations share one simplified type name)
+     */
+    template <std::size_t N>
+    struct Slot
+    {
+        int value = 0;
+
+        bool operator==( const Slot& other ) const
+        {
+            return value == other.value;
+        }
+    };
+
+    /** @brief Variant whose simplified type names collide ("vector") */
+    using CollidingVariant = std::variant<std::vector<int>, std::vector<double>>;
+
+    /** @brief Colliding variant tagged by index through its VariantTraits */
+    using IndexedVariant = std::variant<std::vector<float>, std::vector<double>>;
+
+    /** @brief Variant with 24 alternatives, tagged by user-defined names */
+    using WideVariant = decltype( []<std::size_t... I>( std::index_sequence<I...> ) {
+        return std::variant<Slot<I>...>{};
+    }( std::make_index_sequence<24>{} ) );
+
+    TEST_F( JSONSerializerTest, VariantIndexTags )
+    {
+        using V = std::variant<int, std::string, double>;
+
+        Serializer<V>::Options options;
+        options.variantTagFormat = VariantTagFormat::Index;
+
+        const V value = std::string{ "hello" };
+        const std::string json = Serializer<V>::toString( value, options );
+
+        EXPECT_EQ( json, R"({"tag":1,"data":"hello"})" );
+        EXPECT_EQ( Serializer<V>::fromString( json ), value );
+
+        // Readers accept both tag formats regardless of the option
+        EXPECT_EQ( Serializer<V>::fromString( R"({"tag":"double","data":2.5})", options ), V{ 2.5 } );
+
+        EXPECT_THROW( Serializer<V>::fromString( R"({"tag":3,"data":1})" ), std::runtime_error );
+        EXPECT_THROW( Serializer<V>::fromString( R"({"tag":-1,"data":1})" ), std::runtime_error );
+        EXPECT_THROW( Serializer<V>::fromString( R"({"tag":"float","data":1})" ), std::runtime_error );
+
+        // Colliding names are usable when VariantTraits selects index tags, whatever the option
+        const IndexedVariant doubles = std::vector<double>{ 1.5 };
+        EXPECT_EQ( Serializer<IndexedVariant>::toString( doubles ), R"({"tag":1,"data":[1.5]})" );
+        EXPECT_EQ( Serializer<IndexedVariant>::fromString( R"({"tag":1,"data":[1.5]})" ), doubles );
+        EXPECT_EQ( Serializer<IndexedVariant>::serializedSize( doubles ), 22u );
+        EXPECT_THROW(
+            Serializer<IndexedVariant>::fromString( R"({"tag":"vector","data":[1.5]})" ), std::runtime_error );
+    }
+
+    TEST_F( JSONSerializerTest, VariantCustomTagNames )
+    {
+        const CollidingVariant ints = std::vector<int>{ 1, 2 };
+        const CollidingVariant doubles = std::vector<double>{ 1.5, 2.5 };
+
+        EXPECT_EQ( Serializer<CollidingVariant>::toString( doubles ), R"({"tag":"doubles","data":[1.5,2.5]})" );
+        testRoundTrip( ints );
+        testRoundTrip( doubles );
+
+        // Every alternative of a wide variant resolves through the tag table
+        [this]<std::size_t... I>( std::index_sequence<I...> ) {
+            ( testRoundTrip( WideVariant{ std::in_place_index<I>, Slot<I>{ static_cast<int>( I ) * 10 } } ), ... );
+        }( std::make_index_sequence<std::variant_size_v<WideVariant>>{} );
+
+        const WideVariant last{ std::in_place_index<23>, Slot<23>{ 7 } };
+        EXPECT_EQ( Serializer<WideVariant>::toString( last ), R"({"tag":"slot23","data":7})" );
+    }
+
+    /**
+     * @brief Variant alternative serialized as a JSON object
+     */
+    struct Circle
+    {
+        double radius = 0.0;
+
+        bool operator==( const Circle& other ) const
+        {
+            return radius == other.radius;
+        }
+    };
+
+    /**
+     * @brief Variant alternative serialized as a JSON object
+     */
+    struct Rectangle
+    {
+        double width = 0.0;
+        double height = 0.0;
+
+        bool operator==( const Rectangle& other ) const
+        {
+            return width == other.width && height == other.height;
+        }
+    };
+
+    /** @brief Variant layout wrappers (distinct types for distinct VariantTraits) */
+    using ExternalShape = std::variant<Circle, Rectangle>;
+    using InternalShape = std::variant<Rectangle, Circle>;
+    using UntaggedValue = std::variant<int, std::string, std::vector<int>>;
+    using DiscriminatedShape = std::variant<std::monostate, Circle, Rectangle>;
+    using InternalRecord = std::variant<Product, Rectangle>;
+
+    /**
+     * @brief Port number read from a string with std::stoi (throws std::invalid_argument)
+     */
+    struct Port
+    {
+        int number = 0;
+
+        bool operator==( const Port& other ) const
+        {
+            return number == other.number;
+        }
+    };
+
+    using PortOrName = std::variant<Port, std::string>;
+
+    TEST_F( JSONSerializerTest, VariantExternalLayout )
+    {
+        const ExternalShape circle = Circle{ 2.5 };
+        const std::string json = Serializer<ExternalShape>::toString( circle );
+
+        EXPECT_EQ( json, R"({"Circle":{"radius":2.5}})" );
+        EXPECT_EQ( Serializer<ExternalShape>::fromString( json ), circle );
+        testRoundTrip( ExternalShape{ Rectangle{ 1.0, 2.0 } } );
+
+        Serializer<ExternalShape>::Options options;
+        options.variantTagFormat = VariantTagFormat::Index;
+        EXPECT_EQ( Serializer<ExternalShape>::toString( circle, options ), R"({"0":{"radius":2.5}})" );
+        EXPECT_EQ( Serializer<ExternalShape>::fromString( R"({"1":{"width":3,"height":4}})" ),
+            ( ExternalShape{ Rectangle{ 3.0, 4.0 } } ) );
+
+        EXPECT_THROW( Serializer<ExternalShape>::fromString( R"({"Circle":{},"Rectangle":{}})" ), std::runtime_error );
+        EXPECT_THROW( Serializer<ExternalShape>::fromString( R"({"Square":{}})" ), std::runtime_error );
+    }
+
+    TEST_F( JSONSerializerTest, VariantInternalLayout )
+    {
+        const InternalShape rect = Rectangle{ 3.5, 4.5 };
+        const std::string json = Serializer<InternalShape>::toString( rect );
+
+        EXPECT_EQ( json, R"({"kind":"rect","width":3.5,"height":4.5})" );
+        EXPECT_EQ( Serializer<InternalShape>::fromString( json ), rect );
+
+        // Tag position within the object does not matter
+        EXPECT_EQ( Serializer<InternalShape>::fromString( R"({"radius":1.5,"kind":"circle"})" ),
+            InternalShape{ Circle{ 1.5 } } );
+
+        EXPECT_THROW( Serializer<InternalShape>::fromString( R"({"radius":1.5})" ), std::runtime_error );
+
+        // Members are written into the tagged object, following its indentation: through
+        // serializeMembers() (Circle), or replayed from the alternative's own object (Rectangle)
+        const std::vector<InternalShape> shapes{ rect, Circle{ 1.5 } };
+        Serializer<std::vector<InternalShape>>::Options pretty;
+        pretty.prettyPrint = true;
+
+        Builder expected( { .indent = 2 } );
+        expected.writeStartArray();
+        expected.writeStartObject();
+        expected.write( "kind", "rect" );
+        expected.write( "width", 3.5 );
+        expected.write( "height", 4.5 );
+        expected.writeEndObject();
+        expected.writeStartObject();
+        expected.write( "kind", "circle" );
+        expected.write( "radius", 1.5 );
+        expected.writeEndObject();
+        expected.writeEndArray();
+        EXPECT_EQ( Serializer<std::vector<InternalShape>>::toString( shapes, pretty ), expected.toString() );
+        EXPECT_EQ( Serializer<std::vector<InternalShape>>::fromString( expected.toString() ), shapes );
+
+        // Legacy toDocument() alternatives replay their document's members
+        const InternalRecord product = Product{ "p-1", "Say \"hi\"", 2.5, 3 };
+        EXPECT_EQ( Serializer<InternalRecord>::toString( product ),
+            R"({"type":"product","id":"p-1","name":"Say \"hi\"","price":2.5,"quantity":3})" );
+        EXPECT_EQ( Serializer<InternalRecord>::fromString( Serializer<InternalRecord>::toString( product ) ), product );
+    }
+
+    TEST_F( JSONSerializerTest, VariantUntaggedLayout )
+    {
+        // Trial in declaration order
+        EXPECT_EQ( Serializer<UntaggedValue>::toString( UntaggedValue{ std::string{ "text" } } ), R"("text")" );
+        testRoundTrip( UntaggedValue{ 42 } );
+        testRoundTrip( UntaggedValue{ std::string{ "text" } } );
+        testRoundTrip( UntaggedValue{ std::vector<int>{ 1, 2 } } );
+        EXPECT_THROW( Serializer<UntaggedValue>::fromString( "true" ), std::runtime_error );
+
+        // Discriminator predicate
+        EXPECT_EQ( Serializer<DiscriminatedShape>::fromString( R"({"radius":2})" ), DiscriminatedShape{ Circle{ 2.0 } } );
+        EXPECT_EQ( Serializer<DiscriminatedShape>::fromString( R"({"width":1,"height":2})" ),
+            ( DiscriminatedShape{ Rectangle{ 1.0, 2.0 } } ) );
+        EXPECT_EQ( Serializer<DiscriminatedShape>::fromString( "null" ), DiscriminatedShape{} );
+
+        // Any std::exception from a trait rejects the alternative
+        EXPECT_EQ( Serializer<PortOrName>::fromString( R"("8080")" ), PortOrName{ Port{ 8080 } } );
+        EXPECT_EQ( Serializer<PortOrName>::fromString( R"("http")" ), PortOrName{ std::string{ "http" } } );
+    }
+
+    //----------------------------------------------
+    // Enumerations
+    //----------------------------------------------
+
+    /** @brief Enumeration named by reflection */
+    enum class Channel
+    {
+        Email,
+        Sms,
+        Push
+    };
+
+    /** @brief Flag enumeration (EnumTraits<Permission>::flags) */
+    enum class Permission : std::uint8_t
+    {
+        None = 0,
+        Read = 1,
+        Write = 2,
+        Execute = 4
+    };
+
+    constexpr Permission operator|( Permission lhs, Permission rhs ) noexcept
+    {
+        return static_cast<Permission>( static_cast<std::uint8_t>( lhs ) | static_cast<std::uint8_t>( rhs ) );
+    }
+
+    /** @brief Enumeration with wire names differing from its identifiers */
+    enum class Level
+    {
+        Warning,
+        Error
+    };
+
+    /** @brief Enumeration outside the reflected range, registered with NFX_SERIALIZATION_ENUM() */
+    enum class Region : std::int16_t
+    {
+        West = -200,
+        East = 400
+    };
+
+    TEST_F( JSONSerializerTest, EnumNames )
+    {
+        EXPECT_EQ( Serializer<Channel>::toString( Channel::Sms ), R"("Sms")" );
+        EXPECT_EQ( Serializer<std::vector<Channel>>::toString( { Channel::Push, Channel::Email } ),
+            R"(["Push","Email"])" );
+        testRoundTrip( Channel::Email );
+        testRoundTrip( std::vector<Channel>{ Channel::Push, Channel::Sms, Channel::Email } );
+
+        // Values without a name fall back to the underlying value
+        EXPECT_EQ( Serializer<Channel>::toString( static_cast<Channel>( 7 ) ), "7" );
+        testRoundTrip( static_cast<Channel>( 7 ) );
+
+        // Custom names, escaped where needed
+        EXPECT_EQ( Serializer<Level>::toString( Level::Warning ), R"("warn")" );
+        EXPECT_EQ( Serializer<Level>::toString( Level::Error ), R"("error \"fatal\"")" );
+        testRoundTrip( Level::Error );
+
+        // Registered enumerators outside the reflected range
+        EXPECT_EQ( Serializer<Region>::toString( Region::West ), R"("West")" );
+        testRoundTrip( Region::East );
+
+        const auto unknown = Serializer<Channel>::tryFromString( R"("Fax")" );
+        ASSERT_FALSE( unknown );
+        EXPECT_EQ( unknown.error().code(), ErrorCode::InvalidFormat );
+        EXPECT_THROW( Serializer<Level>::fromString( R"("Warning")" ), std::runtime_error );
+    }
+
+    TEST_F( JSONSerializerTest, EnumIntegerFormat )
+    {
+        Serializer<std::vector<Channel>>::Options options;
+        options.enumFormat = EnumFormat::Integer;
+
+        const std::vector<Channel> channels{ Channel::Push, Channel::Email };
+        EXPECT_EQ( Serializer<std::vector<Channel>>::toString( channels, options ), "[2,0]" );
+        EXPECT_EQ( Serializer<Region>::toString(
+                       Region::West, Serializer<Region>::Options::createFrom<std::vector<Channel>>( options ) ),
+            "-200" );
+
+        // Readers accept both formats regardless of the option
+        EXPECT_EQ( Serializer<std::vector<Channel>>::fromString( R"([2,"Email"])" ), channels );
+        EXPECT_EQ( Serializer<std::vector<Channel>>::fromString( R"([2,"Email"])", options ), channels );
+    }
+
+    TEST_F( JSONSerializerTest, EnumFlags )
+    {
+        const Permission readWrite = Permission::Read | Permission::Write;
+
+        EXPECT_EQ( Serializer<Permission>::toString( readWrite ), R"(["Read","Write"])" );
+        EXPECT_EQ( Serializer<Permission>::toString( Permission::None ), "[]" );
+        testRoundTrip( readWrite );
+        testRoundTrip( Permission::None );
+
+        // Bits without a name are kept as a number
+        const auto withUnknown = readWrite | static_cast<Permission>( 16 );
+        EXPECT_EQ( Serializer<Permission>::toString( withUnknown ), R"(["Read","Write",16])" );
+        testRoundTrip( withUnknown );
+
+        EXPECT_EQ(
+            Serializer<Permission>::fromString( R"(["Execute","Read"])" ), Permission::Read | Permission::Execute );
+        EXPECT_EQ( Serializer<Permission>::fromString( "5" ), Permission::Read | Permission::Execute );
+
+        Serializer<Permission>::Options options;
+        options.enumFormat = EnumFormat::Integer;
+        EXPECT_EQ( Serializer<Permission>::toString( readWrite, options ), "3" );
+
+        EXPECT_THROW( Serializer<Permission>::fromString( R"(["Read","Delete"])" ), std::runtime_error );
+    }
+
+    TEST_F( JSONSerializerTest, EnumSerializedSize )
+    {
+        const std::vector<Level> levels{ Level::Warning, Level::Error, static_cast<Level>( 5 ) };
+        EXPECT_EQ( Serializer<std::vector<Level>>::serializedSize( levels ),
+            Serializer<std::vector<Level>>::toString( levels ).size() );
+
+        const std::vector<Permission> permissions{ Permission::None, Permission::Read | Permission::Execute };
+        EXPECT_EQ( Serializer<std::vector<Permission>>::serializedSize( permissions ),
+            Serializer<std::vector<Permission>>::toString( permissions ).size() );
+    }
+
+    //----------------------------------------------
+    // Byte containers
+    //----------------------------------------------
+
+    TEST_F( JSONSerializerTest, ByteContainersBase64 )
+    {
+        using Bytes = std::vector<std::uint8_t>;
+
+        EXPECT_EQ( Serializer<Bytes>::toString( Bytes{} ), R"("")" );
+        EXPECT_EQ( Serializer<Bytes>::toString( Bytes{ 1, 2, 3 } ), R"("AQID")" );
+        EXPECT_EQ( Serializer<Bytes>::toString( Bytes{ 0xfb, 0xff } ), R"("+/8=")" );
+        EXPECT_EQ( Serializer<Bytes>::toString( Bytes{ 0xff } ), R"("/w==")" );
+
+        // Long enough for the vectorized blocks, with a tail for the scalar loop
+        Bytes blob( 1000 );
+        for( std::size_t i = 0; i < blob.size(); ++i )
+        {
+            blob[i] = static_cast<std::uint8_t>( i * 7 + i / 13 );
+        }
+        const std::string json = Serializer<Bytes>::toString( blob );
+        EXPECT_EQ( json.size(), base64EncodedLength( blob.size() ) + 2 );
+        EXPECT_EQ( Serializer<Bytes>::fromString( json ), blob );
+
+        // std::byte, std::array and std::span share the encoding
+        const std::vector<std::byte> raw{ std::byte{ 0x00 }, std::byte{ 0x10 }, std::byte{ 0x83 } };
+        EXPECT_EQ( Serializer<std::vector<std::byte>>::toString( raw ), R"("ABCD")" );
+        EXPECT_EQ( Serializer<std::vector<std::byte>>::fromString( R"("ABCD")" ), raw );
+
+        using Digest = std::array<std::uint8_t, 4>;
+        EXPECT_EQ( Serializer<Digest>::toString( Digest{ 0xde, 0xad, 0xbe, 0xef } ), R"("3q2+7w==")" );
+        EXPECT_EQ( Serializer<Digest>::fromString( R"("3q2+7w==")" ), ( Digest{ 0xde, 0xad, 0xbe, 0xef } ) );
+        EXPECT_EQ( Serializer<std::span<const std::uint8_t>>::toString( std::span{ blob }.first( 3 ) ),
+            Serializer<Bytes>::toString( Bytes( blob.begin(), blob.begin() + 3 ) ) );
+
+        // Unpadded text and arrays of numbers are read as well
+        EXPECT_EQ( Serializer<Bytes>::fromString( R"("/w")" ), Bytes{ 0xff } );
+        EXPECT_EQ( Serializer<Bytes>::fromString( "[1,2,3]" ), ( Bytes{ 1, 2, 3 } ) );
+
+        using Keys = std::map<std::string, Bytes>;
+        const Keys keys{ { "a", { 1, 2, 3 } }, { "b", {} } };
+        EXPECT_EQ( Serializer<Keys>::toString( keys ), R"({"a":"AQID","b":""})" );
+    }
+
+    TEST_F( JSONSerializerTest, ByteContainersFormats )
+    {
+        using Bytes = std::vector<std::uint8_t>;
+        const Bytes bytes{ 0x01, 0xab, 0xff };
+
+        Serializer<Bytes>::Options hex;
+        hex.bytesFormat = BytesFormat::Hex;
+        EXPECT_EQ( Serializer<Bytes>::toString( bytes, hex ), R"("01abff")" );
+        EXPECT_EQ( Serializer<Bytes>::fromString( R"("01ABff")", hex ), bytes );
+        EXPECT_EQ( Serializer<Bytes>::fromString( "[1,171,255]", hex ), bytes );
+
+        Bytes blob( 100 );
+        for( std::size_t i = 0; i < blob.size(); ++i )
+        {
+            blob[i] = static_cast<std::uint8_t>( 255 - i * 3 );
+        }
+        EXPECT_EQ( Serializer<Bytes>::fromString( Serializer<Bytes>::toString( blob, hex ), hex ), blob );
+
+        Serializer<Bytes>::Options array;
+        array.bytesFormat = BytesFormat::Array;
+        EXPECT_EQ( Serializer<Bytes>::toString( bytes, array ), "[1,171,255]" );
+        EXPECT_EQ( Serializer<Bytes>::fromString( "[1,171,255]", array ), bytes );
+        EXPECT_EQ( Serializer<Bytes>::fromString( R"("Aav/")", array ), bytes );
+
+        // The reader decodes strings in the selected encoding
+        EXPECT_EQ( Serializer<Bytes>::fromString( R"("0102")" ), ( Bytes{ 0xd3, 0x5d, 0x36 } ) );
+        EXPECT_EQ( Serializer<Bytes>::fromString( R"("0102")", hex ), ( Bytes{ 0x01, 0x02 } ) );
+    }
+
+    TEST_F( JSONSerializerTest, ByteContainersRejectInvalidText )
+    {
+        using Bytes = std::vector<std::uint8_t>;
+
+        EXPECT_EQ( Serializer<Bytes>::tryFromString( R"("AQI*")" ).error().code(), ErrorCode::InvalidFormat );
+        EXPECT_EQ( Serializer<Bytes>::tryFromString( R"("AQIDB")" ).error().code(), ErrorCode::InvalidFormat );
+        EXPECT_EQ( Serializer<Bytes>::tryFromString( R"("AR==")" ).error().code(), ErrorCode::InvalidFormat );
+        EXPECT_EQ( Serializer<Bytes>::tryFromString( R"("AQ=D")" ).error().code(), ErrorCode::InvalidFormat );
+        EXPECT_THROW( Serializer<Bytes>::fromString( R"("A QID")" ), std::runtime_error );
+
+        Serializer<Bytes>::Options hex;
+        hex.bytesFormat = BytesFormat::Hex;
+        EXPECT_EQ( Serializer<Bytes>::tryFromString( R"("abc")", hex ).error().code(), ErrorCode::InvalidFormat );
+        EXPECT_EQ( Serializer<Bytes>::tryFromString( R"("0g")", hex ).error().code(), ErrorCode::InvalidFormat );
+
+        // An invalid character deep inside a block the kernels would otherwise handle
+        const std::string text( 100, 'A' );
+        std::string corrupted = R"(")" + text + R"(")";
+        corrupted[40] = '.';
+        EXPECT_EQ( Serializer<Bytes>::tryFromString( corrupted ).error().code(), ErrorCode::InvalidFormat );
+        EXPECT_EQ( Serializer<Bytes>::tryFromString( corrupted, hex ).error().code(), ErrorCode::InvalidFormat );
+
+        using Digest = std::array<std::uint8_t, 4>;
+        const auto result = Serializer<std::map<std::string, Digest>>::tryFromString( R"({"sha":"AQID"})" );
+        ASSERT_FALSE( result );
+        EXPECT_EQ( result.error().code(), ErrorCode::SizeMismatch );
+        EXPECT_EQ( result.error().path(), "/sha" );
+    }
+
+    TEST_F( JSONSerializerTest, ByteContainersSerializedSize )
+    {
+        using Blobs = std::map<std::string, std::vector<std::uint8_t>>;
+        const Blobs blobs{ { "a", { 1, 2, 3, 4 } }, { "b", {} }, { "c", std::vector<std::uint8_t>( 50, 9 ) } };
+
+        for( const BytesFormat format : { BytesFormat::Base64, BytesFormat::Hex, BytesFormat::Array } )
+        {
+            Serializer<Blobs>::Options options;
+            options.bytesFormat = format;
+            options.prettyPrint = format == BytesFormat::Array;
+            EXPECT_EQ( Serializer<Blobs>::serializedSize( blobs, options ),
+                Serializer<Blobs>::toString( blobs, options ).size() );
+        }
+    }
+
     //----------------------------------------------
     // std::span (serialization only)
     //----------------------------------------------
@@ -769,6 +1465,84 @@ namespace nfx::serialization::json::test
         }
     }
 
+    TEST_F( JSONSerializerTest, SharedPointerReferences )
+    {
+        // Scene graph: several nodes draw the same mesh
+        using Mesh = std::vector<int>;
+        using Scene = std::map<std::string, std::vector<std::shared_ptr<Mesh>>>;
+
+        const auto cube = std::make_shared<Mesh>( Mesh{ 1, 2, 3, 4 } );
+        const auto quad = std::make_shared<Mesh>( Mesh{ 5, 6 } );
+        const Scene scene{ { "a", { cube, quad, cube } }, { "b", { cube, std::make_shared<Mesh>( Mesh{ 7 } ) } } };
+
+        // Plain output repeats each mesh, and reading it back yields copies
+        const std::string plain = Serializer<Scene>::toString( scene );
+        EXPECT_EQ( plain, R"({"a":[[1,2,3,4],[5,6],[1,2,3,4]],"b":[[1,2,3,4],[7]]})" );
+        const Scene copies = Serializer<Scene>::fromString( plain );
+        EXPECT_NE( copies.at( "a" )[0], copies.at( "a" )[2] );
+        EXPECT_EQ( copies.at( "a" )[0].use_count(), 1 );
+
+        // Shared pointees are written once, sole owners in full
+        Serializer<Scene>::Options options;
+        options.preserveSharedReferences = true;
+        const std::string linked = Serializer<Scene>::toString( scene, options );
+        EXPECT_EQ( linked,
+            R"({"a":[{"$id":1,"$value":[1,2,3,4]},{"$id":2,"$value":[5,6]},{"$ref":1}],"b":[{"$ref":1},[7]]})" );
+        EXPECT_EQ( Serializer<Scene>::serializedSize( scene, options ), linked.size() );
+
+        // Reading re-links every reference to the first occurrence
+        const Scene restored = Serializer<Scene>::fromString( linked, options );
+        EXPECT_EQ( restored.at( "a" )[0], restored.at( "a" )[2] );
+        EXPECT_EQ( restored.at( "a" )[0], restored.at( "b" )[0] );
+        EXPECT_EQ( restored.at( "a" )[0].use_count(), 3 );
+        EXPECT_EQ( *restored.at( "a" )[1], *quad );
+        EXPECT_EQ( *restored.at( "b" )[1], Mesh{ 7 } );
+
+        // References must follow the object they name
+        const auto unresolved = Serializer<Scene>::tryFromString( R"({"a":[{"$ref":1}]})", options );
+        ASSERT_FALSE( unresolved );
+        EXPECT_EQ( unresolved.error().code(), ErrorCode::UnresolvedReference );
+
+        // Pointees of another type at the same id do not resolve
+        using Mixed = std::tuple<std::shared_ptr<Mesh>, std::shared_ptr<std::string>>;
+        const auto mismatched =
+            Serializer<Mixed>::tryFromString( R"([{"$id":1,"$value":[1]},{"$ref":1}])",
+                Serializer<Mixed>::Options::createFrom<Scene>( options ) );
+        ASSERT_FALSE( mismatched );
+        EXPECT_EQ( mismatched.error().code(), ErrorCode::UnresolvedReference );
+    }
+
+    /**
+     * @brief Two nodes drawing one mesh, serialized member by member by its SerializationTraits
+     */
+    struct MeshPair
+    {
+        std::shared_ptr<std::vector<int>> first;
+        std::shared_ptr<std::vector<int>> second;
+    };
+
+    TEST_F( JSONSerializerTest, SharedPointerReferencesThroughTraits )
+    {
+        // Traits create their own serializers with default options: the call's options still apply
+        const auto mesh = std::make_shared<std::vector<int>>( std::vector<int>{ 1, 2, 3 } );
+        const MeshPair pair{ mesh, mesh };
+
+        Serializer<MeshPair>::Options options;
+        options.preserveSharedReferences = true;
+        const std::string linked = Serializer<MeshPair>::toString( pair, options );
+        EXPECT_EQ( linked, R"({"first":{"$id":1,"$value":[1,2,3]},"second":{"$ref":1}})" );
+
+        const MeshPair restored = Serializer<MeshPair>::fromString( linked, options );
+        ASSERT_NE( restored.first, nullptr );
+        EXPECT_EQ( restored.first, restored.second );
+        EXPECT_EQ( *restored.first, *mesh );
+
+        MeshPair overwritten;
+        Serializer<MeshPair>::deserializeInto( linked, overwritten, options );
+        EXPECT_EQ( overwritten.first, overwritten.second );
+        EXPECT_EQ( overwritten.first.use_count(), 2 );
+    }
+
     //----------------------------------------------
     // Custom structs with serialize/deserialize methods
     //----------------------------------------------
@@ -804,6 +1578,23 @@ namespace nfx::serialization::json::test
         testRoundTrip( product );
     }
 
+    TEST_F( JSONSerializerTest, NestedDocumentReturnPrettyPrint )
+    {
+        const std::vector<Product> products{ { "P-1", "Widget", 9.5, 3 }, { "P-2", "Gadget", 1.25, 7 } };
+
+        Serializer<std::vector<Product>>::Options options;
+        options.prettyPrint = true;
+
+        // Legacy toDocument() output is streamed through the builder, so nesting is indented consistently
+        const std::string pretty = Serializer<std::vector<Product>>::toString( products, options );
+        EXPECT_NE( pretty.find( "\n    \"id\"" ), std::string::npos );
+        EXPECT_EQ( Serializer<std::vector<Product>>::fromString( pretty ), products );
+
+        const std::string compact = Serializer<std::vector<Product>>::toString( products );
+        EXPECT_EQ( compact.find( '\n' ), std::string::npos );
+        EXPECT_EQ( Serializer<std::vector<Product>>::fromString( compact ), products );
+    }
+
     //----------------------------------------------
     // Nested containers
     //----------------------------------------------
@@ -977,73 +1768,353 @@ namespace nfx::serialization::json::test
     }
 
     //----------------------------------------------
-    // Stress test with large data structures
+    // Output size estimation
     //----------------------------------------------
 
-    TEST_F( JSONSerializerTest, LargeDataStructures )
+    /**
+     * @brief Key and value written like a multimap entry, following Options::pairLayout
+     */
+    struct LayoutEntry
     {
-        // Large vector
+        std::string key;
+        int value = 0;
+    };
+
+    TEST_F( JSONSerializerTest, EstimateSize )
+    {
+        // Numbers are bounded from above, unescaped strings are counted exactly
         {
-            std::vector<int> largeVector;
-            for( int i = 0; i < 1000; ++i )
-            {
-                largeVector.push_back( i );
-            }
-            testRoundTrip( largeVector );
+            std::vector<int> data{ 1, -20, 300, std::numeric_limits<int>::min() };
+            std::string jsonStr = Serializer<std::vector<int>>::toString( data );
+            EXPECT_GE( Serializer<std::vector<int>>::estimateSize( data ), jsonStr.size() );
+
+            // Sized from the count alone: brackets, separators and four times the widest int
+            EXPECT_EQ( Serializer<std::vector<int>>::estimateSize( data ), 2 + 3 + 4 * 11u );
         }
 
-        // Large map
         {
-            std::map<std::string, int> largeMap;
-            for( int i = 0; i < 500; ++i )
-            {
-                std::string key = "key_" + std::to_string( i );
-                largeMap[key] = i * i;
-            }
-            testRoundTrip( largeMap );
+            using Nested = std::map<std::string, std::vector<std::optional<double>>>;
+            Nested data{ { "alpha", { 1.5, std::nullopt, -2.25e-300 } }, { "beta", {} }, { "gamma", { 0.0 } } };
+
+            Serializer<Nested>::Options options;
+            options.prettyPrint = true;
+
+            std::string jsonStr = Serializer<Nested>::toString( data, options );
+            const std::size_t estimate = Serializer<Nested>::estimateSize( data, options );
+            EXPECT_GE( estimate, jsonStr.size() );
+            EXPECT_GT( estimate, Serializer<Nested>::estimateSize( data ) ) << "Indentation should be accounted";
         }
 
-        // Large custom container
         {
-            CustomHashMap<std::string, int> largeCustomMap;
-            for( int i = 0; i < 250; ++i )
+            using Row = std::tuple<std::string, bool, std::variant<int, std::string>>;
+            std::vector<Row> data{ { "first", true, 42 }, { "second", false, std::string{ "text" } } };
+            std::string jsonStr = Serializer<std::vector<Row>>::toString( data );
+            EXPECT_GE( Serializer<std::vector<Row>>::estimateSize( data ), jsonStr.size() );
+        }
+
+        // Traits estimating their size see the options of the call
+        {
+            const LayoutEntry entry{ "a", 1 };
+            Serializer<LayoutEntry>::Options compact;
+            compact.pairLayout = PairLayout::Array;
+            EXPECT_EQ( Serializer<LayoutEntry>::toString( entry, compact ), R"(["a",1])" );
+            EXPECT_EQ( Serializer<LayoutEntry>::estimateSize( entry, compact ), 7u );
+            EXPECT_EQ( Serializer<LayoutEntry>::estimateSize( entry ), 21u );
+        }
+
+        // The exact size of the last output is recorded for repeated shapes
+        {
+            std::vector<std::string> data{ "a", "bb", "ccc" };
+            std::size_t hint = 0;
+
+            Serializer<std::vector<std::string>>::Options options;
+            options.sizeHint = &hint;
+
+            std::string first = Serializer<std::vector<std::string>>::toString( data, options );
+            EXPECT_EQ( hint, first.size() );
+
+            std::string second = Serializer<std::vector<std::string>>::toString( data, options );
+            EXPECT_EQ( first, second );
+            EXPECT_EQ( hint, second.size() );
+        }
+    }
+
+    TEST_F( JSONSerializerTest, SerializedSizeIsExact )
+    {
+        const auto expectExact = []<typename V>( const V& value ) {
+            for( const bool pretty : { false, true } )
             {
-                std::string key = "custom_key_" + std::to_string( i );
-                largeCustomMap.insert( key, i * 2 );
+                typename Serializer<V>::Options options;
+                options.prettyPrint = pretty;
+                EXPECT_EQ( Serializer<V>::serializedSize( value, options ),
+                           Serializer<V>::toString( value, options ).size() )
+                    << Serializer<V>::toString( value, options );
             }
-            testRoundTrip( largeCustomMap );
-        }
+        };
+
+        expectExact( std::vector<int64_t>{ 0, -7, 42, std::numeric_limits<int64_t>::min(), 1000000 } );
+        expectExact( std::vector<double>{ 0.5, -2.25, 1e300, 3.14159 } );
+        expectExact( std::vector<bool>{ true, false } );
+        expectExact( std::string{ "quote \" backslash \\ newline \n tab \t bell \x07" } );
+        expectExact(
+            std::map<std::string, std::vector<int>>{ { "a", { 1, 2 } }, { "empty", {} }, { "k\"ey", { 3 } } } );
+        expectExact( std::map<int, std::string>{ { -1, "minus" }, { 10, "ten" } } );
+        expectExact( std::multimap<std::string, int>{ { "x", 1 }, { "x", 2 } } );
+        expectExact( std::tuple<int, std::optional<std::string>, std::pair<int, int>>{ 1, std::nullopt, { 2, 3 } } );
+        expectExact( std::vector<std::variant<int, std::string>>{ 5, std::string{ "five" } } );
+
+        // User types are measured through their own serialization, indentation included
+        Person person;
+        person.name = "Dana";
+        person.age = 41;
+        person.email = "dana@example.com";
+        person.hobbies = { "climbing", "chess" };
+        expectExact( std::vector<Person>{ person, person } );
     }
 
     //----------------------------------------------
-    // Factory Deserialization Tests
+    // Cached fragments
     //----------------------------------------------
 
-    /**
-     * @brief Type with deleted default constructor (requires factory deserialization)
-     */
-    struct ImmutableConfig
+    TEST_F( JSONSerializerTest, CachedJsonFragments )
     {
-        const std::string endpoint;
-        const int port;
-        const bool secure;
+        using Profile = std::map<std::string, std::vector<int>>;
+        const Profile profile{ { "scores", { 1, 2, 3 } }, { "ranks", { 7 } } };
+
+        CachedJson<Profile> cached{ profile };
+        const std::string expected = Serializer<Profile>::toString( profile );
+
+        // Same output as the plain value, on first render and from the cache
+        EXPECT_EQ( Serializer<CachedJson<Profile>>::toString( cached ), expected );
+        EXPECT_EQ( Serializer<CachedJson<Profile>>::toString( cached ), expected );
+        EXPECT_EQ( Serializer<CachedJson<Profile>>::serializedSize( cached ), expected.size() );
+
+        // Mutation through the wrapper drops the fragment
+        const std::uint64_t version = cached.version();
+        cached.modify( []( Profile& value ) { value["scores"].push_back( 4 ); } );
+        EXPECT_GT( cached.version(), version );
+        EXPECT_EQ( Serializer<CachedJson<Profile>>::toString( cached ), Serializer<Profile>::toString( *cached ) );
+
+        // Pretty-printed output follows the enclosing indentation
+        std::vector<CachedJson<Profile>> wrapped{ cached, cached };
+        std::vector<Profile> plain{ *cached, *cached };
+        Serializer<std::vector<CachedJson<Profile>>>::Options prettyWrapped;
+        prettyWrapped.prettyPrint = true;
+        Serializer<std::vector<Profile>>::Options prettyPlain;
+        prettyPlain.prettyPrint = true;
+        EXPECT_EQ( Serializer<std::vector<CachedJson<Profile>>>::toString( wrapped, prettyWrapped ),
+                   Serializer<std::vector<Profile>>::toString( plain, prettyPlain ) );
+
+        // Each compact format keeps its own fragment
+        using Tagged = std::variant<int, std::string>;
+        CachedJson<Tagged> tagged{ Tagged{ std::string{ "x" } } };
+        Serializer<CachedJson<Tagged>>::Options wrappedIndexTags;
+        wrappedIndexTags.variantTagFormat = VariantTagFormat::Index;
+        Serializer<Tagged>::Options plainIndexTags;
+        plainIndexTags.variantTagFormat = VariantTagFormat::Index;
+        EXPECT_EQ( Serializer<CachedJson<Tagged>>::toString( tagged ), Serializer<Tagged>::toString( *tagged ) );
+        EXPECT_EQ( Serializer<CachedJson<Tagged>>::toString( tagged, wrappedIndexTags ),
+                   Serializer<Tagged>::toString( *tagged, plainIndexTags ) );
+
+        // Every encoding is cached under its own format, the default one included
+        using Grades = std::multimap<std::string, int>;
+        CachedJson<Grades> grades{ Grades{ { "a", 1 }, { "a", 2 } } };
+        Serializer<CachedJson<Grades>>::Options compact;
+        compact.pairLayout = PairLayout::Array;
+        EXPECT_EQ( Serializer<CachedJson<Grades>>::toString( grades ),
+                   R"([{"key":"a","value":1},{"key":"a","value":2}])" );
+        EXPECT_EQ( Serializer<CachedJson<Grades>>::toString( grades, compact ), R"([["a",1],["a",2]])" );
+        EXPECT_EQ( Serializer<CachedJson<Grades>>::serializedSize( grades, compact ), 17u );
+        EXPECT_EQ( Serializer<CachedJson<Grades>>::toString( grades ),
+                   R"([{"key":"a","value":1},{"key":"a","value":2}])" );
+        EXPECT_EQ( Serializer<CachedJson<Grades>>::toString( grades, compact ), R"([["a",1],["a",2]])" );
+
+        // Deserialization replaces the value
+        auto restored = Serializer<std::vector<CachedJson<Profile>>>::fromString( "[" + expected + "]" );
+        ASSERT_EQ( restored.size(), 1u );
+        EXPECT_EQ( *restored[0], profile );
+    }
+
+    //----------------------------------------------
+    // Non-throwing deserialization
+    //----------------------------------------------
+
+    TEST_F( JSONSerializerTest, TryFromStringSuccess )
+    {
+        const auto result = Serializer<std::map<std::string, std::vector<int>>>::tryFromString( R"({"a":[1,2]})" );
+
+        ASSERT_TRUE( result );
+        EXPECT_EQ( result->at( "a" ), ( std::vector<int>{ 1, 2 } ) );
+    }
+
+    TEST_F( JSONSerializerTest, TryFromStringReportsErrors )
+    {
+        using Nested = std::map<std::string, std::vector<int>>;
 
-        ImmutableConfig( std::string ep, int p, bool s )
-            : endpoint{ std::move( ep ) },
-              port{ p },
-              secure{ s }
         {
-        }
+            const std::string json = R"({"a":[1,2],"b/c":[3,"x"]})";
+            const auto result = Serializer<Nested>::tryFromString( json );
 
-        ImmutableConfig() = delete; // No default constructor!
+            ASSERT_FALSE( result );
+            EXPECT_EQ( result.error().code(), ErrorCode::TypeMismatch );
+            EXPECT_EQ( result.error().path(), "/b~1c/1" );
+            EXPECT_EQ( result.error().offset(), json.find( R"("x")" ) );
+            EXPECT_FALSE( result.error().message().empty() );
+        }
 
-        bool operator==( const ImmutableConfig& other ) const
         {
-            return endpoint == other.endpoint && port == other.port && secure == other.secure;
+            const auto result = Serializer<Nested>::tryFromString( R"({"a":[1,)" );
+
+            ASSERT_FALSE( result );
+            EXPECT_EQ( result.error().code(), ErrorCode::InvalidJson );
         }
-    };
 
-    /**
+        {
+            const auto result = Serializer<std::array<int, 3>>::tryFromString( "[1,2]" );
+
+            ASSERT_FALSE( result );
+            EXPECT_EQ( result.error().code(), ErrorCode::SizeMismatch );
+            EXPECT_EQ( result.error().path(), "" );
+            EXPECT_EQ( result.error().offset(), 0u );
+        }
+
+        {
+            const auto result = Serializer<std::vector<ExternalShape>>::tryFromString( R"([{"Square":{}}])" );
+
+            ASSERT_FALSE( result );
+            EXPECT_EQ( result.error().code(), ErrorCode::UnknownVariantTag );
+            EXPECT_EQ( result.error().path(), "/0" );
+        }
+
+        // Untagged variants try alternatives without leaking the rejected attempts
+        {
+            const auto result = Serializer<UntaggedValue>::tryFromString( "[1,2]" );
+
+            ASSERT_TRUE( result );
+            EXPECT_EQ( *result, ( UntaggedValue{ std::vector<int>{ 1, 2 } } ) );
+            EXPECT_EQ( Serializer<UntaggedValue>::tryFromString( "true" ).error().code(),
+                ErrorCode::NoMatchingAlternative );
+        }
+
+        // The throwing API is unchanged
+        EXPECT_THROW( Serializer<Nested>::fromString( R"({"a":["x"]})" ), std::runtime_error );
+    }
+
+    TEST_F( JSONSerializerTest, ErrorMessagesIncludeLocation )
+    {
+        using Records = std::vector<std::map<std::string, std::pair<int, std::string>>>;
+        const std::string json = R"([{"id":[1,"a"]},{"id":[2,"b"],"x/y":[true,"c"]}])";
+
+        try
+        {
+            Serializer<Records>::fromString( json );
+            FAIL() << "Expected std::runtime_error";
+        }
+        catch( const std::runtime_error& e )
+        {
+            const std::string expected = " at /1/x~1y/0 (offset " + std::to_string( json.find( "true" ) ) + ")";
+            EXPECT_NE( std::string{ e.what() }.find( expected ), std::string::npos ) << e.what();
+        }
+
+        const auto result = Serializer<Records>::tryFromString( json );
+        ASSERT_FALSE( result );
+        EXPECT_EQ( result.error().path(), "/1/x~1y/0" );
+        EXPECT_EQ( result.error().offset(), json.find( "true" ) );
+
+        // Exceptions thrown by user traits keep the location of the value being deserialized
+        Serializer<std::vector<Person>>::Options options;
+        options.validateOnDeserialize = true;
+        const auto custom = Serializer<std::vector<Person>>::tryFromString(
+            R"([{"name":"Ann","age":30},{"name":"Bob","age":200}])", options );
+        ASSERT_FALSE( custom );
+        EXPECT_EQ( custom.error().code(), ErrorCode::Custom );
+        EXPECT_EQ( custom.error().path(), "/1" );
+
+        // Not only std::runtime_error: std::stoi throws std::invalid_argument
+        const auto port = Serializer<Port>::tryFromString( R"("http")" );
+        ASSERT_FALSE( port );
+        EXPECT_EQ( port.error().code(), ErrorCode::Custom );
+
+        // Root-level failures carry no location suffix
+        try
+        {
+            Serializer<int>::fromString( R"("text")" );
+            FAIL() << "Expected std::runtime_error";
+        }
+        catch( const std::runtime_error& e )
+        {
+            EXPECT_STREQ( e.what(), "Cannot deserialize value as integral type" );
+        }
+    }
+
+    //----------------------------------------------
+    // Stress test with large data structures
+    //----------------------------------------------
+
+    TEST_F( JSONSerializerTest, LargeDataStructures )
+    {
+        // Large vector
+        {
+            std::vector<int> largeVector;
+            for( int i = 0; i < 1000; ++i )
+            {
+                largeVector.push_back( i );
+            }
+            testRoundTrip( largeVector );
+        }
+
+        // Large map
+        {
+            std::map<std::string, int> largeMap;
+            for( int i = 0; i < 500; ++i )
+            {
+                std::string key = "key_" + std::to_string( i );
+                largeMap[key] = i * i;
+            }
+            testRoundTrip( largeMap );
+        }
+
+        // Large custom container
+        {
+            CustomHashMap<std::string, int> largeCustomMap;
+            for( int i = 0; i < 250; ++i )
+            {
+                std::string key = "custom_key_" + std::to_string( i );
+                largeCustomMap.insert( key, i * 2 );
+            }
+            testRoundTrip( largeCustomMap );
+        }
+    }
+
+    //----------------------------------------------
+    // Factory Deserialization Tests
+    //----------------------------------------------
+
+    /**
+     * @brief Type with deleted default constructor (requires factory deserialization)
+     */
+    struct ImmutableConfig
+    {
+        const std::string endpoint;
+        const int port;
+        const bool secure;
+
+        ImmutableConfig( std::string ep, int p, bool s )
+            : endpoint{ std::move( ep ) },
+              port{ p },
+              secure{ s }
+        {
+        }
+
+        ImmutableConfig() = delete; // No default constructor!
+
+        bool operator==( const ImmutableConfig& other ) const
+        {
+            return endpoint == other.endpoint && port == other.port && secure == other.secure;
+        }
+    };
+
+    /**
      * @brief Nested type with deleted default constructor
      */
     struct NestedImmutable
@@ -1098,6 +2169,292 @@ namespace nfx::serialization::json::test
         EXPECT_EQ( deserialized.config.port, 8443 );
         EXPECT_EQ( deserialized.tags.size(), 3 );
     }
+
+    /**
+     * @brief Factory type that can be neither copied nor moved
+     */
+    struct Pinned
+    {
+        const int id;
+
+        explicit Pinned( int i )
+            : id{ i }
+        {
+        }
+
+        Pinned( const Pinned& ) = delete;
+        Pinned& operator=( const Pinned& ) = delete;
+    };
+
+    TEST_F( JSONSerializerTest, FactoryDeserializationNested )
+    {
+        // Factory types are built by fromDocument() at any level: containers, maps, optionals, pointers
+        const ImmutableConfig primary{ "https://a.example.com", 443, true };
+        const ImmutableConfig backup{ "http://b.example.com", 8080, false };
+
+        testRoundTrip( std::vector<ImmutableConfig>{ primary, backup } );
+        testRoundTrip( std::set<std::string>{ "a", "b" } );
+        testRoundTrip( std::map<std::string, ImmutableConfig>{ { "primary", primary }, { "backup", backup } } );
+        testRoundTrip( std::multimap<std::string, ImmutableConfig>{ { "site", primary }, { "site", backup } } );
+        testRoundTrip( std::forward_list<ImmutableConfig>{ primary, backup } );
+        testRoundTrip( std::optional<ImmutableConfig>{ primary } );
+        testRoundTrip( std::map<std::string, std::vector<NestedImmutable>>{
+            { "eu", { NestedImmutable{ primary, { "a" } }, NestedImmutable{ backup, {} } } } } );
+
+        const auto owned = Serializer<std::unique_ptr<ImmutableConfig>>::fromString(
+            Serializer<ImmutableConfig>::toString( backup ) );
+        ASSERT_NE( owned, nullptr );
+        EXPECT_EQ( *owned, backup );
+
+        // Existing entries of factory types are replaced rather than overwritten
+        std::map<std::string, ImmutableConfig> configs{ { "primary", backup } };
+        Serializer<std::map<std::string, ImmutableConfig>>::deserializeInto(
+            R"({"primary":{"endpoint":"https://a.example.com","port":443,"secure":true}})", configs );
+        EXPECT_EQ( configs.at( "primary" ), primary );
+
+        // Nested factory values are checked against their schema
+        EXPECT_THROW( Serializer<std::vector<ImmutableConfig>>::fromString(
+                          R"([{"endpoint":"https://a","port":0,"secure":true}])" ),
+                      std::runtime_error );
+
+        // Elements are constructed in the container's storage: no copy or move is needed
+        const auto pinned = Serializer<std::list<Pinned>>::fromString( "[1,2,3]" );
+        ASSERT_EQ( pinned.size(), 3 );
+        EXPECT_EQ( pinned.back().id, 3 );
+
+        const auto pinnedById = Serializer<std::map<std::string, Pinned>>::fromString( R"({"x":7})" );
+        EXPECT_EQ( pinnedById.at( "x" ).id, 7 );
+    }
+
+    //----------------------------------------------
+    // Schema validation
+    //----------------------------------------------
+
+    /**
+     * @brief Mutable type declaring a JSON Schema through its SerializationTraits
+     */
+    struct Endpoint
+    {
+        std::string host;
+        int port = 0;
+
+        bool operator==( const Endpoint& other ) const
+        {
+            return host == other.host && port == other.port;
+        }
+    };
+
+    /**
+     * @brief Type with a binary member, patched through its SerializationTraits
+     */
+    struct Firmware
+    {
+        std::string version;
+        std::vector<std::uint8_t> image;
+    };
+
+    /**
+     * @brief Type with cached shared pointees, patched through its SerializationTraits
+     */
+    struct Playlist
+    {
+        std::vector<CachedJson<std::shared_ptr<std::vector<int>>>> tracks;
+    };
+
+    TEST_F( JSONSerializerTest, MergePatch )
+    {
+        // Objects are diffed key by key: removed keys become null
+        using Inventory = std::map<std::string, std::map<std::string, int>>;
+        const Inventory before{ { "apples", { { "count", 3 }, { "price", 2 } } }, { "pears", { { "count", 1 } } } };
+        Inventory after = before;
+        after["apples"]["count"] = 4;
+        after.erase( "pears" );
+        after["plums"] = { { "count", 9 } };
+
+        EXPECT_EQ( Serializer<Inventory>::toMergePatch( before, after ),
+                   R"({"apples":{"count":4},"pears":null,"plums":{"count":9}})" );
+        EXPECT_EQ( Serializer<Inventory>::toMergePatch( after, after ), "{}" );
+
+        // Arrays and non-object values are replaced whole
+        using Lists = std::map<std::string, std::vector<int>>;
+        EXPECT_EQ( Serializer<Lists>::toMergePatch( { { "xs", { 1, 2 } }, { "ys", { 5 } } },
+                                                   { { "xs", { 1, 3 } }, { "ys", { 5 } } } ),
+                   R"({"xs":[1,3]})" );
+        EXPECT_EQ( Serializer<std::vector<int>>::toMergePatch( { 1 }, { 2 } ), "[2]" );
+
+        // Optional members: diffed when present on both sides, null when cleared
+        using Settings = std::map<std::string, std::optional<std::map<std::string, int>>>;
+        const Settings oldSettings{ { "limits", std::map<std::string, int>{ { "cpu", 1 }, { "mem", 2 } } },
+                                    { "quota", std::map<std::string, int>{ { "disk", 5 } } } };
+        const Settings newSettings{ { "limits", std::map<std::string, int>{ { "cpu", 2 }, { "mem", 2 } } },
+                                    { "quota", std::nullopt } };
+        EXPECT_EQ( Serializer<Settings>::toMergePatch( oldSettings, newSettings ),
+                   R"({"limits":{"cpu":2},"quota":null})" );
+
+        // User types list their members through SerializationTraits::writeMergePatch()
+        using Endpoints = std::map<std::string, Endpoint>;
+        const Endpoints oldEndpoints{ { "api", { "api.example.com", 80 } }, { "db", { "db.local", 5432 } } };
+        const Endpoints newEndpoints{ { "api", { "api.example.com", 443 } }, { "db", { "db.local", 5432 } } };
+        EXPECT_EQ( Serializer<Endpoints>::toMergePatch( oldEndpoints, newEndpoints ), R"({"api":{"port":443}})" );
+
+        // Member serializers see the options of the call: references are written, not cached
+        const auto track = std::make_shared<std::vector<int>>( std::vector<int>{ 1, 2 } );
+        Playlist playlist;
+        Playlist shared;
+        shared.tracks.emplace_back( track );
+        shared.tracks.emplace_back( track );
+        Serializer<Playlist>::Options references;
+        references.preserveSharedReferences = true;
+        EXPECT_EQ( Serializer<Playlist>::toMergePatch( playlist, shared, references ),
+                   R"({"tracks":[{"$id":1,"$value":[1,2]},{"$ref":1}]})" );
+        EXPECT_EQ( Serializer<Playlist>::toMergePatch( playlist, shared ), R"({"tracks":[[1,2],[1,2]]})" );
+    }
+
+    TEST_F( JSONSerializerTest, ApplyMergePatch )
+    {
+        // Patches produced by toMergePatch() turn before into after
+        using Inventory = std::map<std::string, std::map<std::string, int>>;
+        Inventory inventory{ { "apples", { { "count", 3 }, { "price", 2 } } }, { "pears", { { "count", 1 } } } };
+        Inventory expected = inventory;
+        expected["apples"]["count"] = 4;
+        expected.erase( "pears" );
+        expected["plums"] = { { "count", 9 } };
+
+        Serializer<Inventory>::applyMergePatch( Serializer<Inventory>::toMergePatch( inventory, expected ), inventory );
+        EXPECT_EQ( inventory, expected );
+
+        // Arrays are replaced, keeping the container's storage
+        using Lists = std::map<std::string, std::vector<int>>;
+        Lists lists{ { "xs", { 1, 2, 3, 4 } }, { "ys", { 5 } } };
+        const int* storage = lists["xs"].data();
+        Serializer<Lists>::applyMergePatch( R"({"xs":[7,8]})", lists );
+        EXPECT_EQ( lists, ( Lists{ { "xs", { 7, 8 } }, { "ys", { 5 } } } ) );
+        EXPECT_EQ( lists["xs"].data(), storage );
+
+        // Engaged optionals are patched through; null removes map entries (RFC 7386)
+        using Settings = std::map<std::string, std::optional<std::map<std::string, int>>>;
+        Settings settings{ { "limits", std::map<std::string, int>{ { "cpu", 1 }, { "mem", 2 } } },
+                           { "quota", std::map<std::string, int>{ { "disk", 5 } } } };
+        Serializer<Settings>::applyMergePatch( R"({"limits":{"cpu":2},"quota":null})", settings );
+        EXPECT_EQ( settings.at( "limits" ), ( std::map<std::string, int>{ { "cpu", 2 }, { "mem", 2 } } ) );
+        EXPECT_FALSE( settings.contains( "quota" ) );
+
+        // User types patch the members they list through SerializationTraits::applyMergePatch()
+        std::vector<Endpoint> endpoints{ { "api.example.com", 80 } };
+        Serializer<std::vector<Endpoint>>::applyMergePatch( R"([{"host":"db.local","port":5432}])", endpoints );
+        EXPECT_EQ( endpoints.front(), ( Endpoint{ "db.local", 5432 } ) );
+
+        Endpoint endpoint{ "api.example.com", 80 };
+        Serializer<Endpoint>::applyMergePatch( R"({"port":443})", endpoint );
+        EXPECT_EQ( endpoint, ( Endpoint{ "api.example.com", 443 } ) );
+
+        // Members are read with the options of the call
+        Serializer<Firmware>::Options hex;
+        hex.bytesFormat = BytesFormat::Hex;
+        Firmware firmware{ "1.0", { 1 } };
+        Serializer<Firmware>::applyMergePatch( R"({"version":"1.1","image":"0a0b"})", firmware, hex );
+        EXPECT_EQ( firmware.version, "1.1" );
+        EXPECT_EQ( firmware.image, ( std::vector<std::uint8_t>{ 0x0a, 0x0b } ) );
+
+        // Type mismatches are reported with the path of the patched value
+        try
+        {
+            Serializer<Inventory>::applyMergePatch( R"({"apples":{"count":"many"}})", inventory );
+            FAIL() << "Expected std::runtime_error";
+        }
+        catch( const std::runtime_error& e )
+        {
+            EXPECT_NE( std::string{ e.what() }.find( "/apples/count" ), std::string::npos ) << e.what();
+        }
+        EXPECT_THROW( Serializer<Inventory>::applyMergePatch( "{", inventory ), std::runtime_error );
+    }
+
+    TEST_F( JSONSerializerTest, DeserializeIntoReusesStorage )
+    {
+        // Sequences overwrite their elements in place and keep their buffers
+        std::vector<std::string> names{ "a rather long name that does not fit small-string storage", "b", "c" };
+        const std::string* buffer = names.data();
+        const char* firstName = names[0].data();
+        Serializer<std::vector<std::string>>::deserializeInto( R"(["short","x"])", names );
+        EXPECT_EQ( names, ( std::vector<std::string>{ "short", "x" } ) );
+        EXPECT_EQ( names.data(), buffer );
+        EXPECT_EQ( names[0].data(), firstName );
+
+        std::list<int> numbers{ 1, 2 };
+        const int* secondNumber = &numbers.back();
+        Serializer<std::list<int>>::deserializeInto( "[3,4,5]", numbers );
+        EXPECT_EQ( numbers, ( std::list<int>{ 3, 4, 5 } ) );
+        EXPECT_EQ( &*std::next( numbers.begin() ), secondNumber );
+
+        std::forward_list<int> chain;
+        Serializer<std::forward_list<int>>::deserializeInto( "[1,2,3]", chain );
+        EXPECT_EQ( chain, ( std::forward_list<int>{ 1, 2, 3 } ) );
+
+        // Map entries still present keep their nodes, the others are erased
+        using Lists = std::map<std::string, std::vector<int>>;
+        Lists lists{ { "xs", { 1, 2, 3 } }, { "ys", { 4 } }, { "zs", { 5 } } };
+        const int* xs = lists["xs"].data();
+        Serializer<Lists>::deserializeInto( R"({"xs":[7,8],"ws":[9]})", lists );
+        EXPECT_EQ( lists, ( Lists{ { "ws", { 9 } }, { "xs", { 7, 8 } } } ) );
+        EXPECT_EQ( lists["xs"].data(), xs );
+
+        // Engaged optionals and exclusively owned pointees are reused; shared pointees are not modified
+        std::optional<std::vector<int>> maybe{ std::vector<int>{ 1, 2 } };
+        const int* maybeBuffer = maybe->data();
+        Serializer<std::optional<std::vector<int>>>::deserializeInto( "[3]", maybe );
+        EXPECT_EQ( maybe->data(), maybeBuffer );
+
+        auto owned = std::make_shared<std::string>( "owned" );
+        const std::string* pointee = owned.get();
+        Serializer<std::shared_ptr<std::string>>::deserializeInto( R"("first")", owned );
+        EXPECT_EQ( owned.get(), pointee );
+
+        const std::shared_ptr<std::string> alias = owned;
+        Serializer<std::shared_ptr<std::string>>::deserializeInto( R"("second")", owned );
+        EXPECT_NE( owned.get(), pointee );
+        EXPECT_EQ( *alias, "first" );
+        EXPECT_EQ( *owned, "second" );
+
+        // The result matches fromString() of the same input
+        const std::string json = R"([{"host":"db.local","port":5432}])";
+        std::vector<Endpoint> endpoints{ { "api.example.com", 80 }, { "cache.local", 6379 } };
+        Serializer<std::vector<Endpoint>>::deserializeInto( json, endpoints );
+        EXPECT_EQ( endpoints, Serializer<std::vector<Endpoint>>::fromString( json ) );
+
+        std::vector<int> values{ 1 };
+        EXPECT_THROW( Serializer<std::vector<int>>::deserializeInto( "[1,", values ), std::runtime_error );
+    }
+
+    TEST_F( JSONSerializerTest, SchemaValidationOnDeserialize )
+    {
+        using Endpoints = std::vector<Endpoint>;
+
+        testRoundTrip( Endpoints{ { "localhost", 80 }, { "example.com", 443 } } );
+
+        const std::string json = R"([{"host":"a","port":80},{"host":"b","port":70000}])";
+        EXPECT_THROW( Serializer<Endpoints>::fromString( json ), std::runtime_error );
+
+        const auto result = Serializer<Endpoints>::tryFromString( json );
+        ASSERT_FALSE( result );
+        EXPECT_EQ( result.error().code(), ErrorCode::SchemaViolation );
+        EXPECT_EQ( result.error().path(), "/1" );
+
+        // Without validation the traits read the value as is
+        Serializer<Endpoints>::Options options;
+        options.validateOnDeserialize = false;
+        EXPECT_EQ( Serializer<Endpoints>::fromString( json, options )[1].port, 70000 );
+    }
+
+    TEST_F( JSONSerializerTest, SchemaValidationFactoryDeserialization )
+    {
+        // The schema rejects the value before the factory dereferences a missing field
+        const auto result = Serializer<ImmutableConfig>::tryFromString( R"({"endpoint":"https://a","secure":true})" );
+        ASSERT_FALSE( result );
+        EXPECT_EQ( result.error().code(), ErrorCode::SchemaViolation );
+
+        EXPECT_THROW( Serializer<ImmutableConfig>::fromString( R"({"endpoint":"https://a","port":0,"secure":true})" ),
+            std::runtime_error );
+    }
 } // namespace nfx::serialization::json::test
 
 //=====================================================================
@@ -1129,6 +2486,133 @@ namespace nfx::serialization::json
             auto secure = doc.get<bool>( "secure" ).value();
             return ImmutableConfig{ endpoint, port, secure };
         }
+
+        // Checked before fromDocument() when validateOnDeserialize is set
+        static Document schema()
+        {
+            return Document::fromString( R"({
+                "type": "object",
+                "required": ["endpoint", "port", "secure"],
+                "properties": { "port": { "type": "integer", "minimum": 1, "maximum": 65535 } }
+            })" ).value();
+        }
+    };
+
+    // Factory deserialization of a type that can only be constructed in place
+    template <>
+    struct SerializationTraits<::nfx::serialization::json::test::Pinned>
+    {
+        using Pinned = ::nfx::serialization::json::test::Pinned;
+
+        static void serialize( const Pinned& obj, Builder& builder )
+        {
+            builder.write( obj.id );
+        }
+
+        static Pinned fromDocument( const Document& doc )
+        {
+            return Pinned{ doc.get<int>( "" ).value() };
+        }
+    };
+
+    // Mutable deserialization with a schema
+    template <>
+    struct SerializationTraits<::nfx::serialization::json::test::Endpoint>
+    {
+        using Endpoint = ::nfx::serialization::json::test::Endpoint;
+
+        static void serialize( const Endpoint& obj, Builder& builder )
+        {
+            builder.writeStartObject();
+            builder.write( "host", obj.host );
+            builder.write( "port", obj.port );
+            builder.writeEndObject();
+        }
+
+        static void fromDocument( const Document& doc, Endpoint& obj )
+        {
+            obj.host = doc.get<std::string>( "host" ).value_or( "" );
+            obj.port = doc.get<int>( "port" ).value_or( 0 );
+        }
+
+        static void writeMergePatch( const Endpoint& before, const Endpoint& after, MergePatchWriter& patch )
+        {
+            patch.member( "host", before.host, after.host );
+            patch.member( "port", before.port, after.port );
+        }
+
+        static void applyMergePatch( MergePatchReader& patch, Endpoint& obj )
+        {
+            patch.member( "host", obj.host );
+            patch.member( "port", obj.port );
+        }
+
+        static Document schema()
+        {
+            return Document::fromString( R"({
+                "type": "object",
+                "required": ["host", "port"],
+                "properties": {
+                    "host": { "type": "string", "minLength": 1 },
+                    "port": { "type": "integer", "minimum": 1, "maximum": 65535 }
+                }
+            })" ).value();
+        }
+    };
+
+    template <>
+    struct SerializationTraits<::nfx::serialization::json::test::Playlist>
+    {
+        using Playlist = ::nfx::serialization::json::test::Playlist;
+
+        static void serialize( const Playlist& obj, Builder& builder )
+        {
+            builder.writeStartObject();
+            builder.writeKey( "tracks" );
+            Serializer<decltype( obj.tracks )>().serializeValue( obj.tracks, builder );
+            builder.writeEndObject();
+        }
+
+        static void writeMergePatch( const Playlist& before, const Playlist& after, MergePatchWriter& patch )
+        {
+            patch.member( "tracks", before.tracks, after.tracks );
+        }
+    };
+
+    template <>
+    struct SerializationTraits<::nfx::serialization::json::test::Firmware>
+    {
+        using Firmware = ::nfx::serialization::json::test::Firmware;
+
+        static void serialize( const Firmware& obj, Builder& builder )
+        {
+            builder.writeStartObject();
+            builder.write( "version", obj.version );
+            builder.writeKey( "image" );
+            Serializer<std::vector<std::uint8_t>>().serializeValue( obj.image, builder );
+            builder.writeEndObject();
+        }
+
+        static void fromDocument( const Document& doc, Firmware& obj )
+        {
+            obj.version = doc.get<std::string>( "version" ).value_or( "" );
+            if( const auto members = doc.rootRef<Object>() )
+            {
+                for( const auto& [key, value] : members->get() )
+                {
+                    if( key == "image" )
+                    {
+                        Serializer<std::vector<std::uint8_t>>().deserializeValue( value, obj.image );
+                    }
+                }
+            }
+        }
+
+        static void applyMergePatch( MergePatchReader& patch, Firmware& obj )
+        {
+            patch.member( "version", obj.version );
+            patch.member( "image", obj.image );
+        }
     };
 
     // Nested factory deserialization
@@ -1189,6 +2673,241 @@ namespace nfx::serialization::json
     };
 } // namespace nfx::serialization::json
 
+// Variant tag names, enumeration names and Slot serialization
+namespace nfx::serialization::json
+{
+    template <>
+    struct VariantTraits<::nfx::serialization::json::test::CollidingVariant>
+    {
+        static constexpr std::array<std::string_view, 2> names{ "ints", "doubles" };
+    };
+
+    template <>
+    struct VariantTraits<::nfx::serialization::json::test::IndexedVariant>
+    {
+        static constexpr VariantTagFormat tagFormat = VariantTagFormat::Index;
+    };
+
+    template <>
+    struct VariantTraits<::nfx::serialization::json::test::WideVariant>
+    {
+        static constexpr std::array<std::string_view, 24> names{ "slot0",  "slot1",  "slot2",  "slot3",  "slot4",
+                                                                 "slot5",  "slot6",  "slot7",  "slot8",  "slot9",
+                                                                 "slot10", "slot11", "slot12", "slot13", "slot14",
+                                                                 "slot15", "slot16", "slot17", "slot18", "slot19",
+                                                                 "slot20", "slot21", "slot22", "slot23" };
+    };
+
+    template <>
+    struct VariantTraits<::nfx::serialization::json::test::ExternalShape>
+    {
+        static constexpr VariantLayout layout = VariantLayout::External;
+    };
+
+    template <>
+    struct VariantTraits<::nfx::serialization::json::test::InternalShape>
+    {
+        static constexpr std::array<std::string_view, 2> names{ "rect", "circle" };
+        static constexpr VariantLayout layout = VariantLayout::Internal;
+        static constexpr std::string_view tagKey = "kind";
+    };
+
+    template <>
+    struct VariantTraits<::nfx::serialization::json::test::InternalRecord>
+    {
+        static constexpr std::array<std::string_view, 2> names{ "product", "rect" };
+        static constexpr VariantLayout layout = VariantLayout::Internal;
+    };
+
+    template <>
+    struct VariantTraits<::nfx::serialization::json::test::UntaggedValue>
+    {
+        static constexpr VariantLayout layout = VariantLayout::Untagged;
+    };
+
+    template <>
+    struct SerializationTraits<::nfx::serialization::json::test::LayoutEntry>
+    {
+        using LayoutEntry = ::nfx::serialization::json::test::LayoutEntry;
+
+        static void serialize( const LayoutEntry& obj, Builder& builder )
+        {
+            if( detail::currentPairLayout() == PairLayout::Array )
+            {
+                builder.writeStartArray();
+                builder.write( obj.key );
+                builder.write( obj.value );
+                builder.writeEndArray();
+                return;
+            }
+
+            builder.writeStartObject();
+            builder.write( "key", obj.key );
+            builder.write( "value", obj.value );
+            builder.writeEndObject();
+        }
+
+        static std::size_t estimateSize( const LayoutEntry& obj )
+        {
+            // ["k",v] or {"key":"k","value":v}, for values of one digit
+            return obj.key.size() + ( detail::currentPairLayout() == PairLayout::Array ? 6 : 20 );
+        }
+    };
+
+    template <>
+    struct VariantTraits<::nfx::serialization::json::test::PortOrName>
+    {
+        static constexpr VariantLayout layout = VariantLayout::Untagged;
+    };
+
+    template <>
+    struct SerializationTraits<::nfx::serialization::json::test::Port>
+    {
+        using Port = ::nfx::serialization::json::test::Port;
+
+        static void serialize( const Port& obj, Builder& builder )
+        {
+            builder.write( std::to_string( obj.number ) );
+        }
+
+        static void fromDocument( const Document& doc, Port& obj )
+        {
+            const auto text = doc.rootRef<std::string>();
+            obj.number = std::stoi( text ? text->get() : std::string{} );
+        }
+    };
+
+    template <>
+    struct SerializationTraits<::nfx::serialization::json::test::MeshPair>
+    {
+        using MeshPair = ::nfx::serialization::json::test::MeshPair;
+        using Mesh = std::shared_ptr<std::vector<int>>;
+
+        static void serialize( const MeshPair& obj, Builder& builder )
+        {
+            const Serializer<Mesh> meshes;
+            builder.writeStartObject();
+            builder.writeKey( "first" );
+            meshes.serializeValue( obj.first, builder );
+            builder.writeKey( "second" );
+            meshes.serializeValue( obj.second, builder );
+            builder.writeEndObject();
+        }
+
+        static void fromDocument( const Document& doc, MeshPair& obj )
+        {
+            const auto members = doc.rootRef<Object>();
+            if( !members )
+            {
+                return;
+            }
+
+            const Serializer<Mesh> meshes;
+            for( const auto& [key, value] : members->get() )
+            {
+                meshes.deserializeValue( value, key == "first" ? obj.first : obj.second );
+            }
+        }
+    };
+
+    template <>
+    struct VariantTraits<::nfx::serialization::json::test::DiscriminatedShape>
+    {
+        static constexpr VariantLayout layout = VariantLayout::Untagged;
+
+        static std::size_t discriminate( const Document& doc )
+        {
+            if( doc.isNull( "" ) )
+            {
+                return 0;
+            }
+            return doc.contains( "/radius" ) ? 1 : 2;
+        }
+    };
+
+    template <>
+    struct EnumTraits<::nfx::serialization::json::test::Permission>
+    {
+        static constexpr bool flags = true;
+    };
+
+    template <>
+    struct EnumTraits<::nfx::serialization::json::test::Level>
+    {
+        static constexpr std::array values{ ::nfx::serialization::json::test::Level::Warning,
+                                            ::nfx::serialization::json::test::Level::Error };
+        static constexpr std::array<std::string_view, 2> names{ "warn", "error \"fatal\"" };
+    };
+
+    template <>
+    struct SerializationTraits<::nfx::serialization::json::test::Circle>
+    {
+        using Circle = ::nfx::serialization::json::test::Circle;
+
+        static void serialize( const Circle& obj, Builder& builder )
+        {
+            builder.writeStartObject();
+            builder.write( "radius", obj.radius );
+            builder.writeEndObject();
+        }
+
+        static void serializeMembers( const Circle& obj, Builder& builder )
+        {
+            builder.write( "radius", obj.radius );
+        }
+
+        static void fromDocument( const Document& doc, Circle& obj )
+        {
+            auto radius = doc.get<double>( "/radius" );
+            if( !radius )
+            {
+                throw std::runtime_error{ "Missing radius field" };
+            }
+            obj.radius = *radius;
+        }
+    };
+
+    template <>
+    struct SerializationTraits<::nfx::serialization::json::test::Rectangle>
+    {
+        using Rectangle = ::nfx::serialization::json::test::Rectangle;
+
+        static void serialize( const Rectangle& obj, Builder& builder )
+        {
+            builder.writeStartObject();
+            builder.write( "width", obj.width );
+            builder.write( "height", obj.height );
+            builder.writeEndObject();
+        }
+
+        static void fromDocument( const Document& doc, Rectangle& obj )
+        {
+            auto width = doc.get<double>( "/width" );
+            auto height = doc.get<double>( "/height" );
+            if( !width || !height )
+            {
+                throw std::runtime_error{ "Missing width or height field" };
+            }
+            obj.width = *width;
+            obj.height = *height;
+        }
+    };
+
+    template <std::size_t N>
+    struct SerializationTraits<::nfx::serialization::json::test::Slot<N>>
+    {
+        static void serialize( const ::nfx::serialization::json::test::Slot<N>& obj, Builder& builder )
+        {
+            builder.write( obj.value );
+        }
+
+        static void fromDocument( const Document& doc, ::nfx::serialization::json::test::Slot<N>& obj )
+        {
+            obj.value = static_cast<int>( doc.get<int64_t>( "" ).value() );
+        }
+    };
+} // namespace nfx::serialization::json
+
 namespace nfx::serialization::json::detail
 {
     // Specialize is_container for CustomHashMap
@@ -1203,3 +2922,5 @@ namespace nfx::serialization::json::detail
     {
     };
 } // namespace nfx::serialization::json::detail
+
+NFX_SERIALIZATION_ENUM( nfx::serialization::json::test::Region, West, East );